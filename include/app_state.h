@@ -89,8 +89,14 @@ struct AppState
 
     // Hijri date string, e.g. "17 Ramazan 1447"
     etl::string<32> hijriDate;
-    uint8_t hijriDay = 0;   // 1-30
-    uint8_t hijriMonth = 0; // 1-12 (9 = Ramadan)
+    uint8_t hijriDay = 0;          // 1-30
+    uint8_t hijriMonth = 0;        // 1-12 (9 = Ramadan)
+    uint8_t hijriMonthLength = 30; // 29 or 30, from the religious calendar
+
+    // Religious calendar
+    etl::string<32> specialDay; // e.g. "Berat Kandili", empty on ordinary days
+    etl::string<32> nextEvent;  // e.g. "Ramazan Başlangıcı"
+    int16_t daysToNextEvent = -1;
 
     // Progress 0-100 through current prayer slot
     uint8_t activePrayerProgress = 0;
@@ -414,7 +420,7 @@ namespace AppStateHelper
             // But: last day of Ramadan after iftar → no sahur (Ramadan is over)
             //       pre-Ramadan (Sha'ban 29-30) → only show sahur, not iftar
             const bool isPreRamadan = (g_state.hijriMonth == 8);
-            const bool isLastRamadan = (g_state.hijriMonth == 9 && g_state.hijriDay >= 29);
+            const bool isLastRamadan = (g_state.hijriMonth == 9 && g_state.hijriDay >= g_state.hijriMonthLength);
 
             int targetSec = -1;
             const char *prefix = nullptr;
@@ -456,6 +462,31 @@ namespace AppStateHelper
         g_state.markDirty(DirtyFlag::COUNTDOWN);
     }
 
+    // Set Qibla bearing/distance/direction (changes with the location)
+    inline void setQibla(uint16_t degrees, etl::string_view distance, etl::string_view direction)
+    {
+        if (g_state.qiblaDegrees != degrees || g_state.qiblaDistance != distance ||
+            g_state.qiblaDirection != direction)
+        {
+            g_state.qiblaDegrees = degrees;
+            g_state.qiblaDistance.assign(distance.begin(), distance.end());
+            g_state.qiblaDirection.assign(direction.begin(), direction.end());
+            g_state.markDirty(DirtyFlag::LOCATION);
+        }
+    }
+
+    // Today's special day and the next event (religious calendar)
+    inline void setCalendarEvents(etl::string_view special, etl::string_view next, int16_t daysToNext)
+    {
+        if (g_state.specialDay != special || g_state.nextEvent != next || g_state.daysToNextEvent != daysToNext)
+        {
+            g_state.specialDay.assign(special.begin(), special.end());
+            g_state.nextEvent.assign(next.begin(), next.end());
+            g_state.daysToNextEvent = daysToNext;
+            g_state.markDirty(DirtyFlag::HIJRI);
+        }
+    }
+
     // Set Hijri date string separately from Gregorian
     inline void setHijriDate(etl::string_view hijri)
     {
@@ -29,6 +29,10 @@ namespace AudioConfig
 
 bool audioPlayerInit();
 bool playAudioFile(const char *filename);
+bool prepareAudioFile(const char *filename); // Pre-roll: codec up, file open, held before the first frame
+bool startPreparedAudio();                   // Release a prepared file (unmute + resume only)
+void cancelPreparedAudio();
+bool takeStartLatency(uint32_t &us);         // Start → first frame written to I2S, once per start
 bool playAudioURL(const char *url);
 bool isPlaying();
 bool isAudioFinished();
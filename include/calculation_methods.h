@@ -3,7 +3,7 @@
 
 /*
  * This header contains only the method ID and name mapping.
- * The full MethodSpec with Adhan-specific parameters is in prayer_calculator.cpp
+ * The full MethodSpec with Adhan-specific parameters is in method_registry.h
  */
 
 struct CalculationMethodInfo
@@ -13,7 +13,7 @@ struct CalculationMethodInfo
 };
 
 // All supported calculation methods
-// Must stay in sync with kMethodSpecs in prayer_calculator.cpp
+// Must stay in sync with kMethodSpecs in method_registry.h (static_assert there)
 inline constexpr CalculationMethodInfo CALCULATION_METHODS[] = {
     {1, "Karachi"},
     {2, "ISNA"},
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+
+// Calendar arithmetic without mktime/localtime (proleptic Gregorian).
+// H. Hinnant's days_from_civil / civil_from_days: day 0 = 1970-01-01.
+namespace CivilDate
+{
+    // Calendar date (local), month and day 1-based
+    struct Date
+    {
+        int16_t year;
+        int8_t month;
+        int8_t day;
+    };
+
+    constexpr int32_t daysFromCivil(int y, int m, int d)
+    {
+        y -= m <= 2;
+        const int era = (y >= 0 ? y : y - 399) / 400;
+        const int yoe = y - era * 400;
+        const int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+    constexpr int32_t daysFromCivil(const Date &date)
+    {
+        return daysFromCivil(date.year, date.month, date.day);
+    }
+
+    constexpr Date civilFromDays(int32_t z)
+    {
+        z += 719468;
+        const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+        const int32_t doe = z - era * 146097;
+        const int32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const int32_t mp = (5 * doy + 2) / 153;
+        const int d = doy - (153 * mp + 2) / 5 + 1;
+        const int m = mp < 10 ? mp + 3 : mp - 9;
+        const int y = yoe + era * 400 + (m <= 2);
+        return {(int16_t)y, (int8_t)m, (int8_t)d};
+    }
+
+    static_assert(daysFromCivil(1970, 1, 1) == 0, "epoch day");
+    static_assert(daysFromCivil(2000, 3, 1) == 11017, "leap century");
+}
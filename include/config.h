@@ -1,5 +1,6 @@
 #pragma once
 #include <string_view>
+#include <cstdint>
 
 // --- TEST MODE ---
 // Set to true to run prayer time comparison tests
@@ -25,11 +26,49 @@
 // This is compile-time only and does not affect persisted settings.
 #define FORCE_DAY_THEME false
 
+// Switch between the day and night palettes at sunrise / Maghrib.
+// Ignored when FORCE_DAY_THEME is set.
+#define AUTO_DAY_NIGHT_THEME true
+
+// --- PRAYER CALCULATION ENGINE ---
+// Set to true to compute sun positions in single precision on the S3 FPU
+// instead of the Adhan library's software doubles (solar_float.h). Keep false
+// until test_calc's test_float_* cases pass on your toolchain.
+// UNVERIFIED: the ±30 s comparison against the Adhan library has not been
+// run yet. Float vs a double instance of solar_float.h (same sweep: 15
+// methods, |lat| <= 62, every day of 2026) is 0.64 s worst, which does not
+// cover any difference between solar_float.h and the library itself.
+#define FLOAT_SOLAR_ENGINE false
+
 // --- COMPILE-TIME CONFIGURATION ---
 namespace Config
 {
     // Keep sleep wake-early and clock-jump catch-up window aligned across modules.
     constexpr int PRAYER_WAKE_EARLY_SEC = 5;
+    // Adhan pre-roll: codec powered and file opened this long before the
+    // prayer instant, so the deadline only releases playback. Must fall
+    // inside the wake-early window (the codec is re-initialized on wake).
+    constexpr int ADHAN_PREROLL_SEC = 3;
+    static_assert(ADHAN_PREROLL_SEC < PRAYER_WAKE_EARLY_SEC, "pre-roll must start after the light-sleep wake");
+
+    // UI pages other than home are built on first visit and freed after
+    // being hidden this long (0 = keep them once built).
+    constexpr uint32_t UI_PAGE_IDLE_FREE_MS = 5 * 60 * 1000;
+    // Keep a snapshot of the last freed page to show while it is rebuilt.
+    constexpr bool UI_PAGE_PLACEHOLDER = true;
+
+    // Pick the landscape mount from the IMU at boot and after each wake
+    // instead of FLIP_LANDSCAPE_180 (lvgl_display.cpp). Off until the
+    // accelerometer sign in ImuManager::readMount() is confirmed on hardware:
+    // a wrong sign turns every unit upside down with mirrored touch.
+    constexpr bool IMU_AUTO_MOUNT = false;
+
+    // Display flush: true = partial mode, dirty areas in 40-line strips sent
+    // to their own panel windows by a worker task while LVGL renders the next
+    // strip. false = direct_mode, one persistent full-screen buffer sent
+    // whole after every refresh (the proven path). Partial windows are not yet
+    // verified on the AXS15231B (partial RASET over QSPI), in R1 or R3.
+    constexpr bool LVGL_PARTIAL_FLUSH = false;
 
     constexpr std::string_view WIFI_SSID = "";
     constexpr std::string_view WIFI_PASS = "";
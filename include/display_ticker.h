@@ -2,8 +2,9 @@
 
 namespace DisplayTicker
 {
-    /// Called from main loop every iteration — throttled to 1/sec internally.
-    void tick();
+    /// Register the clock task with the Scheduler: every second while the
+    /// screen is on, on the minute otherwise.
+    void init();
 
     /// Force-populate AppState with current time, Gregorian date, Hijri date
     /// and NTP sync status. Call once after boot and after any time-sync event.
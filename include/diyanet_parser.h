@@ -36,9 +36,9 @@ namespace DiyanetParser
         if (hhMM[4] < '0' || hhMM[4] > '9')
             return false;
 
-        std::memcpy(out.value.data(), hhMM, TIME_STRING_LENGTH);
-        out.value[TIME_STRING_LENGTH] = '\0';
-        return true;
+        out = PrayerTime::fromMinutes(((hhMM[0] - '0') * 10 + (hhMM[1] - '0')) * 60 +
+                                      (hhMM[3] - '0') * 10 + (hhMM[4] - '0'));
+        return !out.isEmpty();
     }
 
     /**
@@ -1,10 +1,23 @@
 #pragma once
+#include <cstdint>
 
 namespace ImuManager
 {
+    // Which long edge of the landscape panel is down (gravity)
+    enum class Mount : uint8_t
+    {
+        UNKNOWN, // no IMU, no reading, or lying flat / on its side
+        NORMAL,
+        FLIPPED, // rotated 180° within landscape
+    };
+
     bool init();
     bool isAvailable();
     bool clearWakeStatus();
     bool armWakeOnMotion();
     void disarmAfterWake();
+
+    // One-shot accelerometer reading (~50 ms), sensor powered down again.
+    // Not while wake-on-motion is armed.
+    Mount readMount();
 }
@@ -18,6 +18,11 @@ namespace LocaleTR
         "Pazar", "Pazartesi", "Salı", "Çarşamba",
         "Perşembe", "Cuma", "Cumartesi"};
 
+    // 8-point compass, clockwise from north
+    constexpr const char *COMPASS_POINTS[] = {
+        "Kuzey", "Kuzeydoğu", "Doğu", "Güneydoğu",
+        "Güney", "Güneybatı", "Batı", "Kuzeybatı"};
+
     /// Turkish-aware UTF-8 uppercase converter.
     /// Returns pointer to internal static buffer — valid until next call.
     /// Double-buffered: safe for `func(toUpperTR(a), toUpperTR(b))`.
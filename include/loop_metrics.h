@@ -0,0 +1,146 @@
+#pragma once
+#include <cstdint>
+
+// Latency histograms for the calls made from loop(): how long each module
+// holds the loop task per pass, with min / max / p50 / p99, so a blocking
+// fetch or a full-frame flush shows up in the field. Times are measured
+// with the CPU cycle counter and kept as microseconds; served as JSON on
+// /api/metrics and printed by the "metrics" serial command.
+namespace LoopMetrics
+{
+    enum class Probe : uint8_t
+    {
+        DISPLAY,   // LvglDisplay::loop (render + flush)
+        PORTAL,    // PortalHandler::tick
+        WIFI,      // WifiManager::tick
+        PRAYER,    // PrayerEngine::tick
+        AUDIO,     // AudioPlayer::tick
+        SCHEDULER, // Scheduler::run (every due task handler)
+        SERVER,    // SettingsServer::handle
+        PASS,      // the whole busy part of one loop pass
+        COUNT
+    };
+
+    constexpr uint8_t PROBE_COUNT = static_cast<uint8_t>(Probe::COUNT);
+
+    // Log-linear buckets: exact below 4 µs, then 4 per doubling (at most
+    // 25 % wide) up to ~67 s, a fixed 400 bytes whatever the sample count.
+    // Percentiles are the upper edge of their bucket, never below the truth.
+    class Histogram
+    {
+    public:
+        static constexpr uint8_t SUB_BUCKETS = 4;
+        static constexpr uint8_t BUCKETS = 100;
+
+        static uint8_t bucketOf(uint32_t us)
+        {
+            if (us < SUB_BUCKETS)
+                return static_cast<uint8_t>(us);
+            uint8_t octave = 31;
+            while (!(us & (1u << octave)))
+                octave--;
+            const uint32_t bucket = (octave - 1u) * SUB_BUCKETS + ((us >> (octave - 2)) & (SUB_BUCKETS - 1));
+            return bucket < BUCKETS ? static_cast<uint8_t>(bucket) : BUCKETS - 1;
+        }
+
+        // Smallest value that falls into `bucket`
+        static uint32_t lowerBound(uint8_t bucket)
+        {
+            if (bucket < SUB_BUCKETS)
+                return bucket;
+            const uint8_t octave = bucket / SUB_BUCKETS + 1;
+            return (SUB_BUCKETS + bucket % SUB_BUCKETS) << (octave - 2);
+        }
+
+        void add(uint32_t us)
+        {
+            m_buckets[bucketOf(us)]++;
+            if (m_count == 0 || us < m_min)
+                m_min = us;
+            if (us > m_max)
+                m_max = us;
+            m_count++;
+            m_total += us;
+        }
+
+        void reset() { *this = Histogram(); }
+
+        uint32_t count() const { return m_count; }
+        uint32_t min() const { return m_min; }
+        uint32_t max() const { return m_max; }
+        uint64_t total() const { return m_total; }
+        uint32_t mean() const { return m_count ? static_cast<uint32_t>(m_total / m_count) : 0; }
+
+        // Value at or below which `pct` percent of the samples lie, 0 if empty
+        uint32_t percentile(uint8_t pct) const
+        {
+            if (m_count == 0)
+                return 0;
+            const uint64_t rank = (static_cast<uint64_t>(m_count) * pct + 99) / 100;
+            uint64_t seen = 0;
+            for (uint8_t bucket = 0; bucket < BUCKETS; bucket++)
+            {
+                seen += m_buckets[bucket];
+                if (seen < rank)
+                    continue;
+                const uint32_t upper = bucket + 1 < BUCKETS ? lowerBound(bucket + 1) - 1 : m_max;
+                return upper < m_min ? m_min : (upper > m_max ? m_max : upper);
+            }
+            return m_max;
+        }
+
+    private:
+        uint32_t m_buckets[BUCKETS] = {};
+        uint32_t m_count = 0;
+        uint32_t m_min = 0;
+        uint32_t m_max = 0;
+        uint64_t m_total = 0;
+    };
+
+    // Device side (loop_metrics.cpp) ──────────────────────────────────────
+    // Loop task only, except lightSleepDone() which runs on it anyway.
+
+    struct Stamp
+    {
+        uint32_t cycles; // CPU cycle counter: wraps after ~17 s at 240 MHz …
+        uint32_t ticks;  // … so long calls fall back to the FreeRTOS tick
+        uint32_t sleeps;
+    };
+
+    Stamp start();
+    void stop(Probe probe, const Stamp &since);
+
+    class Scope
+    {
+        Probe probe_;
+        Stamp since_;
+
+    public:
+        explicit Scope(Probe probe) : probe_(probe), since_(start()) {}
+        ~Scope() { stop(probe_, since_); }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+    // Call `fn` and record how long it took: measure(Probe::WIFI, WifiManager::tick)
+    template <typename Fn>
+    inline auto measure(Probe probe, Fn fn)
+    {
+        Scope scope(probe);
+        return fn();
+    }
+
+    // PowerManager woke from light sleep: samples that span it are dropped
+    void lightSleepDone();
+
+    const char *name(Probe probe);
+    const Histogram &histogram(Probe probe);
+
+    // Time covered by the histograms (since boot or the last reset)
+    uint32_t windowMs();
+
+    void reset();
+
+    // Table on Serial
+    void dump();
+}
@@ -26,10 +26,17 @@
    MEMORY SETTINGS - Use PSRAM
  *====================*/
 #define LV_MEM_CUSTOM 1
+#ifdef UI_SIM /* Headless simulator (env:sim) — host heap */
+#define LV_MEM_CUSTOM_INCLUDE <stdlib.h>
+#define LV_MEM_CUSTOM_ALLOC(size) malloc(size)
+#define LV_MEM_CUSTOM_FREE(p) free(p)
+#define LV_MEM_CUSTOM_REALLOC(p, size) realloc(p, size)
+#else
 #define LV_MEM_CUSTOM_INCLUDE <esp_heap_caps.h>
 #define LV_MEM_CUSTOM_ALLOC(size) heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
 #define LV_MEM_CUSTOM_FREE(p) free(p)
 #define LV_MEM_CUSTOM_REALLOC(p, size) heap_caps_realloc(p, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#endif
 
 #define LV_MEM_SIZE (48 * 1024U)
 
@@ -37,10 +44,15 @@
    HAL SETTINGS
  *====================*/
 #define LV_TICK_CUSTOM 1
+#ifdef UI_SIM /* Virtual clock stepped by sim/ui_sim.cpp */
+#define LV_TICK_CUSTOM_INCLUDE "ui_sim_tick.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (ui_sim_tick_ms())
+#else
 #define LV_TICK_CUSTOM_INCLUDE "Arduino.h"
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())
+#endif
 
-#define LV_DISP_DEF_REFR_PERIOD 16
+#define LV_DISP_DEF_REFR_PERIOD 16 /* Active rate; LvglDisplay governor drops to 1 s when idle */
 #define LV_INDEV_DEF_READ_PERIOD 20
 
 /*====================
@@ -132,6 +144,11 @@ extern "C"
 #define LV_USE_WIN 0
 #define LV_USE_SPAN 1
 
+/*====================
+   OTHERS
+ *====================*/
+#define LV_USE_SNAPSHOT 1 /* placeholder image for pages freed while idle */
+
 /*====================
    THEMES
  *====================*/
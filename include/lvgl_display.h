@@ -16,8 +16,13 @@ namespace LvglDisplay
     /// Call this ONCE at startup before any other display functions
     bool begin();
 
-    /// LVGL tick handler - call from main loop (handles timers, animations)
-    void loop();
+    /// LVGL tick handler - call from main loop (handles timers, animations).
+    /// Returns ms until LVGL's next timer is due (the loop may sleep that long).
+    uint32_t loop();
+
+    /// Switch the refresh governor to 60 Hz now (touch, wake, page change).
+    /// It falls back to ~1 Hz on its own once the screen is idle.
+    void boostRefresh();
 
     /// Initialize home screen UI (prayer data set by main.cpp)
     void showPrayerScreen();
@@ -31,6 +36,21 @@ namespace LvglDisplay
     void displayOff();
     void displayOn();
 
+    /// Select landscape mount at runtime: true = rotated 180° (R3 transfer),
+    /// false = default (R1 transfer). Touch mapping follows; the screen is redrawn.
+    void setFlipped(bool flipped);
+    bool isFlipped();
+
+    /// Read the mount from the IMU and setFlipped() to match; keeps the
+    /// current mount when the IMU has no clear answer (flat, absent).
+    /// No-op unless Config::IMU_AUTO_MOUNT is set.
+    void followMount();
+
+    /// Print / restart the flush counters ("metrics" command): QSPI transfer
+    /// time, and in partial mode the time LVGL was blocked waiting for it
+    void dumpFlushStats();
+    void resetFlushStats();
+
     /// True while a swipe gesture is being processed (suppress button clicks)
     bool isGestureActive();
 
@@ -0,0 +1,345 @@
+#pragma once
+#include "calculation_methods.h"
+#include "prayer_types.h"
+#include <array>
+#include <cstddef>
+#include <ctime>
+#include <utility>
+
+/*
+ * Calculation method registry shared by the firmware (prayer_calculator.cpp)
+ * and the native test (test/test_calc). Each method is a constexpr
+ * descriptor; Pipeline<Index> turns it into parameter setup, coordinate
+ * clamping and post-processing with the unused steps compiled out, and
+ * pipelineFor() dispatches by id through a table built at compile time.
+ *
+ * Needs the Adhan C declarations (prayer_times.h, solar_time.h, …) to be
+ * included, inside extern "C", before this header.
+ */
+namespace MethodRegistry
+{
+    struct NetAdjustments
+    {
+        int fajr = 0;
+        int sunrise = 0;
+        int dhuhr = 0;
+        int asr = 0;
+        int maghrib = 0;
+        int isha = 0;
+    };
+
+    // Steps applied after the library call, in this order
+    enum PostStep : uint8_t
+    {
+        POST_NONE = 0,
+        POST_DIYANET_KARAR = 1 << 0,   // 62° clamp + KARAR 2006/2009 high-latitude rules
+        POST_TEHRAN_MAGHRIB = 1 << 1,  // Maghrib at sun −4.5° (no maghribAngle in the C library)
+    };
+
+    struct MethodSpec
+    {
+        int id;
+        const char *name;
+        calculation_method calcMethod;
+        bool overrideAngles;
+        double fajrAngle;
+        double ishaAngle;
+        int ishaInterval;
+        bool forceHanafi;
+        uint8_t postSteps;
+        NetAdjustments dartNet;
+
+        constexpr bool has(PostStep step) const { return (postSteps & step) != 0; }
+    };
+
+    inline constexpr MethodSpec kMethodSpecs[] = {
+        // id, name, calcMethod, overrideAngles, fajr, isha, interval, forceHanafi, postSteps, dartNet
+        {1, "Karachi", KARACHI, false, 0, 0, 0, false, POST_NONE, NetAdjustments{0, 0, 1, 0, 0, 0}},
+        {2, "ISNA", NORTH_AMERICA, false, 0, 0, 0, false, POST_NONE, NetAdjustments{0, 0, 1, 0, 0, 0}},
+        {3, "MWL", MUSLIM_WORLD_LEAGUE, false, 0, 0, 0, false, POST_NONE, NetAdjustments{0, 0, 1, 0, 0, 0}},
+        {4, "Umm al-Qura", UMM_AL_QURA, false, 0, 0, 0, false, POST_NONE, NetAdjustments{}},
+        // Egyptian: override to Dart (19.5/17.5)
+        {5, "Egyptian", EGYPTIAN, true, 19.5, 17.5, 0, false, POST_NONE, NetAdjustments{0, 0, 1, 0, 0, 0}},
+        // Gulf: Fajr 19.5°, Isha 90 minutes after Maghrib
+        {6, "Gulf", GULF, false, 0, 0, 0, false, POST_NONE, NetAdjustments{}},
+        // Tehran: Maghrib from the −4.5° hour angle (maghribAngle missing in the library)
+        {7, "Tehran", OTHER, false, 17.7, 14.0, 0, false, POST_TEHRAN_MAGHRIB, NetAdjustments{}},
+        {8, "Dubai", OTHER, false, 18.2, 18.2, 0, false, POST_NONE, NetAdjustments{0, -3, 3, 3, 3, 0}},
+        {9, "Kuwait", KUWAIT, false, 0, 0, 0, false, POST_NONE, NetAdjustments{}},
+        {10, "Qatar", QATAR, false, 0, 0, 0, false, POST_NONE, NetAdjustments{}},
+        {11, "Singapore", OTHER, false, 20.0, 18.0, 0, false, POST_NONE, NetAdjustments{0, 0, 1, 0, 0, 0}},
+        {12, "France UOIF", OTHER, false, 12.0, 12.0, 0, false, POST_NONE, NetAdjustments{}},
+        {13, "Turkey Diyanet", OTHER, false, 18.0, 17.0, 0, false, POST_DIYANET_KARAR, NetAdjustments{0, -7, 5, 4, 7, 0}},
+        {14, "Russia", OTHER, false, 16.0, 15.0, 0, true, POST_NONE, NetAdjustments{}},
+        {15, "Moonsighting", MOON_SIGHTING_COMMITTEE, false, 0, 0, 0, false, POST_NONE, NetAdjustments{0, 0, 5, 0, 3, 0}},
+    };
+
+    inline constexpr int METHOD_COUNT = sizeof(kMethodSpecs) / sizeof(kMethodSpecs[0]);
+    inline constexpr int DEFAULT_METHOD = 3; // MWL
+
+    constexpr bool sameName(const char *a, const char *b)
+    {
+        while (*a && *a == *b)
+        {
+            ++a;
+            ++b;
+        }
+        return *a == *b;
+    }
+
+    // ids are 1…N in order (O(1) lookup) and match the UI list in calculation_methods.h
+    constexpr bool registryMatchesMethodList()
+    {
+        if (METHOD_COUNT != CALCULATION_METHOD_COUNT)
+            return false;
+        for (int i = 0; i < METHOD_COUNT; i++)
+        {
+            if (kMethodSpecs[i].id != i + 1 || CALCULATION_METHODS[i].id != i + 1 ||
+                !sameName(kMethodSpecs[i].name, CALCULATION_METHODS[i].name))
+                return false;
+        }
+        return true;
+    }
+    static_assert(registryMatchesMethodList(), "kMethodSpecs and CALCULATION_METHODS out of sync");
+    static_assert(kMethodSpecs[PRAYER_METHOD_DIYANET - 1].has(POST_DIYANET_KARAR), "Diyanet id");
+
+    constexpr const MethodSpec *findMethodSpec(int id)
+    {
+        return (id >= 1 && id <= METHOD_COUNT) ? &kMethodSpecs[id - 1] : nullptr;
+    }
+
+    // ═══════════════════════════════════════════════════════════════════
+    // Steps
+    // ═══════════════════════════════════════════════════════════════════
+
+    constexpr int internalDhuhrOffsetMinutes(calculation_method calcMethod)
+    {
+        if (calcMethod == MOON_SIGHTING_COMMITTEE)
+            return 5;
+
+        if (calcMethod == UMM_AL_QURA || calcMethod == GULF || calcMethod == QATAR)
+            return 0;
+
+        return 1;
+    }
+
+    constexpr int internalMaghribOffsetMinutes(calculation_method calcMethod)
+    {
+        return (calcMethod == MOON_SIGHTING_COMMITTEE) ? 3 : 0;
+    }
+
+    inline void applyDartNetAdjustments(calculation_parameters_t &params, const MethodSpec &spec)
+    {
+        const auto &net = spec.dartNet;
+
+        params.adjustments.fajr = net.fajr;
+        params.adjustments.sunrise = net.sunrise;
+        params.adjustments.asr = net.asr;
+        params.adjustments.isha = net.isha;
+
+        // C library already applies internal offsets for Dhuhr/Maghrib; compensate so net output matches Dart.
+        params.adjustments.dhuhr = net.dhuhr - internalDhuhrOffsetMinutes(spec.calcMethod);
+        params.adjustments.maghrib = net.maghrib - internalMaghribOffsetMinutes(spec.calcMethod);
+    }
+
+    // Diyanet high-latitude rules — KARAR 2006 + 2009 revision
+    //
+    // 2009 KARAR rules:
+    // a) For lat >= 45°: Isha = min(astronomical, Maghrib + şer'î_gece/3)
+    //    Şer'î gece = Maghrib → Fajr (astronomical)
+    // b) If şer'î_gece/3 > 80 dk → cap at 80 dk
+    // c) Mar-Sep: Fajr = Sunrise - (isha_offset + 10 dk)
+    // d) lat >= 62° → clamp to 62° (handled separately by clampLatitudeForDiyanet)
+    //
+    // Logic: use astronomical isha unless it exceeds the KARAR limit.
+    inline constexpr double DIYANET_HIGH_LAT_THRESHOLD = 45.0;
+    inline constexpr double DIYANET_MAX_LAT_CLAMP = 62.0;
+    inline constexpr int DIYANET_ISHA_CAP_MINUTES = 80; // 1 hour 20 minutes
+    inline constexpr int DIYANET_FAJR_EXTRA_MINUTES = 10;
+
+    inline void applyDiyanetHighLatitudeRules(prayer_times_t &times, double latitude, int month)
+    {
+        if (latitude < DIYANET_HIGH_LAT_THRESHOLD)
+        {
+            return; // No adjustments needed below 45°
+        }
+
+        const time_t maghrib = times.maghrib;
+        const time_t sunrise = times.sunrise;
+        const time_t fajr_astro = times.fajr;
+        const time_t isha_astro = times.isha;
+
+        // Şer'î gece = Maghrib → Fajr (astronomical)
+        // fajr_astro is next morning, so difference is positive
+        int seriGeceSeconds = (int)difftime(fajr_astro, maghrib);
+        if (seriGeceSeconds <= 0)
+        {
+            seriGeceSeconds += 24 * 3600; // safety wrap
+        }
+
+        // KARAR: 1/3 of şer'î gece (uncapped, for comparison)
+        int nightThirdSeconds = seriGeceSeconds / 3;
+
+        // Astronomical Isha offset from Maghrib
+        int astroIshaOffset = (int)difftime(isha_astro, maghrib);
+        if (astroIshaOffset <= 0)
+        {
+            astroIshaOffset += 24 * 3600;
+        }
+
+        // Compare astronomical with UNCAPPED 1/3 night:
+        // - Winter: astro < nightThird → keep astronomical
+        // - Summer: astro > nightThird (or astro invalid) → apply KARAR with 80dk cap
+        if (astroIshaOffset <= nightThirdSeconds && astroIshaOffset > 0 && astroIshaOffset < 12 * 3600)
+        {
+            // Astronomical Isha is earlier than 1/3 of night — keep it (winter)
+        }
+        else
+        {
+            // Astronomical exceeds 1/3 night or is invalid — apply KARAR
+            // Now apply the 80 dk cap (2009 KARAR rule b)
+            int ishaOffsetSeconds = nightThirdSeconds;
+            const int maxIshaOffset = DIYANET_ISHA_CAP_MINUTES * 60;
+            if (ishaOffsetSeconds > maxIshaOffset)
+            {
+                ishaOffsetSeconds = maxIshaOffset;
+            }
+
+            times.isha = maghrib + ishaOffsetSeconds;
+
+            // Rule c) Fajr = Sunrise - (isha_offset + 10 dk) for Mar-Sep
+            if (month >= 3 && month <= 9)
+            {
+                int fajrOffsetSeconds = ishaOffsetSeconds + (DIYANET_FAJR_EXTRA_MINUTES * 60);
+                times.fajr = sunrise - fajrOffsetSeconds;
+            }
+        }
+    }
+
+    constexpr double clampLatitudeForDiyanet(double latitude)
+    {
+        // Rule d: For latitudes >= 62°, use 62° for calculation
+        if (latitude >= DIYANET_MAX_LAT_CLAMP)
+        {
+            return DIYANET_MAX_LAT_CLAMP;
+        }
+        if (latitude <= -DIYANET_MAX_LAT_CLAMP)
+        {
+            return -DIYANET_MAX_LAT_CLAMP;
+        }
+        return latitude;
+    }
+
+    // Hour angles from the library's double solar_time module, built only
+    // when a step asks for one
+    struct LibrarySolar
+    {
+        time_t dateEpoch;
+        coordinates_t *coordinates;
+
+        double hourAngle(double angle, bool afterTransit) const
+        {
+            solar_time_t solarTime = new_solar_time(dateEpoch, coordinates);
+            return ::hourAngle(&solarTime, angle, afterTransit);
+        }
+    };
+
+    // Per-day inputs of the post-processing steps
+    struct DayContext
+    {
+        time_t dateEpoch;
+        long offsetSeconds; // applied to the library's times
+        double latitude;    // unclamped, for the Diyanet KARAR rules
+        int month;
+    };
+
+    // ═══════════════════════════════════════════════════════════════════
+    // Per-method pipeline
+    // ═══════════════════════════════════════════════════════════════════
+
+    template <int Index>
+    struct Pipeline
+    {
+        static constexpr const MethodSpec &spec = kMethodSpecs[Index];
+
+        static calculation_parameters_t parameters()
+        {
+            calculation_parameters_t params;
+            if constexpr (spec.calcMethod != OTHER)
+                params = getParameters(spec.calcMethod);
+            else if constexpr (spec.ishaInterval > 0)
+                params = new_calculation_parameters4(spec.fajrAngle, spec.ishaInterval, OTHER);
+            else
+                params = new_calculation_parameters3(spec.fajrAngle, spec.ishaAngle, OTHER);
+
+            if constexpr (spec.overrideAngles)
+            {
+                params.fajrAngle = spec.fajrAngle;
+                params.ishaAngle = spec.ishaAngle;
+            }
+            if constexpr (spec.forceHanafi)
+                params.madhab = madhab_t::HANAFI;
+
+            applyDartNetAdjustments(params, spec);
+            return params;
+        }
+
+        // Latitude handed to the library
+        static double coordinateLatitude(double latitude)
+        {
+            if constexpr (spec.has(POST_DIYANET_KARAR))
+                return clampLatitudeForDiyanet(latitude);
+            else
+                return latitude;
+        }
+
+        // False if a step could not apply (Tehran: the sun never reaches −4.5°)
+        template <typename Solar>
+        static bool postProcess(prayer_times_t &times, const DayContext &day, const Solar &solar)
+        {
+            bool applied = true;
+            if constexpr (spec.has(POST_DIYANET_KARAR))
+                applyDiyanetHighLatitudeRules(times, day.latitude, day.month);
+
+            if constexpr (spec.has(POST_TEHRAN_MAGHRIB))
+            {
+                time_components_t tc = from_double(solar.hourAngle(-4.5, true));
+                applied = is_valid_time(tc);
+                if (applied)
+                {
+                    times.maghrib = get_date_components(day.dateEpoch, &tc) + day.offsetSeconds +
+                                    spec.dartNet.maghrib * 60; // Net adjustment (0 for Tehran)
+                }
+            }
+            (void)day;
+            (void)solar;
+            return applied;
+        }
+    };
+
+    template <typename Solar>
+    struct MethodPipeline
+    {
+        const MethodSpec *spec;
+        calculation_parameters_t (*parameters)();
+        double (*coordinateLatitude)(double);
+        bool (*postProcess)(prayer_times_t &, const DayContext &, const Solar &);
+    };
+
+    template <typename Solar, size_t... I>
+    constexpr std::array<MethodPipeline<Solar>, sizeof...(I)> makePipelines(std::index_sequence<I...>)
+    {
+        return {{{&kMethodSpecs[I], &Pipeline<I>::parameters, &Pipeline<I>::coordinateLatitude,
+                  &Pipeline<I>::template postProcess<Solar>}...}};
+    }
+
+    template <typename Solar>
+    inline constexpr auto kPipelines = makePipelines<Solar>(std::make_index_sequence<METHOD_COUNT>{});
+
+    // nullptr for an unknown id
+    template <typename Solar>
+    constexpr const MethodPipeline<Solar> *pipelineFor(int id)
+    {
+        return (id >= 1 && id <= METHOD_COUNT) ? &kPipelines<Solar>[id - 1] : nullptr;
+    }
+}
@@ -11,8 +11,7 @@ namespace PowerManager
         SCREEN_OFF
     };
 
-    void init();
-    void tick();
+    void init(); // registers the Scheduler POWER task (dim / screen-off timeouts)
     void reportActivity();
     void enterLightSleep();
     State getState();
@@ -1,4 +1,5 @@
 #pragma once
+#include "civil_date.h"
 #include "daily_prayers.h"
 
 namespace PrayerAPI
@@ -19,6 +20,9 @@ namespace PrayerAPI
     // Returns false if cache is invalid/expired
     bool getCachedPrayerTimes(DailyPrayers &prayers, bool forTomorrow = false);
 
+    // Same for any local date inside the cached 30 days
+    bool getCachedPrayerTimes(const CivilDate::Date &date, DailyPrayers &prayers);
+
     // Get cache status info for display
     CacheInfo getCacheInfo();
 }
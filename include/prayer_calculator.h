@@ -1,11 +1,40 @@
 #pragma once
+#include "civil_date.h"
 #include "daily_prayers.h"
+#include <cstdint>
 
 namespace PrayerCalculator
 {
+    using CalcDate = CivilDate::Date;
+
     // Calculate prayer times using Adhan library (offline calculation)
     bool calculateTimes(DailyPrayers &prayers, int method, double latitude, double longitude, int day = 0, bool verbose = true);
 
+    // Batch version: `days` consecutive days from `start` into out[0..days-1].
+    // Method parameters are built once; per day it costs one Adhan call and
+    // one local-time lookup (DST still follows each date). Does not read the
+    // clock, so any date range works. Returns the number of days written.
+    int calculateRange(int method, double latitude, double longitude,
+                       const CalcDate &start, int days, DailyPrayers out[]);
+
+    // Several locations (structure-of-arrays), one date and method, e.g. the
+    // saved "world cities". The date's solar terms are computed once and per
+    // location only the hour angles run, in tight loops over the arrays
+    // (float with FLOAT_SOLAR_ENGINE, double otherwise).
+    struct Locations
+    {
+        const float *latitude;
+        const float *longitude;
+        const int32_t *utcOffsetSeconds; // each location's offset on `date`
+        int count;
+    };
+
+    // out[i] = times of location i. Returns the number of locations written.
+    int calculateLocations(int method, const CalcDate &date, const Locations &locations, DailyPrayers out[]);
+
+    // Calendar arithmetic without mktime (e.g. range start = today + n)
+    CalcDate addDays(const CalcDate &date, int days);
+
     // Helper: Get method name for display
     const char *getMethodName(int method);
 }
@@ -1,11 +1,24 @@
 #pragma once
+#include <cstdint>
 
 namespace PrayerEngine
 {
+    // Last adhan start, measured from the prayer instant to the first frame
+    // queued to I2S (audible after the DMA buffer, a fixed few ms)
+    struct AdhanTiming
+    {
+        bool valid;
+        bool prerolled;        // file was opened ahead of time
+        int32_t triggerUs;     // instant → playback released (loop wakeup, evaluate)
+        uint32_t firstFrameUs; // released → first frame decoded
+        int32_t worstUs;       // largest total since boot
+    };
+
     bool init();
     void tick();
     void recalculate();
     bool isReady();
     int getSecondsUntilNextPrayer();
     bool isAdhanPlaying();
+    AdhanTiming getLastAdhanTiming();
 }
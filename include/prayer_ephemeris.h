@@ -0,0 +1,426 @@
+#pragma once
+#include "civil_date.h"
+#include "daily_prayers.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+// Compressed per-location prayer schedule: each prayer's daily time, in
+// minutes after UTC midnight (continuous, so DST and midnight wraps are not
+// in the curve), is fitted per fixed block of days with a Chebyshev
+// polynomial. A lookup is one block index and a Clenshaw evaluation.
+//
+// Layout: Header, then blockCount × PRAYERS BlockEntry (block-major), then
+// the int16 coefficient pool. Coefficients: c0 in 1/4 min, c1… in 1/16 min.
+// Blocks the polynomial cannot hold to FIT_TOLERANCE (rule switches such as
+// the Diyanet Mar/Oct Fajr step) are split once at the largest kink, and
+// failing that stored raw (one int16 per day).
+namespace PrayerEphemeris
+{
+    constexpr uint32_t MAGIC = 0x31485045; // "EPH1"
+    constexpr uint16_t VERSION = 1;
+    constexpr size_t PRAYERS = 6;
+    constexpr uint8_t DEFAULT_BLOCK_DAYS = 64;
+    constexpr uint8_t MAX_BLOCK_DAYS = 128;
+    constexpr int MAX_DEGREE = 8;
+    constexpr float C0_SCALE = 4.0f;
+    constexpr float CN_SCALE = 16.0f;
+    constexpr int16_t RAW_NONE = INT16_MIN;
+    // Max |fit - source| in minutes; < 1 so the rounded value is within a minute
+    constexpr float FIT_TOLERANCE = 0.75f;
+
+    enum class Mode : uint8_t
+    {
+        Empty = 0, // every day has no time
+        Poly = 1,  // param = degree
+        Split = 2, // param = first day of the right half; pool[0] = degL | degR << 8
+        Raw = 3,   // one int16 per day, RAW_NONE for no time
+    };
+
+    struct __attribute__((packed)) Header
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t dayCount;
+        int32_t startDay; // CivilDate::daysFromCivil of the first day
+        uint8_t blockDays;
+        uint8_t reserved;
+        uint16_t blockCount;
+        uint32_t poolCount; // int16 coefficients after the block entries
+    };
+    static_assert(sizeof(Header) == 20, "ephemeris header layout is part of the format");
+
+    struct __attribute__((packed)) BlockEntry
+    {
+        uint16_t offset; // into the pool
+        Mode mode;
+        uint8_t param;
+    };
+
+    constexpr size_t entriesOffset()
+    {
+        return sizeof(Header);
+    }
+
+    constexpr size_t poolOffset(uint16_t blockCount)
+    {
+        return entriesOffset() + (size_t)blockCount * PRAYERS * sizeof(BlockEntry);
+    }
+
+    // x in [-1, 1] for day i of an n-day segment
+    inline float chebX(int i, int n)
+    {
+        return n > 1 ? (2.0f * i - (n - 1)) / (float)(n - 1) : 0.0f;
+    }
+
+    // Clenshaw sum of quantized coefficients (the same code checks the fit)
+    inline float evaluate(const int16_t *coeffs, int degree, float x)
+    {
+        float b1 = 0.0f, b2 = 0.0f;
+        for (int k = degree; k >= 1; k--)
+        {
+            const float b0 = coeffs[k] / CN_SCALE + 2.0f * x * b1 - b2;
+            b2 = b1;
+            b1 = b0;
+        }
+        return coeffs[0] / C0_SCALE + x * b1 - b2;
+    }
+
+    // Local minutes (PrayerTime) → minutes after UTC midnight, continued from
+    // `previous` so a curve never jumps by a day
+    inline int continuousMinutes(const PrayerTime &t, int offsetMinutes, int previous)
+    {
+        int u = t.toMinutes() - offsetMinutes;
+        if (previous != RAW_NONE)
+        {
+            while (u - previous > 720)
+                u -= 1440;
+            while (previous - u > 720)
+                u += 1440;
+        }
+        return u;
+    }
+
+    inline bool isValid(const uint8_t *blob, size_t len)
+    {
+        if (!blob || len < sizeof(Header))
+            return false;
+        Header h;
+        std::memcpy(&h, blob, sizeof(h));
+        return h.magic == MAGIC && h.version == VERSION && h.blockDays > 0 && h.blockDays <= MAX_BLOCK_DAYS &&
+               h.blockCount == (h.dayCount + h.blockDays - 1) / h.blockDays &&
+               len >= poolOffset(h.blockCount) + (size_t)h.poolCount * sizeof(int16_t);
+    }
+
+    // Times for `date` with local offset `offsetMinutes`. Blob must pass isValid().
+    inline bool evaluateDay(const uint8_t *blob, const CivilDate::Date &date, int offsetMinutes, DailyPrayers &out)
+    {
+        Header h;
+        std::memcpy(&h, blob, sizeof(h));
+        const int32_t index = CivilDate::daysFromCivil(date) - h.startDay;
+        if (index < 0 || index >= h.dayCount)
+            return false;
+
+        const int block = index / h.blockDays;
+        const int day = index % h.blockDays;
+        const int blockLen = (block == h.blockCount - 1) ? h.dayCount - block * h.blockDays : h.blockDays;
+        const int16_t *pool = reinterpret_cast<const int16_t *>(blob + poolOffset(h.blockCount));
+
+        for (size_t p = 0; p < PRAYERS; p++)
+        {
+            BlockEntry e;
+            std::memcpy(&e, blob + entriesOffset() + (block * PRAYERS + p) * sizeof(BlockEntry), sizeof(e));
+            const int16_t *c = pool + e.offset;
+
+            float minutes;
+            switch (e.mode)
+            {
+            case Mode::Poly:
+                minutes = evaluate(c, e.param, chebX(day, blockLen));
+                break;
+            case Mode::Split:
+            {
+                const int degL = c[0] & 0xFF;
+                const int degR = c[0] >> 8;
+                minutes = day < e.param ? evaluate(c + 1, degL, chebX(day, e.param))
+                                        : evaluate(c + 2 + degL, degR, chebX(day - e.param, blockLen - e.param));
+                break;
+            }
+            case Mode::Raw:
+                if (c[day] == RAW_NONE)
+                {
+                    out[PrayerType(p)] = PrayerTime{};
+                    continue;
+                }
+                minutes = c[day];
+                break;
+            case Mode::Empty:
+            default:
+                out[PrayerType(p)] = PrayerTime{};
+                continue;
+            }
+
+            int local = (int)std::lround(minutes) + offsetMinutes;
+            local = ((local % 1440) + 1440) % 1440;
+            out[PrayerType(p)] = PrayerTime::fromMinutes(local);
+        }
+        return true;
+    }
+
+    // Streaming generator: feed consecutive days with addDay(), then finish().
+    // Holds one block of samples; fitting is a small least-squares solve per
+    // block and prayer, so it runs on the device as well as on a host.
+    class Encoder
+    {
+    public:
+        bool begin(uint8_t *out, size_t capacity, const CivilDate::Date &start, uint16_t dayCount,
+                   uint8_t blockDays = DEFAULT_BLOCK_DAYS)
+        {
+            _out = out;
+            _capacity = capacity;
+            _ok = out && dayCount > 0 && blockDays > 0 && blockDays <= MAX_BLOCK_DAYS;
+            _header = {};
+            _header.magic = MAGIC;
+            _header.version = VERSION;
+            _header.dayCount = dayCount;
+            _header.startDay = CivilDate::daysFromCivil(start);
+            _header.blockDays = blockDays;
+            _header.blockCount = (uint16_t)((dayCount + blockDays - 1) / blockDays);
+            _ok = _ok && poolOffset(_header.blockCount) <= capacity;
+            _daysAdded = 0;
+            _block = 0;
+            _filled = 0;
+            for (size_t p = 0; p < PRAYERS; p++)
+                _previous[p] = RAW_NONE;
+            return _ok;
+        }
+
+        // `offsetMinutes`: the local UTC offset the day's times are in
+        bool addDay(const DailyPrayers &day, int offsetMinutes)
+        {
+            if (!_ok || _daysAdded >= _header.dayCount)
+                return _ok = false;
+            for (size_t p = 0; p < PRAYERS; p++)
+            {
+                const PrayerTime &t = day[PrayerType(p)];
+                if (t.isEmpty())
+                {
+                    _samples[p][_filled] = RAW_NONE;
+                    continue;
+                }
+                const int u = continuousMinutes(t, offsetMinutes, _previous[p]);
+                if (u <= RAW_NONE || u > INT16_MAX)
+                    return _ok = false;
+                _samples[p][_filled] = (int16_t)u;
+                _previous[p] = (int16_t)u;
+            }
+            _daysAdded++;
+            if (++_filled == blockLength(_block))
+                flushBlock();
+            return _ok;
+        }
+
+        // Bytes written, 0 on overflow or if fewer days than announced were added
+        size_t finish()
+        {
+            if (!_ok || _daysAdded != _header.dayCount)
+                return 0;
+            std::memcpy(_out, &_header, sizeof(_header));
+            return poolOffset(_header.blockCount) + (size_t)_header.poolCount * sizeof(int16_t);
+        }
+
+    private:
+        uint8_t *_out = nullptr;
+        size_t _capacity = 0;
+        bool _ok = false;
+        Header _header = {};
+        uint16_t _daysAdded = 0;
+        uint16_t _block = 0;
+        uint8_t _filled = 0;
+        int16_t _previous[PRAYERS] = {};
+        int16_t _samples[PRAYERS][MAX_BLOCK_DAYS] = {};
+
+        int blockLength(int block) const
+        {
+            return block == _header.blockCount - 1 ? _header.dayCount - block * _header.blockDays
+                                                   : _header.blockDays;
+        }
+
+        int16_t *pool() const
+        {
+            return reinterpret_cast<int16_t *>(_out + poolOffset(_header.blockCount));
+        }
+
+        bool reserve(size_t count)
+        {
+            const size_t end = poolOffset(_header.blockCount) + (_header.poolCount + count) * sizeof(int16_t);
+            if (end > _capacity || _header.poolCount + count > UINT16_MAX)
+                return _ok = false;
+            return true;
+        }
+
+        void flushBlock()
+        {
+            const int n = _filled;
+            for (size_t p = 0; p < PRAYERS; p++)
+            {
+                BlockEntry e = encode(_samples[p], n);
+                if (!_ok)
+                    return;
+                std::memcpy(_out + entriesOffset() + (_block * PRAYERS + p) * sizeof(BlockEntry), &e, sizeof(e));
+            }
+            _block++;
+            _filled = 0;
+        }
+
+        BlockEntry encode(const int16_t *y, int n)
+        {
+            BlockEntry e = {(uint16_t)_header.poolCount, Mode::Empty, 0};
+            int none = 0;
+            for (int i = 0; i < n; i++)
+                none += (y[i] == RAW_NONE);
+            if (none == n)
+                return e;
+
+            int16_t c[2 + 2 * (MAX_DEGREE + 1)];
+            if (none == 0)
+            {
+                const int degree = fitLowest(y, n, c);
+                if (degree >= 0)
+                    return append(e, Mode::Poly, (uint8_t)degree, c, degree + 1);
+
+                // One rule switch inside the block: split at the sharpest kink
+                const int split = sharpestKink(y, n);
+                if (split > 0)
+                {
+                    const int degL = fitLowest(y, split, c + 1);
+                    const int degR = degL >= 0 ? fitLowest(y + split, n - split, c + 2 + degL) : -1;
+                    if (degR >= 0)
+                    {
+                        c[0] = (int16_t)(degL | (degR << 8));
+                        return append(e, Mode::Split, (uint8_t)split, c, 2 + degL + degR + 1);
+                    }
+                }
+            }
+            return append(e, Mode::Raw, 0, y, n);
+        }
+
+        BlockEntry append(BlockEntry e, Mode mode, uint8_t param, const int16_t *values, int count)
+        {
+            if (!reserve(count))
+                return e;
+            std::memcpy(pool() + _header.poolCount, values, count * sizeof(int16_t));
+            _header.poolCount += count;
+            e.mode = mode;
+            e.param = param;
+            return e;
+        }
+
+        // Lowest degree whose quantized fit stays within tolerance, -1 if none
+        static int fitLowest(const int16_t *y, int n, int16_t *coeffs)
+        {
+            const int maxDegree = n - 1 < MAX_DEGREE ? n - 1 : MAX_DEGREE;
+            for (int degree = 0; degree <= maxDegree; degree++)
+            {
+                if (fit(y, n, degree, coeffs) && maxError(y, n, coeffs, degree) <= FIT_TOLERANCE)
+                    return degree;
+            }
+            return -1;
+        }
+
+        // Least squares in the Chebyshev basis (normal equations, ≤ 9×9)
+        static bool fit(const int16_t *y, int n, int degree, int16_t *coeffs)
+        {
+            const int m = degree + 1;
+            double a[MAX_DEGREE + 1][MAX_DEGREE + 2] = {};
+            for (int i = 0; i < n; i++)
+            {
+                const double x = chebX(i, n);
+                double t[MAX_DEGREE + 1];
+                t[0] = 1.0;
+                if (m > 1)
+                    t[1] = x;
+                for (int k = 2; k < m; k++)
+                    t[k] = 2.0 * x * t[k - 1] - t[k - 2];
+                for (int j = 0; j < m; j++)
+                {
+                    for (int k = 0; k < m; k++)
+                        a[j][k] += t[j] * t[k];
+                    a[j][m] += t[j] * y[i];
+                }
+            }
+
+            for (int col = 0; col < m; col++)
+            {
+                int pivot = col;
+                for (int r = col + 1; r < m; r++)
+                    if (std::fabs(a[r][col]) > std::fabs(a[pivot][col]))
+                        pivot = r;
+                if (std::fabs(a[pivot][col]) < 1e-12)
+                    return false;
+                if (pivot != col)
+                    for (int k = 0; k <= m; k++)
+                        std::swap(a[col][k], a[pivot][k]);
+                for (int r = 0; r < m; r++)
+                {
+                    if (r == col)
+                        continue;
+                    const double f = a[r][col] / a[col][col];
+                    for (int k = col; k <= m; k++)
+                        a[r][k] -= f * a[col][k];
+                }
+            }
+
+            for (int k = 0; k < m; k++)
+            {
+                const double scaled = a[k][m] / a[k][k] * (k == 0 ? C0_SCALE : CN_SCALE);
+                if (std::fabs(scaled) > INT16_MAX)
+                    return false;
+                coeffs[k] = (int16_t)std::lround(scaled);
+            }
+            return true;
+        }
+
+        static float maxError(const int16_t *y, int n, const int16_t *coeffs, int degree)
+        {
+            float worst = 0.0f;
+            for (int i = 0; i < n; i++)
+            {
+                const float err = std::fabs(evaluate(coeffs, degree, chebX(i, n)) - y[i]);
+                if (err > worst)
+                    worst = err;
+            }
+            return worst;
+        }
+
+        // Day index after the largest second difference (rule switches show as
+        // a step or a slope change); 0 if the block is too short to split
+        static int sharpestKink(const int16_t *y, int n)
+        {
+            int best = 0, bestValue = -1;
+            for (int i = 2; i < n - 1; i++)
+            {
+                const int d2 = std::abs(y[i + 1] - 2 * y[i] + y[i - 1]);
+                if (d2 > bestValue)
+                {
+                    bestValue = d2;
+                    best = (std::abs(y[i + 1] - y[i]) > std::abs(y[i] - y[i - 1])) ? i + 1 : i;
+                }
+            }
+            return best;
+        }
+    };
+
+    // Device side (prayer_ephemeris.cpp) ────────────────────────────────────
+
+    // Run the range calculator for `days` days from `start` and encode them
+    // into `out` in the current TZ. Bytes written, 0 on failure.
+    size_t generate(int method, double latitude, double longitude, const CivilDate::Date &start, uint16_t days,
+                    uint8_t *out, size_t capacity, uint8_t blockDays = DEFAULT_BLOCK_DAYS);
+
+    // Times for `date` from a generated blob, local offset from TimeZoneRules
+    bool lookup(const uint8_t *blob, size_t len, const CivilDate::Date &date, DailyPrayers &out);
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "civil_date.h"
+#include "daily_prayers.h"
+#include "prayer_table_format.h"
+#include <cstdint>
+
+// Precomputed prayer tables in LittleFS (format: prayer_table_format.h).
+// One file per source; a table answers only for the inputs it was built from.
+namespace PrayerTable
+{
+    // Times for `date` from the calculated table, if it was built for this
+    // method/location and the current TZ. One 12-byte read after the first call.
+    bool lookupCalculated(int method, double latitude, double longitude,
+                          const CivilDate::Date &date, DailyPrayers &out);
+
+    // Same for the Diyanet table of `diyanetId`
+    bool lookupDiyanet(int32_t diyanetId, const CivilDate::Date &date, DailyPrayers &out);
+
+    // Run the range calculator for `days` days from `start` and replace the
+    // calculated table. Streams in small chunks (no year-sized buffer).
+    bool buildCalculated(int method, double latitude, double longitude, const CivilDate::Date &start,
+                         uint16_t days = PrayerTableFormat::MAX_DAYS);
+
+    // Replace the Diyanet table with `count` consecutive days from `start`
+    bool importDiyanet(int32_t diyanetId, const CivilDate::Date &start, const DailyPrayers days[], uint16_t count);
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include "civil_date.h"
+#include "daily_prayers.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Binary prayer table: one Header, then dayCount records of 6 × uint16
+// (Fajr…Isha, minutes since local midnight, NO_TIME if missing). A year is
+// 80 + 366 × 12 = 4472 bytes; day i lives at recordOffset(i), so a lookup is
+// one 12-byte read. Little-endian, as written by the ESP32 (and read by hosts).
+namespace PrayerTableFormat
+{
+    constexpr uint32_t MAGIC = 0x31425450; // "PTB1"
+    constexpr uint16_t VERSION = 1;
+    constexpr uint16_t MAX_DAYS = 366;
+    constexpr uint16_t NO_TIME = PrayerTime::NONE;
+    constexpr size_t TZ_LEN = 48; // SettingsManager MAX_TZ_LEN
+    constexpr size_t PRAYERS = 6;
+    constexpr size_t RECORD_BYTES = PRAYERS * sizeof(uint16_t);
+
+    enum class Source : uint8_t
+    {
+        Calculated = 0, // PrayerCalculator::calculateRange
+        Diyanet = 1,    // imported from the Diyanet monthly API
+    };
+
+    struct __attribute__((packed)) Header
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        Source source;
+        uint8_t method;   // 1-15
+        uint16_t dayCount;
+        int32_t latE6;    // microdegrees
+        int32_t lonE6;
+        int32_t diyanetId; // 0 for calculated tables
+        int16_t startYear;
+        int8_t startMonth;
+        int8_t startDay;
+        char tz[TZ_LEN]; // POSIX TZ the local minutes were computed in
+        uint32_t crc;    // CRC-32 of this header (crc = 0) followed by all records
+    };
+    static_assert(sizeof(Header) == 80, "table header layout is part of the file format");
+
+    constexpr uint32_t recordOffset(int dayIndex)
+    {
+        return sizeof(Header) + (uint32_t)dayIndex * RECORD_BYTES;
+    }
+
+    constexpr uint32_t fileSize(uint16_t dayCount)
+    {
+        return recordOffset(dayCount);
+    }
+
+    // Standard CRC-32 (IEEE, reflected). Chainable: pass the previous result.
+    inline uint32_t crc32(const void *data, size_t len, uint32_t crc = 0)
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        crc = ~crc;
+        while (len--)
+        {
+            crc ^= *p++;
+            for (int k = 0; k < 8; k++)
+                crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+        return ~crc;
+    }
+
+    inline Header makeHeader(Source source, int method, double latitude, double longitude,
+                             int32_t diyanetId, const char *tz, const CivilDate::Date &start,
+                             uint16_t dayCount)
+    {
+        Header h = {};
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.headerSize = sizeof(Header);
+        h.source = source;
+        h.method = (uint8_t)method;
+        h.dayCount = dayCount;
+        h.latE6 = (int32_t)std::lround(latitude * 1e6);
+        h.lonE6 = (int32_t)std::lround(longitude * 1e6);
+        h.diyanetId = diyanetId;
+        h.startYear = start.year;
+        h.startMonth = start.month;
+        h.startDay = start.day;
+        if (tz)
+            std::strncpy(h.tz, tz, TZ_LEN - 1);
+        return h;
+    }
+
+    inline bool isValidHeader(const Header &h)
+    {
+        return h.magic == MAGIC && h.version == VERSION && h.headerSize == sizeof(Header) &&
+               h.dayCount > 0 && h.dayCount <= MAX_DAYS &&
+               h.startMonth >= 1 && h.startMonth <= 12 && h.startDay >= 1 && h.startDay <= 31 &&
+               std::memchr(h.tz, '\0', TZ_LEN) != nullptr;
+    }
+
+    // Same source and inputs → the stored minutes are the ones we would compute.
+    // Diyanet times come from the district, not the device TZ.
+    inline bool sameKey(const Header &a, const Header &b)
+    {
+        if (a.source != b.source)
+            return false;
+        if (a.source == Source::Diyanet)
+            return a.diyanetId == b.diyanetId;
+        return a.method == b.method && a.latE6 == b.latE6 && a.lonE6 == b.lonE6 &&
+               std::strncmp(a.tz, b.tz, TZ_LEN) == 0;
+    }
+
+    // Record index of `date`, -1 if the table does not cover it
+    inline int dayIndex(const Header &h, const CivilDate::Date &date)
+    {
+        const int32_t index = CivilDate::daysFromCivil(date) -
+                              CivilDate::daysFromCivil(h.startYear, h.startMonth, h.startDay);
+        return (index >= 0 && index < h.dayCount) ? (int)index : -1;
+    }
+
+    inline void packDay(const DailyPrayers &prayers, uint16_t out[PRAYERS])
+    {
+        for (uint8_t i = 0; i < PRAYERS; i++)
+        {
+            out[i] = prayers[PrayerType(i)].minutes;
+        }
+    }
+
+    // False if a stored value is out of range (corrupt record)
+    inline bool unpackDay(const uint16_t in[PRAYERS], DailyPrayers &prayers)
+    {
+        for (uint8_t i = 0; i < PRAYERS; i++)
+        {
+            if (in[i] != NO_TIME && in[i] >= 24 * 60)
+                return false;
+            prayers[PrayerType(i)].minutes = in[i];
+        }
+        return true;
+    }
+}
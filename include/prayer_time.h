@@ -1,29 +1,48 @@
 #pragma once
 #include <array>
+#include <cstdint>
 #include <string_view>
 
+// One prayer time as minutes since local midnight. Text ("HH:MM") is only
+// produced at the UI/log boundary via format().
 struct PrayerTime
 {
-    std::array<char, 6> value{"--:--"}; // Invalid marker for uninitialized
+    static constexpr uint16_t NONE = 0xFFFF; // Invalid marker for uninitialized
+
+    uint16_t minutes{NONE};
+
+    static constexpr PrayerTime fromMinutes(int m)
+    {
+        return PrayerTime{(m >= 0 && m < 24 * 60) ? static_cast<uint16_t>(m) : NONE};
+    }
 
     constexpr bool isEmpty() const
     {
-        return value[0] == '-';
+        return minutes == NONE;
+    }
+
+    constexpr int toMinutes() const
+    {
+        return minutes;
     }
 
-    int toMinutes() const
+    constexpr int toSeconds() const
     {
-        return (value[0] - '0') * 600 + (value[1] - '0') * 60 +
-               (value[3] - '0') * 10 + (value[4] - '0');
+        return minutes * 60;
     }
 
-    int toSeconds() const
+    // "HH:MM", or "--:--" when empty
+    std::array<char, 6> format() const
     {
-        return toMinutes() * 60;
+        if (isEmpty())
+            return {'-', '-', ':', '-', '-', '\0'};
+        const int h = minutes / 60;
+        const int m = minutes % 60;
+        return {char('0' + h / 10), char('0' + h % 10), ':', char('0' + m / 10), char('0' + m % 10), '\0'};
     }
 
     bool operator==(std::string_view other) const
     {
-        return std::string_view(value.data(), 5) == other;
+        return std::string_view(format().data(), 5) == other;
     }
 };
@@ -0,0 +1,132 @@
+#pragma once
+#include "civil_date.h"
+#include "daily_prayers.h"
+#include "prayer_types.h"
+#include "time_zone_rules.h"
+#include <cstdint>
+#include <ctime>
+
+// Rolling timeline of absolute prayer instants (UTC time_t) for yesterday,
+// today and tomorrow. "Which prayer is next" is a cursor that only steps
+// over the events that passed, the slot before Fajr starts at yesterday's
+// Isha, and a day rollover drops yesterday and appends one prepared day
+// instead of reloading everything. Local times are converted once, with
+// the zone's DST rules, when a day is added.
+namespace PrayerTimeline
+{
+    constexpr int DAYS = 3; // yesterday, today, tomorrow
+    constexpr int PRAYERS = static_cast<int>(PrayerType::COUNT);
+    constexpr int EVENTS = DAYS * PRAYERS;
+
+    struct Event
+    {
+        time_t at;
+        PrayerType prayer;
+        uint8_t day; // 0 = yesterday, 1 = today, 2 = tomorrow
+    };
+
+    class Timeline
+    {
+    public:
+        // Start over for local day `today` (days since 1970-01-01) with the
+        // times of yesterday, today and tomorrow in `days`
+        void reset(const TimeZoneRules::Zone &zone, int32_t today, const DailyPrayers days[DAYS])
+        {
+            m_head = 0;
+            m_today = today;
+            for (int i = 0; i < DAYS; i++)
+                store(zone, i, today - 1 + i, days[i]);
+            m_cursor = 0;
+            m_valid = true;
+        }
+
+        // Day rollover: today becomes yesterday and `dayAfter` (the times of
+        // the current tomorrow + 1) becomes tomorrow. O(1), nothing is moved.
+        void push(const TimeZoneRules::Zone &zone, const DailyPrayers &dayAfter)
+        {
+            const int oldest = m_head;
+            m_head = (uint8_t)((m_head + 1) % DAYS);
+            m_today++;
+            store(zone, oldest, m_today + 1, dayAfter);
+            m_cursor = m_cursor > PRAYERS ? (uint8_t)(m_cursor - PRAYERS) : 0;
+        }
+
+        bool valid() const { return m_valid; }
+        void clear() { m_valid = false; }
+
+        // Local day of slot `day` (0 = yesterday)
+        int32_t dayNumber(int day) const { return m_today - 1 + day; }
+        int32_t today() const { return m_today; }
+        const DailyPrayers &prayers(int day) const { return m_prayers[slot(day)]; }
+
+        // First event after `now`; false past tomorrow's last prayer. The
+        // cursor moves forward one step per passed event, backwards only
+        // when the clock was set back.
+        bool next(time_t now, Event &event)
+        {
+            if (!m_valid)
+                return false;
+            while (m_cursor < EVENTS && (isEmpty(m_cursor) || at(m_cursor) <= now))
+                m_cursor++;
+            int prev;
+            while ((prev = previousIndex(m_cursor)) >= 0 && at(prev) > now)
+                m_cursor = (uint8_t)prev;
+            if (m_cursor >= EVENTS)
+                return false;
+            event = eventAt(m_cursor);
+            return true;
+        }
+
+        // Event the current slot started at, i.e. the last one before the
+        // cursor (yesterday's Isha before today's Fajr); false if none
+        bool previous(Event &event) const
+        {
+            const int prev = previousIndex(m_cursor);
+            if (prev < 0)
+                return false;
+            event = eventAt(prev);
+            return true;
+        }
+
+    private:
+        DailyPrayers m_prayers[DAYS] = {};
+        time_t m_at[DAYS][PRAYERS] = {};
+        int32_t m_today = 0;
+        uint8_t m_head = 0;   // physical slot of yesterday
+        uint8_t m_cursor = 0; // logical index of the next event, EVENTS = none left
+        bool m_valid = false;
+
+        int slot(int day) const { return (m_head + day) % DAYS; }
+        time_t at(int index) const { return m_at[slot(index / PRAYERS)][index % PRAYERS]; }
+        bool isEmpty(int index) const
+        {
+            return m_prayers[slot(index / PRAYERS)][static_cast<PrayerType>(index % PRAYERS)].isEmpty();
+        }
+
+        int previousIndex(int index) const
+        {
+            for (int i = index - 1; i >= 0; i--)
+            {
+                if (!isEmpty(i))
+                    return i;
+            }
+            return -1;
+        }
+
+        Event eventAt(int index) const
+        {
+            return {at(index), static_cast<PrayerType>(index % PRAYERS), (uint8_t)(index / PRAYERS)};
+        }
+
+        void store(const TimeZoneRules::Zone &zone, int physical, int32_t day, const DailyPrayers &prayers)
+        {
+            m_prayers[physical] = prayers;
+            const time_t midnight = (time_t)day * 86400;
+            for (int p = 0; p < PRAYERS; p++)
+            {
+                const PrayerTime &time = prayers[static_cast<PrayerType>(p)];
+                m_at[physical][p] = time.isEmpty() ? 0 : zone.fromLocal(midnight + time.toSeconds());
+            }
+        }
+    };
+}
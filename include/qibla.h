@@ -0,0 +1,174 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "locale_tr.h" // needs <cstdint> first
+
+// Qibla: great-circle initial bearing and haversine distance to the Kaaba.
+// Everything is constexpr (own trig, no <cmath>), so results for fixed
+// coordinates can be checked at compile time; the device computes them
+// once per location change (qibla.cpp) and the UI only reads AppState.
+namespace Qibla
+{
+    constexpr double KAABA_LATITUDE = 21.422487;
+    constexpr double KAABA_LONGITUDE = 39.826206;
+    constexpr double EARTH_RADIUS_KM = 6371.0; // mean radius
+
+    namespace Math
+    {
+        constexpr double PI = 3.14159265358979323846;
+        constexpr double DEG_TO_RAD = PI / 180.0;
+        constexpr double RAD_TO_DEG = 180.0 / PI;
+
+        constexpr double abs(double x) { return x < 0 ? -x : x; }
+
+        // x reduced to [-π, π]
+        constexpr double wrapPi(double x)
+        {
+            const double turns = x / (2 * PI);
+            const long long whole = (long long)(turns < 0 ? turns - 0.5 : turns + 0.5);
+            return x - (double)whole * 2 * PI;
+        }
+
+        constexpr double sin(double x)
+        {
+            x = wrapPi(x);
+            double term = x, sum = x;
+            for (int n = 1; n < 30 && abs(term) > 1e-17; n++)
+            {
+                term *= -x * x / ((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double cos(double x)
+        {
+            x = wrapPi(x);
+            double term = 1, sum = 1;
+            for (int n = 1; n < 30 && abs(term) > 1e-17; n++)
+            {
+                term *= -x * x / ((2 * n - 1) * (2 * n));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double sqrt(double x)
+        {
+            if (x <= 0)
+                return 0;
+            double r = x < 1 ? 1 : x;
+            for (int i = 0; i < 100; i++)
+            {
+                const double next = 0.5 * (r + x / r);
+                if (next == r)
+                    break;
+                r = next;
+            }
+            return r;
+        }
+
+        constexpr double atan(double x)
+        {
+            if (x < 0)
+                return -atan(-x);
+            if (x > 1)
+                return PI / 2 - atan(1 / x);
+            // Halve the argument twice (|x| ≤ 0.2) so the series converges fast
+            for (int i = 0; i < 2; i++)
+                x = x / (1 + sqrt(1 + x * x));
+            double power = x, sum = x;
+            for (int n = 1; n < 40 && abs(power) > 1e-18; n++)
+            {
+                power *= -x * x;
+                sum += power / (2 * n + 1);
+            }
+            return 4 * sum;
+        }
+
+        constexpr double atan2(double y, double x)
+        {
+            if (x > 0)
+                return atan(y / x);
+            if (x < 0)
+                return y >= 0 ? atan(y / x) + PI : atan(y / x) - PI;
+            return y > 0 ? PI / 2 : (y < 0 ? -PI / 2 : 0);
+        }
+    }
+
+    struct Result
+    {
+        double bearing;    // degrees clockwise from true north, [0, 360)
+        double distanceKm; // great-circle distance
+    };
+
+    constexpr Result compute(double latitude, double longitude)
+    {
+        using namespace Math;
+        const double phi1 = latitude * DEG_TO_RAD;
+        const double phi2 = KAABA_LATITUDE * DEG_TO_RAD;
+        const double deltaLambda = (KAABA_LONGITUDE - longitude) * DEG_TO_RAD;
+
+        const double y = sin(deltaLambda) * cos(phi2);
+        const double x = cos(phi1) * sin(phi2) - sin(phi1) * cos(phi2) * cos(deltaLambda);
+        double bearing = atan2(y, x) * RAD_TO_DEG;
+        if (bearing < 0)
+            bearing += 360;
+
+        const double halfDeltaPhi = sin((phi2 - phi1) / 2);
+        const double halfDeltaLambda = sin(deltaLambda / 2);
+        const double a = halfDeltaPhi * halfDeltaPhi + cos(phi1) * cos(phi2) * halfDeltaLambda * halfDeltaLambda;
+        const double distance = 2 * EARTH_RADIUS_KM * atan2(sqrt(a), sqrt(1 - a));
+        return {bearing, distance};
+    }
+
+    // Whole degrees, 0-359
+    constexpr uint16_t roundedDegrees(double bearing)
+    {
+        return (uint16_t)((uint32_t)(bearing + 0.5) % 360);
+    }
+
+    // 8-point compass name, e.g. "Güneydoğu"
+    constexpr const char *direction(double bearing)
+    {
+        return LocaleTR::COMPASS_POINTS[(uint32_t)((bearing + 22.5) / 45.0) % 8];
+    }
+
+    // Turkish number style: "3.182 km" (thousands dot); below 10 km one
+    // decimal with a comma, "4,2 km"
+    constexpr std::array<char, 16> formatDistance(double km)
+    {
+        std::array<char, 16> out{};
+        char digits[12] = {};
+        int n = 0;
+        const bool decimal = km * 10 + 0.5 < 100; // 9.97 rounds to "10 km", not "10,0 km"
+        uint32_t value = (uint32_t)((decimal ? km * 10 : km) + 0.5);
+        do
+        {
+            digits[n++] = (char)('0' + value % 10);
+            value /= 10;
+        } while (value > 0 && n < 11);
+        if (decimal && n < 2)
+            digits[n++] = '0'; // "0,4"
+
+        size_t pos = 0;
+        for (int i = n - 1; i >= 0; i--)
+        {
+            out[pos++] = digits[i];
+            if (decimal && i == 1)
+                out[pos++] = ',';
+            else if (!decimal && i > 0 && i % 3 == 0)
+                out[pos++] = '.';
+        }
+        out[pos++] = ' ';
+        out[pos++] = 'k';
+        out[pos++] = 'm';
+        return out;
+    }
+
+    // Device side (qibla.cpp) ─────────────────────────────────────────────
+
+    // Recompute and publish to AppState if the location changed; no-op otherwise
+    void update(double latitude, double longitude);
+}
@@ -0,0 +1,323 @@
+#pragma once
+#include "civil_date.h"
+#include "hijri_date.h"
+#include <cstdint>
+
+// Religious calendar: Hijri month boundaries and the notable days observed
+// in Turkey, precomputed once per Gregorian year into two small sorted
+// tables. "Which Hijri date / special day is today" and "days until the
+// next event" are then binary searches instead of a tabular conversion
+// every minute. Month starts can be moved ±1 day to follow Diyanet's
+// announcements (moon sighting) without a firmware change.
+namespace ReligiousCalendar
+{
+    enum class Event : uint8_t
+    {
+        NONE,
+        HIJRI_NEW_YEAR,  // 1 Muharrem
+        ASURE,           // 10 Muharrem
+        MEVLID_KANDILI,  // night before 12 Rebiülevvel
+        REGAIP_KANDILI,  // night before the first Friday of Recep
+        MIRAC_KANDILI,   // night before 27 Recep
+        BERAT_KANDILI,   // night before 15 Şaban
+        RAMAZAN_START,   // 1 Ramazan
+        KADIR_GECESI,    // night before 27 Ramazan
+        RAMAZAN_AREFE,   // last day of Ramazan
+        RAMAZAN_BAYRAMI, // 1-3 Şevval
+        KURBAN_AREFE,    // 9 Zilhicce
+        KURBAN_BAYRAMI,  // 10-13 Zilhicce
+    };
+
+    // Indexed by Event; kandil nights are listed on the day whose evening they fall on
+    constexpr const char *EVENT_NAMES[] = {
+        "",
+        "Hicri Y\xC4\xB1lba\xC5\x9F\xC4\xB1",        // Hicri Yılbaşı
+        "A\xC5\x9Fure G\xC3\xBCn\xC3\xBC",           // Aşure Günü
+        "Mevlid Kandili",
+        "Regaip Kandili",
+        "Mira\xC3\xA7 Kandili",                      // Miraç Kandili
+        "Berat Kandili",
+        "Ramazan Ba\xC5\x9Flang\xC4\xB1" "c\xC4\xB1",   // Ramazan Başlangıcı
+        "Kadir Gecesi",
+        "Ramazan Arefesi",
+        "Ramazan Bayram\xC4\xB1",                    // Ramazan Bayramı
+        "Kurban Arefesi",
+        "Kurban Bayram\xC4\xB1",                     // Kurban Bayramı
+    };
+
+    inline const char *eventName(Event event)
+    {
+        const unsigned index = (unsigned)event;
+        return index < sizeof(EVENT_NAMES) / sizeof(EVENT_NAMES[0]) ? EVENT_NAMES[index] : "";
+    }
+
+    // Month start moved by `days` (-1, 0, +1) relative to the tabular calendar
+    struct Adjustment
+    {
+        int16_t year;  // Hijri year, e.g. 1447
+        uint8_t month; // 1-12
+        int8_t days;
+    };
+
+    struct MonthStart
+    {
+        int32_t day; // days since 1970-01-01 of the 1st
+        int16_t year;
+        uint8_t month;
+        uint8_t length; // 29 or 30 (28-31 with adjustments)
+    };
+
+    struct Entry
+    {
+        int32_t day;
+        Event event;
+        uint8_t ordinal; // day of a multi-day event (bayram 1-4), otherwise 1
+    };
+
+    // Everything the display needs about one day
+    struct DayInfo
+    {
+        HijriDate hijri;
+        uint8_t monthLength;
+        Event special;   // NONE on ordinary days
+        uint8_t ordinal; // day of `special`
+        Event next;      // next event starting after today, NONE past the table
+        int16_t daysToNext;
+    };
+
+    constexpr int MAX_ADJUSTMENTS = 12;
+    constexpr int MAX_MONTHS = 22;      // a Gregorian year plus the lookahead
+    constexpr int MAX_ENTRIES = 48;     // 17 per Hijri year
+    constexpr int LOOKAHEAD_DAYS = 150; // longest gap between events is Mevlid → Regaip (~115 days)
+
+    // 0 = Sunday; 1970-01-01 was a Thursday
+    constexpr int weekday(int32_t day)
+    {
+        return (int)((day % 7 + 11) % 7);
+    }
+
+    inline HijriDate tabularHijri(int32_t day)
+    {
+        const CivilDate::Date date = CivilDate::civilFromDays(day);
+        return gregorianToHijri(date.year, date.month, date.day);
+    }
+
+    // Length (29 or 30) of the tabular month containing `day`
+    inline uint8_t tabularMonthLength(int32_t day)
+    {
+        const int32_t start = day - tabularHijri(day).day + 1;
+        return tabularHijri(start + 29).day == 1 ? 29 : 30;
+    }
+
+    class Table
+    {
+    public:
+        // Months overlapping Gregorian `year` plus LOOKAHEAD_DAYS, with
+        // `adjustments` applied to the matching month starts
+        bool build(int year, const Adjustment *adjustments = nullptr, int adjustmentCount = 0)
+        {
+            *this = Table{};
+            const int32_t first = CivilDate::daysFromCivil(year, 1, 1);
+            const int32_t last = CivilDate::daysFromCivil(year, 12, 31) + LOOKAHEAD_DAYS;
+
+            // Tabular starts from a month before Jan 1 until one past the
+            // lookahead, so an adjusted start never leaves either end uncovered
+            int32_t starts[MAX_MONTHS + 1];
+            int16_t years[MAX_MONTHS + 1];
+            uint8_t months[MAX_MONTHS + 1];
+            const HijriDate h = tabularHijri(first - 30);
+            int32_t start = first - 30 - h.day + 1;
+            int16_t hYear = (int16_t)h.year;
+            uint8_t hMonth = h.month;
+            int n = 0;
+            while (n <= MAX_MONTHS)
+            {
+                starts[n] = start + adjustmentFor(hYear, hMonth, adjustments, adjustmentCount);
+                years[n] = hYear;
+                months[n] = hMonth;
+                n++;
+                if (start > last + 1)
+                    break;
+                start += tabularMonthLength(start);
+                if (++hMonth > 12)
+                {
+                    hMonth = 1;
+                    hYear++;
+                }
+            }
+            if (n > MAX_MONTHS)
+                return false;
+
+            for (int i = 0; i + 1 < n; i++)
+            {
+                const int32_t length = starts[i + 1] - starts[i];
+                if (length < 27 || length > 31)
+                    return false;
+                m_months[m_monthCount++] = {starts[i], years[i], months[i], (uint8_t)length};
+                addEvents(m_months[m_monthCount - 1]);
+            }
+
+            m_year = (int16_t)year;
+            return m_monthCount > 0 && !m_overflow;
+        }
+
+        int year() const { return m_year; }
+        bool covers(int32_t day) const
+        {
+            return m_monthCount > 0 && day >= m_months[0].day &&
+                   day < m_months[m_monthCount - 1].day + m_months[m_monthCount - 1].length;
+        }
+
+        const MonthStart *months() const { return m_months; }
+        int monthCount() const { return m_monthCount; }
+        const Entry *entries() const { return m_entries; }
+        int entryCount() const { return m_entryCount; }
+
+        // Hijri month containing `day`, nullptr outside the table
+        const MonthStart *monthOf(int32_t day) const
+        {
+            if (!covers(day))
+                return nullptr;
+            int lo = 0, hi = m_monthCount; // last month starting on or before `day`
+            while (hi - lo > 1)
+            {
+                const int mid = (lo + hi) / 2;
+                (m_months[mid].day <= day ? lo : hi) = mid;
+            }
+            return &m_months[lo];
+        }
+
+        // Entry on `day`, nullptr on ordinary days
+        const Entry *specialDay(int32_t day) const
+        {
+            const int i = firstAfter(day - 1);
+            return i < m_entryCount && m_entries[i].day == day ? &m_entries[i] : nullptr;
+        }
+
+        // First event that starts after `day` (a bayram's later days are skipped)
+        const Entry *nextEvent(int32_t day) const
+        {
+            for (int i = firstAfter(day); i < m_entryCount; i++)
+            {
+                if (m_entries[i].ordinal == 1)
+                    return &m_entries[i];
+            }
+            return nullptr;
+        }
+
+        bool describe(int32_t day, DayInfo &info) const
+        {
+            const MonthStart *month = monthOf(day);
+            if (!month)
+                return false;
+            info.hijri = {month->year, month->month, (uint8_t)(day - month->day + 1)};
+            info.monthLength = month->length;
+            const Entry *special = specialDay(day);
+            info.special = special ? special->event : Event::NONE;
+            info.ordinal = special ? special->ordinal : 0;
+            const Entry *next = nextEvent(day);
+            info.next = next ? next->event : Event::NONE;
+            info.daysToNext = next ? (int16_t)(next->day - day) : -1;
+            return true;
+        }
+
+    private:
+        MonthStart m_months[MAX_MONTHS] = {};
+        Entry m_entries[MAX_ENTRIES] = {};
+        uint8_t m_monthCount = 0;
+        uint8_t m_entryCount = 0;
+        bool m_overflow = false;
+        int16_t m_year = 0;
+
+        static int8_t adjustmentFor(int year, int month, const Adjustment *adjustments, int count)
+        {
+            for (int i = 0; adjustments && i < count; i++)
+            {
+                if (adjustments[i].year == year && adjustments[i].month == month)
+                    return adjustments[i].days < -1 ? -1 : (adjustments[i].days > 1 ? 1 : adjustments[i].days);
+            }
+            return 0;
+        }
+
+        // Index of the first entry with day > `day`
+        int firstAfter(int32_t day) const
+        {
+            int lo = 0, hi = m_entryCount;
+            while (lo < hi)
+            {
+                const int mid = (lo + hi) / 2;
+                if (m_entries[mid].day <= day)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+
+        void add(int32_t day, Event event, uint8_t ordinal = 1)
+        {
+            if (m_entryCount >= MAX_ENTRIES)
+            {
+                m_overflow = true;
+                return;
+            }
+            m_entries[m_entryCount++] = {day, event, ordinal};
+        }
+
+        // Months are visited in order and each month's events are added in
+        // order, so the entry table comes out sorted
+        void addEvents(const MonthStart &m)
+        {
+            const int32_t d = m.day - 1; // d + n = n-th of the month
+            switch (m.month)
+            {
+            case 1:
+                add(d + 1, Event::HIJRI_NEW_YEAR);
+                add(d + 10, Event::ASURE);
+                break;
+            case 3:
+                add(d + 11, Event::MEVLID_KANDILI);
+                break;
+            case 7:
+            {
+                const int32_t firstFriday = m.day + (5 - weekday(m.day) + 7) % 7;
+                add(firstFriday - 1, Event::REGAIP_KANDILI);
+                add(d + 26, Event::MIRAC_KANDILI);
+                break;
+            }
+            case 8:
+                add(d + 14, Event::BERAT_KANDILI);
+                break;
+            case 9:
+                add(d + 1, Event::RAMAZAN_START);
+                add(d + 26, Event::KADIR_GECESI);
+                add(d + m.length, Event::RAMAZAN_AREFE);
+                break;
+            case 10:
+                for (uint8_t i = 1; i <= 3; i++)
+                    add(d + i, Event::RAMAZAN_BAYRAMI, i);
+                break;
+            case 12:
+                add(d + 9, Event::KURBAN_AREFE);
+                for (uint8_t i = 1; i <= 4; i++)
+                    add(d + 9 + i, Event::KURBAN_BAYRAMI, i);
+                break;
+            default:
+                break;
+            }
+        }
+    };
+
+    // Device side (religious_calendar.cpp) ───────────────────────────────────
+
+    // Describe local day `day` (days since 1970-01-01). Builds the table for
+    // the day's year on first use and again after a year change or
+    // invalidate(); false if the table cannot cover it.
+    bool describe(int32_t day, DayInfo &info);
+
+    // Table for the current year (building it if needed), nullptr before the clock is set
+    const Table *current();
+
+    // Drop the table, e.g. after the adjustments changed
+    void invalidate();
+}
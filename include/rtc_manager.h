@@ -16,9 +16,8 @@ namespace RtcManager
     bool isAvailable();
     bool hasValidTime();
     void markNtpSync();
-    bool periodicSyncTick();
-    void correctDriftFromRTC();
-    void resetSyncTimer();
+    unsigned long msUntilSync(); // 0 = NTP sync is due
+    void resetSyncTimer();       // re-arms Scheduler NTP_SYNC and RTC_DRIFT
     void postponeSync(unsigned long ms);
 
     void setAlarm(uint8_t hour, uint8_t minute, uint8_t second);
@@ -0,0 +1,174 @@
+#pragma once
+#include <cstdint>
+#include <ctime>
+
+// Deadline scheduler for the main loop. Each module registers one handler
+// per task and arms it with an absolute deadline: wall clock for "next
+// second / next prayer", monotonic for "NTP interval / dim timeout".
+// loop() runs whatever is due and then sleeps until the earliest deadline,
+// a notify() from another task or the caller's polling cap, instead of
+// asking every module "anything to do?" every 5 ms.
+namespace Scheduler
+{
+    enum class Task : uint8_t
+    {
+        CLOCK,      // DisplayTicker: next second (screen on) or next minute
+        PRAYER,     // PrayerEngine: countdown second, next prayer or midnight rollover
+        PRAYER_DAY, // PrayerEngine: prepare the day after tomorrow ahead of the rollover
+        POWER,      // PowerManager: dim / screen-off timeout
+        NTP_SYNC,   // periodic NTP sync (RtcManager interval)
+        RTC_DRIFT,  // RTC drift check
+        STATUS_LOG, // heap / WiFi / wakeup summary
+        COUNT
+    };
+
+    constexpr uint8_t TASK_COUNT = static_cast<uint8_t>(Task::COUNT);
+
+    // Binary min-heap of deadlines with one slot per id: re-arming an id
+    // moves it (O(log n)), so an id is never pending twice.
+    template <uint8_t N>
+    class DeadlineQueue
+    {
+    public:
+        static constexpr uint8_t NONE = 0xFF;
+
+        DeadlineQueue()
+        {
+            for (uint8_t i = 0; i < N; i++)
+                m_pos[i] = NONE;
+        }
+
+        void schedule(uint8_t id, uint64_t deadline)
+        {
+            if (id >= N)
+                return;
+            if (m_pos[id] == NONE)
+            {
+                m_pos[id] = m_size;
+                m_heap[m_size++] = id;
+                m_deadline[id] = deadline;
+                siftUp(m_pos[id]);
+                return;
+            }
+            const bool earlier = deadline < m_deadline[id];
+            m_deadline[id] = deadline;
+            if (earlier)
+                siftUp(m_pos[id]);
+            else
+                siftDown(m_pos[id]);
+        }
+
+        void cancel(uint8_t id)
+        {
+            if (id >= N || m_pos[id] == NONE)
+                return;
+            const uint8_t pos = m_pos[id];
+            m_pos[id] = NONE;
+            if (--m_size == pos)
+                return;
+            const uint8_t moved = m_heap[m_size];
+            m_heap[pos] = moved;
+            m_pos[moved] = pos;
+            siftUp(pos);
+            siftDown(m_pos[moved]);
+        }
+
+        bool pending(uint8_t id) const { return id < N && m_pos[id] != NONE; }
+        bool empty() const { return m_size == 0; }
+        uint8_t size() const { return m_size; }
+        uint64_t deadline(uint8_t id) const { return m_deadline[id]; }
+
+        // Earliest deadline; only meaningful when !empty()
+        uint64_t earliest() const { return m_deadline[m_heap[0]]; }
+
+        // Remove and return the earliest id due at `now`, NONE if nothing is
+        uint8_t popDue(uint64_t now)
+        {
+            if (m_size == 0 || m_deadline[m_heap[0]] > now)
+                return NONE;
+            const uint8_t id = m_heap[0];
+            cancel(id);
+            return id;
+        }
+
+    private:
+        uint64_t m_deadline[N] = {};
+        uint8_t m_heap[N] = {}; // ids, heap-ordered by deadline
+        uint8_t m_pos[N];       // index of each id in m_heap, NONE if not pending
+        uint8_t m_size = 0;
+
+        void swap(uint8_t a, uint8_t b)
+        {
+            const uint8_t t = m_heap[a];
+            m_heap[a] = m_heap[b];
+            m_heap[b] = t;
+            m_pos[m_heap[a]] = a;
+            m_pos[m_heap[b]] = b;
+        }
+
+        void siftUp(uint8_t i)
+        {
+            while (i > 0)
+            {
+                const uint8_t parent = (i - 1) / 2;
+                if (m_deadline[m_heap[parent]] <= m_deadline[m_heap[i]])
+                    return;
+                swap(i, parent);
+                i = parent;
+            }
+        }
+
+        void siftDown(uint8_t i)
+        {
+            for (;;)
+            {
+                const uint8_t left = 2 * i + 1, right = left + 1;
+                uint8_t smallest = i;
+                if (left < m_size && m_deadline[m_heap[left]] < m_deadline[m_heap[smallest]])
+                    smallest = left;
+                if (right < m_size && m_deadline[m_heap[right]] < m_deadline[m_heap[smallest]])
+                    smallest = right;
+                if (smallest == i)
+                    return;
+                swap(i, smallest);
+                i = smallest;
+            }
+        }
+    };
+
+    // Device side (scheduler.cpp) ─────────────────────────────────────────
+    // Everything but clockChanged()/notify() is for the loop task only.
+
+    using Handler = void (*)();
+
+    // Remember the loop task so other tasks can wake it; call first in setup()
+    void init();
+
+    void on(Task task, Handler handler);
+
+    // Wall-clock deadline; re-fired at once when the clock is stepped
+    void at(Task task, time_t epoch);
+
+    // Monotonic deadline, `ms` from now (0 = next loop pass)
+    void after(Task task, uint32_t ms);
+
+    void cancel(Task task);
+
+    // System time was stepped (NTP, RTC, manual): wall-clock tasks run now
+    void clockChanged();
+
+    // Wake loop() from another task (audio, network callbacks)
+    void notify();
+
+    // Run every handler that is due
+    void run();
+
+    // Time to the earliest deadline, at most `maxMs` (0 = something is due)
+    uint32_t msUntilNext(uint32_t maxMs);
+
+    // Sleep until the next deadline, a notify(), or `maxMs`
+    void wait(uint32_t maxMs);
+
+    // Loop wakeups since the last call (for the status log)
+    uint32_t takeWakeupCount();
+}
@@ -3,6 +3,11 @@
 #include "prayer_types.h"
 #include <cstdint>
 
+namespace ReligiousCalendar
+{
+    struct Adjustment;
+}
+
 enum class PowerMode : uint8_t
 {
     ALWAYS_ON = 0,
@@ -76,4 +81,24 @@ namespace SettingsManager
     // --- Timezone ---
     const char *getTimezone();
     bool setTimezone(const char *posixTz);
+
+    // --- Saved Locations ("world cities": family abroad, etc.) ---
+    constexpr int MAX_SAVED_LOCATIONS = 8;
+
+    struct SavedLocation
+    {
+        char name[32];
+        float latitude;
+        float longitude;
+        char timezone[48]; // POSIX TZ of the location
+    };
+
+    // Points `locations` at the cached list; returns its length
+    int getSavedLocations(const SavedLocation *&locations);
+    bool setSavedLocations(const SavedLocation *locations, int count);
+
+    // --- Hijri month adjustments (follow Diyanet's announced month starts) ---
+    // Points `adjustments` at the cached list; returns its length
+    int getHijriAdjustments(const ReligiousCalendar::Adjustment *&adjustments);
+    bool setHijriAdjustments(const ReligiousCalendar::Adjustment *adjustments, int count);
 }
@@ -0,0 +1,418 @@
+/**
+ * @file solar_float.h
+ * @brief Single-precision solar position / hour-angle engine
+ *
+ * Same Meeus-based algorithm as the Adhan C library (astronomical.c,
+ * solar_coordinates.c, solar_time.c), written for the ESP32-S3 FPU, which
+ * only does float in hardware — every double there is software-emulated.
+ *
+ * Float-safe formulation:
+ *   - Time is counted in days from J2000.0 (d = n − 0.5 at 0h UT), never as a
+ *     full Julian day (2.46e6 has a 0.25-day float step).
+ *   - Mean longitudes and sidereal time grow ~1°/day. Their rates are split as
+ *     d·360k + d·r, where the first term reduces to an exact fmod. Only the
+ *     small remainder multiplies d in float, so each stays within ~1e-5°.
+ *
+ *   - Near the edge of twilight-all-night (|cos H0| → 1) the hour angle is
+ *     ill-conditioned: a 1e-7 rad wobble in declination moves Isha by minutes.
+ *     Below sin H0 = 0.03 the float instance redoes that one hour angle in
+ *     double (≈0.01% of days at |lat| ≤ 62°), which also keeps the "event
+ *     occurs" decision identical to the library.
+ *
+ * SolarDay holds the date terms; the batch functions at the end evaluate
+ * many locations for one date from a single SolarDay (structure-of-arrays).
+ *
+ * Header-only and free of Arduino/Adhan types so the native accuracy harness
+ * (test/test_calc) can compile the float and double instances side by side.
+ * Hour results are UTC hours from the date's 0h; NaN = event does not occur.
+ */
+
+#ifndef SOLAR_FLOAT_H
+#define SOLAR_FLOAT_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace SolarFloat
+{
+    template <typename Real>
+    struct SolarCoordinates
+    {
+        Real declination;          // degrees
+        Real rightAscension;       // degrees, [0, 360)
+        Real apparentSiderealTime; // degrees
+    };
+
+    // Solar coordinates of day n and its neighbours: everything about the
+    // sun that depends only on the date, shared by any number of locations
+    template <typename Real>
+    struct SolarDay
+    {
+        explicit SolarDay(int32_t dayNumber);
+        SolarDay(int year, int month, int day);
+
+        int32_t dayNumber;
+        SolarCoordinates<Real> prev, solar, next;
+    };
+
+    template <typename Real>
+    class SolarTime
+    {
+    public:
+        SolarTime(int year, int month, int day, Real latitude, Real longitude);
+        SolarTime(const SolarDay<Real> &day, Real latitude, Real longitude);
+
+        Real transit;
+        Real sunrise;
+        Real sunset;
+
+        // Time the sun crosses `angle` degrees altitude (negative = below horizon)
+        Real hourAngle(Real angle, bool afterTransit) const;
+
+        // Asr: shadow = shadowLength × object height (1 Shafi, 2 Hanafi)
+        Real afternoon(Real shadowLength) const;
+
+    private:
+        SolarDay<Real> day;
+        Real latitude;
+        Real longitude;
+        Real approxTransit;
+    };
+
+    // ── Helpers ─────────────────────────────────────────────────────
+
+    template <typename Real>
+    constexpr Real kDegToRad = Real(3.14159265358979323846 / 180.0);
+    template <typename Real>
+    constexpr Real kRadToDeg = Real(180.0 / 3.14159265358979323846);
+
+    template <typename Real>
+    inline Real normalizeWithBound(Real value, Real max)
+    {
+        return value - max * std::floor(value / max);
+    }
+
+    template <typename Real>
+    inline Real unwindAngle(Real value)
+    {
+        return normalizeWithBound(value, Real(360));
+    }
+
+    template <typename Real>
+    inline Real closestAngle(Real angle)
+    {
+        if (angle >= Real(-180) && angle <= Real(180))
+            return angle;
+        return angle - Real(360) * std::round(angle / Real(360));
+    }
+
+    // Days from J2000.0 to 0h UT of the date, plus 0.5 (integer). Same
+    // Julian-day formula as the library, in exact integer arithmetic.
+    inline int32_t j2000DayNumber(int year, int month, int day)
+    {
+        const int y = month > 2 ? year : year - 1;
+        const int m = month > 2 ? month : month + 12;
+        const int a = y / 100;
+        const int b = 2 - a + a / 4;
+        const int32_t i0 = (int32_t)((1461L * (y + 4716)) / 4);   // (int)(365.25 × (Y + 4716))
+        const int32_t i1 = (int32_t)((306001L * (m + 1)) / 10000); // (int)(30.6001 × (M + 1))
+        return i0 + i1 + day + b - 1524 - 2451545;
+    }
+
+    // rate × d (mod 360) for a rate of `whole` + `frac` degrees/day:
+    // fmod(whole × d) is exact in float for |d| < 2^15, only frac × d rounds.
+    template <typename Real>
+    inline Real dailyTerm(Real d, Real whole, Real frac)
+    {
+        return std::fmod(whole * d, Real(360)) + frac * d;
+    }
+
+    template <typename Real>
+    inline Real interpolate(Real y2, Real y1, Real y3, Real n)
+    {
+        const Real a = y2 - y1;
+        const Real b = y3 - y2;
+        const Real c = b - a;
+        return y2 + (n / Real(2)) * (a + b + n * c);
+    }
+
+    template <typename Real>
+    inline Real interpolateAngles(Real y2, Real y1, Real y3, Real n)
+    {
+        const Real a = unwindAngle(y2 - y1);
+        const Real b = unwindAngle(y3 - y2);
+        const Real c = b - a;
+        return y2 + (n / Real(2)) * (a + b + n * c);
+    }
+
+    template <typename Real>
+    inline Real altitudeOfCelestialBody(Real phi, Real delta, Real h)
+    {
+        const Real term1 = std::sin(phi * kDegToRad<Real>) * std::sin(delta * kDegToRad<Real>);
+        const Real term2 = std::cos(phi * kDegToRad<Real>) * std::cos(delta * kDegToRad<Real>) *
+                           std::cos(h * kDegToRad<Real>);
+        return std::asin(term1 + term2) * kRadToDeg<Real>;
+    }
+
+    // ── Solar coordinates for 0h UT of day n (d = n − 0.5) ──────────
+
+    template <typename Real>
+    inline SolarCoordinates<Real> solarCoordinates(int32_t n)
+    {
+        const Real d = Real(n) - Real(0.5);
+        const Real T = d / Real(36525);
+        const Real T2 = T * T;
+        const Real T3 = T2 * T;
+
+        // 36000.76983°/century = 0.98564736°/day
+        const Real L0 = unwindAngle(Real(280.4664567) + dailyTerm(d, Real(1), Real(36000.76983 / 36525.0 - 1.0)) +
+                                    Real(0.0003032) * T2);
+        // 481267.8813°/century = 13.17639648°/day
+        const Real Lp = unwindAngle(Real(218.3165) + dailyTerm(d, Real(13), Real(481267.8813 / 36525.0 - 13.0)));
+        const Real omega = unwindAngle(Real(125.04452) - Real(1934.136261 / 36525.0) * d + Real(0.0020708) * T2 +
+                                       T3 / Real(450000));
+        // 35999.05029°/century = 0.98560028°/day
+        const Real M = unwindAngle(Real(357.52911) + dailyTerm(d, Real(1), Real(35999.05029 / 36525.0 - 1.0)) -
+                                   Real(0.0001537) * T2);
+
+        // Equation of the centre → apparent longitude
+        const Real Mrad = M * kDegToRad<Real>;
+        const Real C = (Real(1.914602) - Real(0.004817) * T - Real(0.000014) * T2) * std::sin(Mrad) +
+                       (Real(0.019993) - Real(0.000101) * T) * std::sin(Real(2) * Mrad) +
+                       Real(0.000289) * std::sin(Real(3) * Mrad);
+        const Real omega2 = Real(125.04) - Real(1934.136 / 36525.0) * d;
+        const Real lambda =
+            unwindAngle(L0 + C - Real(0.00569) - Real(0.00478) * std::sin(omega2 * kDegToRad<Real>)) *
+            kDegToRad<Real>;
+
+        // 360.98564736629°/day; with d = n − 0.5 the 360·d part is 180 (mod 360)
+        const Real theta0 = unwindAngle(Real(280.46061837) + Real(180) +
+                                        dailyTerm(d, Real(1), Real(0.98564736629 - 1.0)) +
+                                        Real(0.000387933) * T2 - T3 / Real(38710000));
+
+        const Real omegaRad = omega * kDegToRad<Real>;
+        const Real L0rad = L0 * kDegToRad<Real>;
+        const Real Lprad = Lp * kDegToRad<Real>;
+        const Real dPsi = Real(-17.2 / 3600) * std::sin(omegaRad) - Real(1.32 / 3600) * std::sin(Real(2) * L0rad) -
+                          Real(0.23 / 3600) * std::sin(Real(2) * Lprad) +
+                          Real(0.21 / 3600) * std::sin(Real(2) * omegaRad);
+        const Real dEps = Real(9.2 / 3600) * std::cos(omegaRad) + Real(0.57 / 3600) * std::cos(Real(2) * L0rad) +
+                          Real(0.10 / 3600) * std::cos(Real(2) * Lprad) -
+                          Real(0.09 / 3600) * std::cos(Real(2) * omegaRad);
+
+        const Real eps0 = Real(23.439291) - Real(0.013004167) * T - Real(0.0000001639) * T2 +
+                          Real(0.0000005036) * T3;
+        const Real epsApp = (eps0 + Real(0.00256) * std::cos(omega2 * kDegToRad<Real>)) * kDegToRad<Real>;
+
+        SolarCoordinates<Real> sc;
+        sc.declination = std::asin(std::sin(epsApp) * std::sin(lambda)) * kRadToDeg<Real>;
+        sc.rightAscension =
+            unwindAngle(std::atan2(std::cos(epsApp) * std::sin(lambda), std::cos(lambda)) * kRadToDeg<Real>);
+        sc.apparentSiderealTime = theta0 + dPsi * std::cos((eps0 + dEps) * kDegToRad<Real>);
+        return sc;
+    }
+
+    // ── Per-location terms ─────────────────────────────────────────
+    // Plain functions of (day, latitude, longitude) so SolarTime and the
+    // batch loops below share one formulation.
+
+    // sin²(H0) below which float hands the hour angle to the double path
+    constexpr double kIllConditionedSin2 = 0.03 * 0.03;
+
+    template <typename Real>
+    SolarDay<Real>::SolarDay(int32_t n)
+        : dayNumber(n), prev(solarCoordinates<Real>(n - 1)), solar(solarCoordinates<Real>(n)),
+          next(solarCoordinates<Real>(n + 1))
+    {
+    }
+
+    template <typename Real>
+    SolarDay<Real>::SolarDay(int year, int month, int day) : SolarDay(j2000DayNumber(year, month, day))
+    {
+    }
+
+    template <typename Real>
+    inline Real approximateTransit(const SolarDay<Real> &day, Real longitude)
+    {
+        return normalizeWithBound((day.solar.rightAscension - longitude - day.solar.apparentSiderealTime) / Real(360),
+                                  Real(1));
+    }
+
+    template <typename Real>
+    inline Real correctedTransit(const SolarDay<Real> &day, Real longitude, Real approxTransit)
+    {
+        const Real theta = unwindAngle(day.solar.apparentSiderealTime + Real(360.985647) * approxTransit);
+        const Real alpha = unwindAngle(interpolateAngles(day.solar.rightAscension, day.prev.rightAscension,
+                                                         day.next.rightAscension, approxTransit));
+        const Real h = closestAngle(theta + longitude - alpha);
+        return (approxTransit - h / Real(360)) * Real(24);
+    }
+
+    // cos of the hour angle at which the sun stands at h0 (|x| > 1: never)
+    template <typename Real>
+    inline Real cosHourAngle(const SolarDay<Real> &day, Real latitude, Real h0)
+    {
+        const Real latRad = latitude * kDegToRad<Real>;
+        const Real decRad = day.solar.declination * kDegToRad<Real>;
+        const Real term1 = std::sin(h0 * kDegToRad<Real>) - std::sin(latRad) * std::sin(decRad);
+        const Real term2 = std::cos(latRad) * std::cos(decRad);
+        return term1 / term2;
+    }
+
+    template <typename Real>
+    inline bool isIllConditioned(Real cosH0)
+    {
+        return sizeof(Real) < sizeof(double) && Real(1) - cosH0 * cosH0 < Real(kIllConditionedSin2);
+    }
+
+    // Hour-angle event time from cos H0: interpolated coordinates + one correction step
+    template <typename Real>
+    inline Real refinedHourAngle(const SolarDay<Real> &day, Real latitude, Real longitude, Real approxTransit,
+                                 Real h0, bool afterTransit, Real cosH0)
+    {
+        const Real latRad = latitude * kDegToRad<Real>;
+        const Real H0 = std::acos(cosH0) * kRadToDeg<Real>; // NaN when the sun never gets there
+
+        const Real m = afterTransit ? approxTransit + H0 / Real(360) : approxTransit - H0 / Real(360);
+        const Real theta = unwindAngle(day.solar.apparentSiderealTime + Real(360.985647) * m);
+        const Real alpha = unwindAngle(
+            interpolateAngles(day.solar.rightAscension, day.prev.rightAscension, day.next.rightAscension, m));
+        const Real delta = interpolate(day.solar.declination, day.prev.declination, day.next.declination, m);
+        const Real H = theta + longitude - alpha;
+        const Real h = altitudeOfCelestialBody(latitude, delta, H);
+        const Real dm = (h - h0) / (Real(360) * std::cos(delta * kDegToRad<Real>) * std::cos(latRad) *
+                                    std::sin(H * kDegToRad<Real>));
+        return (m + dm) * Real(24);
+    }
+
+    // Event time for altitude h0; in float the ill-conditioned case is redone in double
+    template <typename Real>
+    inline Real hourAngleAt(const SolarDay<Real> &day, Real latitude, Real longitude, Real approxTransit, Real h0,
+                            bool afterTransit)
+    {
+        const Real cosH0 = cosHourAngle(day, latitude, h0);
+        if constexpr (sizeof(Real) < sizeof(double))
+        {
+            if (isIllConditioned(cosH0))
+            {
+                const SolarDay<double> exact(day.dayNumber);
+                return Real(hourAngleAt<double>(exact, latitude, longitude, approximateTransit<double>(exact, longitude),
+                                                h0, afterTransit));
+            }
+        }
+        return refinedHourAngle(day, latitude, longitude, approxTransit, h0, afterTransit, cosH0);
+    }
+
+    // Asr altitude: shadow = shadowLength × object height
+    template <typename Real>
+    inline Real afternoonAngle(const SolarDay<Real> &day, Real latitude, Real shadowLength)
+    {
+        const Real tangent = std::fabs(latitude - day.solar.declination);
+        const Real inverse = shadowLength + std::tan(tangent * kDegToRad<Real>);
+        return std::atan(Real(1) / inverse) * kRadToDeg<Real>;
+    }
+
+    // ── Solar time ─────────────────────────────────────────────────
+
+    template <typename Real>
+    SolarTime<Real>::SolarTime(int year, int month, int day, Real lat, Real lon)
+        : SolarTime(SolarDay<Real>(year, month, day), lat, lon)
+    {
+    }
+
+    template <typename Real>
+    SolarTime<Real>::SolarTime(const SolarDay<Real> &d, Real lat, Real lon)
+        : day(d), latitude(lat), longitude(lon), approxTransit(approximateTransit(d, lon))
+    {
+        transit = correctedTransit(day, longitude, approxTransit);
+
+        const Real solarAltitude = Real(-50.0 / 60.0);
+        sunrise = hourAngle(solarAltitude, false);
+        sunset = hourAngle(solarAltitude, true);
+    }
+
+    template <typename Real>
+    Real SolarTime<Real>::hourAngle(Real h0, bool afterTransit) const
+    {
+        return hourAngleAt(day, latitude, longitude, approxTransit, h0, afterTransit);
+    }
+
+    template <typename Real>
+    Real SolarTime<Real>::afternoon(Real shadowLength) const
+    {
+        return hourAngle(afternoonAngle(day, latitude, shadowLength), true);
+    }
+
+    // ── Batch: one date, many locations ────────────────────────────
+    // Structure-of-arrays in and out. The date terms (declination, right
+    // ascension, sidereal time) come from one SolarDay; each loop body is
+    // branch-free straight-line math over independent locations, so the
+    // compiler can unroll/vectorize it. Ill-conditioned float hour angles
+    // are only flagged in the loop and redone in double afterwards.
+
+    constexpr size_t kBatchTile = 16;
+
+    // Same angle for every location (e.g. sunrise, Fajr at −18°)
+    template <typename Real>
+    struct Uniform
+    {
+        Real value;
+        Real operator[](size_t) const { return value; }
+    };
+
+    template <typename Real>
+    void transits(const SolarDay<Real> &day, const Real *__restrict longitude, Real *__restrict approxTransit,
+                  Real *__restrict transit, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            approxTransit[i] = approximateTransit(day, longitude[i]);
+            transit[i] = correctedTransit(day, longitude[i], approxTransit[i]);
+        }
+    }
+
+    // `angles` is a Real array (one per location) or Uniform<Real>
+    template <typename Real, typename Angles>
+    void hourAngles(const SolarDay<Real> &day, const Real *__restrict latitude, const Real *__restrict longitude,
+                    const Real *__restrict approxTransit, const Angles &angles, bool afterTransit,
+                    Real *__restrict out, size_t count)
+    {
+        for (size_t base = 0; base < count; base += kBatchTile)
+        {
+            const size_t n = count - base < kBatchTile ? count - base : kBatchTile;
+            bool illConditioned[kBatchTile];
+            for (size_t k = 0; k < n; k++)
+            {
+                const size_t i = base + k;
+                const Real cosH0 = cosHourAngle(day, latitude[i], angles[i]);
+                illConditioned[k] = isIllConditioned(cosH0);
+                out[i] = refinedHourAngle(day, latitude[i], longitude[i], approxTransit[i], angles[i], afterTransit,
+                                          cosH0);
+            }
+            if constexpr (sizeof(Real) < sizeof(double))
+            {
+                for (size_t k = 0; k < n; k++)
+                {
+                    if (!illConditioned[k])
+                        continue;
+                    const size_t i = base + k;
+                    out[i] = hourAngleAt(day, latitude[i], longitude[i], approxTransit[i], angles[i], afterTransit);
+                }
+            }
+        }
+    }
+
+    template <typename Real>
+    void afternoonAngles(const SolarDay<Real> &day, const Real *__restrict latitude, Real shadowLength,
+                         Real *__restrict out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = afternoonAngle(day, latitude[i], shadowLength);
+    }
+
+    using SolarTimeF = SolarTime<float>;
+
+} // namespace SolarFloat
+
+#endif // SOLAR_FLOAT_H
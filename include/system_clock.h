@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <ctime>
+
+// Every clock read of the time-driven modules (PrayerEngine, DisplayTicker,
+// PowerManager, PrayerAPI, Scheduler, TimeZoneRules) goes through here.
+// The device build links system_clock.cpp (time(), gettimeofday,
+// esp_timer, getLocalTime); the host simulator links its own virtual
+// clock instead (sim/prayer/), so the same sources replay months of
+// time in seconds.
+namespace SystemClock
+{
+    // Wall clock, UTC seconds
+    time_t now();
+
+    // Wall clock, UTC microseconds
+    int64_t nowUs();
+
+    // Monotonic since boot; keeps counting through light sleep, not stepped by NTP/RTC
+    uint64_t monotonicUs();
+
+    inline uint64_t monotonicMs()
+    {
+        return monotonicUs() / 1000;
+    }
+
+    // millis() equivalent (wraps like it) for the unsigned-delta idiom
+    inline unsigned long uptimeMs()
+    {
+        return static_cast<unsigned long>(monotonicMs());
+    }
+
+    // Local broken-down time; waits up to `waitMs` for the clock to be set
+    // (getLocalTime semantics, same default), false if it never is
+    bool localTime(struct tm &out, uint32_t waitMs = 5000);
+}
@@ -8,6 +8,9 @@ namespace TestMode
     // Print 30 days of prayer times for manual comparison
     void print30DaysAdhanLibrary(int method, double lat, double lon);
 
+    // Time a full-year calculateRange() batch (prints ms total, us/day)
+    void benchmarkYear(int method, double lat, double lon);
+
     // Print today's prayer times in multiple methods
     void compareAllMethods(double lat, double lon);
 
@@ -0,0 +1,307 @@
+#pragma once
+#include "civil_date.h"
+#include <array>
+#include <cstdint>
+#include <ctime>
+
+// POSIX TZ rules ("CET-1CEST,M3.5.0,M10.5.0/3") parsed once, with the DST
+// transition instants of a few years precomputed, so local offsets and
+// local↔UTC conversions are a table lookup instead of a mktime/localtime
+// round trip that re-reads the TZ environment variable.
+namespace TimeZoneRules
+{
+    constexpr int32_t SECONDS_PER_DAY = 86400;
+    constexpr int TABLE_YEARS = 3; // prepared year - 1 … prepared year + 1
+
+    // One DST boundary: "Jn" (1-365, Feb 29 never counted), "n" (0-365),
+    // or "Mm.w.d" (weekday d of week w of month m, w = 5 → last), plus the
+    // local wall-clock time the switch happens at.
+    struct Rule
+    {
+        enum class Kind : uint8_t
+        {
+            Julian1,
+            Julian0,
+            MonthWeekDay,
+        };
+
+        Kind kind;
+        int16_t day; // Jn/n: day number; M: weekday, 0 = Sunday
+        int8_t month;
+        int8_t week;
+        int32_t time; // seconds after local midnight (may be < 0 or > 24 h)
+    };
+
+    constexpr bool isLeapYear(int year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    // Days since 1970-01-01 of the rule's date in `year`
+    constexpr int32_t ruleDay(const Rule &rule, int year)
+    {
+        const int32_t jan1 = CivilDate::daysFromCivil(year, 1, 1);
+        switch (rule.kind)
+        {
+        case Rule::Kind::Julian1:
+            return jan1 + rule.day - 1 + ((isLeapYear(year) && rule.day >= 60) ? 1 : 0);
+        case Rule::Kind::Julian0:
+            return jan1 + rule.day;
+        case Rule::Kind::MonthWeekDay:
+        default:
+        {
+            const int32_t first = CivilDate::daysFromCivil(year, rule.month, 1);
+            const int firstWeekday = (int)((first % 7 + 11) % 7); // 1970-01-01 was a Thursday
+            int32_t day = first + (rule.day - firstWeekday + 7) % 7 + (rule.week - 1) * 7;
+            const int32_t nextMonth = rule.month == 12 ? CivilDate::daysFromCivil(year + 1, 1, 1)
+                                                       : CivilDate::daysFromCivil(year, rule.month + 1, 1);
+            while (day >= nextMonth)
+                day -= 7;
+            return day;
+        }
+        }
+    }
+
+    constexpr int64_t floorDiv(int64_t a, int64_t b)
+    {
+        return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+    }
+
+    class Zone
+    {
+    public:
+        // Parse a POSIX TZ string. On failure the zone is UTC (as libc does).
+        bool parse(const char *posixTz)
+        {
+            *this = Zone{};
+            const char *p = posixTz;
+            int32_t posixOffset = 0;
+            if (!p || !parseName(p) || !parseOffset(p, 24, posixOffset))
+                return false;
+            const int32_t standard = -posixOffset; // POSIX offsets are west-positive
+
+            if (*p == '\0')
+            {
+                _standard = _daylight = standard;
+                return true;
+            }
+
+            if (!parseName(p))
+                return false;
+            int32_t daylight = standard + 3600;
+            if (*p != ',' && *p != '\0')
+            {
+                if (!parseOffset(p, 24, posixOffset))
+                    return false;
+                daylight = -posixOffset;
+            }
+
+            // No rules given: newlib's default (US) rules
+            Rule start = {Rule::Kind::MonthWeekDay, 0, 3, 2, 7200};
+            Rule end = {Rule::Kind::MonthWeekDay, 0, 11, 1, 7200};
+            if (*p == ',')
+            {
+                ++p;
+                if (!parseRule(p, start) || *p++ != ',' || !parseRule(p, end))
+                    return false;
+            }
+            if (*p != '\0')
+                return false;
+
+            _standard = standard;
+            _daylight = daylight;
+            _start = start;
+            _end = end;
+            _hasDst = true;
+            return true;
+        }
+
+        // Precompute transitions for year - 1 … year + 1. Other years still
+        // work (computed on the fly), just without the table.
+        void prepare(int year)
+        {
+            _firstYear = (int16_t)(year - 1);
+            for (int i = 0; i < TABLE_YEARS; i++)
+                transitionsFor(_firstYear + i, _transitions[i * 2], _transitions[i * 2 + 1]);
+        }
+
+        bool hasDst() const { return _hasDst; }
+        int16_t preparedYear() const { return (int16_t)(_firstYear + 1); }
+
+        // Seconds east of UTC in effect at `utc`
+        int32_t localOffsetAt(time_t utc) const
+        {
+            if (!_hasDst)
+                return _standard;
+
+            const int year = CivilDate::civilFromDays(
+                                 (int32_t)floorDiv((int64_t)utc + _standard, SECONDS_PER_DAY))
+                                 .year;
+            int64_t start, end;
+            const int slot = year - _firstYear;
+            if (_firstYear != 0 && slot >= 0 && slot < TABLE_YEARS)
+            {
+                start = _transitions[slot * 2];
+                end = _transitions[slot * 2 + 1];
+            }
+            else
+            {
+                transitionsFor(year, start, end);
+            }
+
+            // Southern hemisphere: DST spans the new year (end before start)
+            const bool dst = start < end ? (utc >= start && utc < end) : !(utc >= end && utc < start);
+            return dst ? _daylight : _standard;
+        }
+
+        time_t toLocal(time_t utc) const
+        {
+            return utc + localOffsetAt(utc);
+        }
+
+        // Local wall-clock seconds → UTC. In the repeated hour the first
+        // occurrence wins; a time inside the spring-forward gap is read as
+        // standard time (lands after the jump, like mktime).
+        time_t fromLocal(time_t local) const
+        {
+            const time_t asStandard = local - _standard;
+            if (!_hasDst)
+                return asStandard;
+            const time_t asDaylight = local - _daylight;
+            const bool standardOk = localOffsetAt(asStandard) == _standard;
+            const bool daylightOk = localOffsetAt(asDaylight) == _daylight;
+            if (standardOk && daylightOk)
+                return asStandard < asDaylight ? asStandard : asDaylight;
+            return daylightOk ? asDaylight : asStandard;
+        }
+
+        CivilDate::Date localDate(time_t utc) const
+        {
+            return CivilDate::civilFromDays((int32_t)floorDiv((int64_t)toLocal(utc), SECONDS_PER_DAY));
+        }
+
+        // UTC instant of local 00:00 on `date`
+        time_t localMidnight(const CivilDate::Date &date) const
+        {
+            return fromLocal((time_t)CivilDate::daysFromCivil(date) * SECONDS_PER_DAY);
+        }
+
+    private:
+        int32_t _standard = 0; // seconds east of UTC
+        int32_t _daylight = 0;
+        bool _hasDst = false;
+        Rule _start = {};
+        Rule _end = {};
+        int16_t _firstYear = 0; // 0 = not prepared
+        std::array<int64_t, TABLE_YEARS * 2> _transitions = {}; // UTC: DST start, DST end per year
+
+        void transitionsFor(int year, int64_t &start, int64_t &end) const
+        {
+            // Start is given in standard wall time, end in daylight wall time
+            start = (int64_t)ruleDay(_start, year) * SECONDS_PER_DAY + _start.time - _standard;
+            end = (int64_t)ruleDay(_end, year) * SECONDS_PER_DAY + _end.time - _daylight;
+        }
+
+        static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+        static bool isAlpha(char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'); }
+
+        static bool parseNumber(const char *&p, int maxValue, int &value)
+        {
+            if (!isDigit(*p))
+                return false;
+            value = 0;
+            while (isDigit(*p))
+            {
+                value = value * 10 + (*p++ - '0');
+                if (value > maxValue)
+                    return false;
+            }
+            return true;
+        }
+
+        // "CET" or "<+03>"
+        static bool parseName(const char *&p)
+        {
+            const char *begin = p;
+            if (*p == '<')
+            {
+                while (*p && *p != '>')
+                    ++p;
+                if (*p != '>' || p - begin < 4)
+                    return false;
+                ++p;
+                return true;
+            }
+            while (isAlpha(*p))
+                ++p;
+            return p - begin >= 3;
+        }
+
+        // [+-]hh[:mm[:ss]] in seconds
+        static bool parseOffset(const char *&p, int maxHours, int32_t &seconds)
+        {
+            int sign = 1;
+            if (*p == '+' || *p == '-')
+                sign = (*p++ == '-') ? -1 : 1;
+            int h = 0, m = 0, s = 0;
+            if (!parseNumber(p, maxHours, h))
+                return false;
+            if (*p == ':')
+            {
+                ++p;
+                if (!parseNumber(p, 59, m))
+                    return false;
+                if (*p == ':')
+                {
+                    ++p;
+                    if (!parseNumber(p, 59, s))
+                        return false;
+                }
+            }
+            seconds = sign * (h * 3600 + m * 60 + s);
+            return true;
+        }
+
+        static bool parseRule(const char *&p, Rule &rule)
+        {
+            int a = 0, b = 0, c = 0;
+            if (*p == 'J')
+            {
+                ++p;
+                if (!parseNumber(p, 365, a) || a < 1)
+                    return false;
+                rule = {Rule::Kind::Julian1, (int16_t)a, 0, 0, 7200};
+            }
+            else if (*p == 'M')
+            {
+                ++p;
+                if (!parseNumber(p, 12, a) || a < 1 || *p++ != '.' || !parseNumber(p, 5, b) || b < 1 ||
+                    *p++ != '.' || !parseNumber(p, 6, c))
+                    return false;
+                rule = {Rule::Kind::MonthWeekDay, (int16_t)c, (int8_t)a, (int8_t)b, 7200};
+            }
+            else
+            {
+                if (!parseNumber(p, 365, a))
+                    return false;
+                rule = {Rule::Kind::Julian0, (int16_t)a, 0, 0, 7200};
+            }
+
+            if (*p == '/')
+            {
+                ++p;
+                if (!parseOffset(p, 167, rule.time))
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    // Device side (time_zone_rules.cpp) ─────────────────────────────────────
+
+    // Rules for SettingsManager::getTimezone(); re-parsed only when it changes
+    const Zone &current();
+
+    // Today's local date; false while the clock has not been set
+    bool localToday(CivilDate::Date &date);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file ui_digit_atlas.h
+ * @brief Pre-rasterized digit sprites for the big mono readouts
+ *
+ * The countdown (FONT_MONO_60) and clock (FONT_CLOCK_72) change every second.
+ * As labels, each change re-decodes 4bpp glyphs and re-blends them over the
+ * background and the countdown's shadow. The atlas blends 0–9, ':' and '-' once
+ * per palette into opaque RGB565 sprites; a row of lv_img cells then shows
+ * a digit change as a plain image copy of just that cell.
+ */
+
+#ifndef UI_DIGIT_ATLAS_H
+#define UI_DIGIT_ATLAS_H
+
+#include <lvgl.h>
+#include <cstdint>
+
+namespace UiDigitAtlas
+{
+    static constexpr uint8_t MAX_GLYPHS = 12; // '0'–'9', ':', '-'
+    static constexpr uint8_t MAX_CELLS = 8;   // "HH:MM:SS"
+
+    struct Atlas
+    {
+        lv_img_dsc_t glyph[MAX_GLYPHS]; // indexed by '0'–'9', ':', '-'; data == nullptr if not built
+        lv_coord_t cellW;               // widest advance in the set (font is monospaced)
+        lv_coord_t cellH;               // font line height — same box as a label
+        lv_color_t *buf;                // one lv_mem block for all sprites (PSRAM)
+    };
+
+    // Blend `chars` (subset of "0123456789:-") in `fg` over the opaque `bg`.
+    // Rebuilding the same character set reuses the buffer and keeps the
+    // glyph descriptors in place (rows pick up the new colours on redraw);
+    // otherwise the previous build is freed. Returns false on OOM.
+    bool build(Atlas &atlas, const lv_font_t *font, lv_color_t fg, lv_color_t bg,
+               const char *chars = "0123456789:");
+    void release(Atlas &atlas);
+
+    // Sprite for one character, nullptr if it is not in the atlas.
+    const lv_img_dsc_t *get(const Atlas &atlas, char c);
+
+    // ── Digit row widget ────────────────────────────────────────────
+    // Drop-in for a label: `cells` fixed-width lv_img cells in a flex row,
+    // `gap` = the label's letter spacing.
+    struct DigitRow
+    {
+        lv_obj_t *cont;
+        lv_obj_t *cells[MAX_CELLS];
+        uint8_t count;
+    };
+
+    DigitRow createRow(lv_obj_t *parent, const Atlas &atlas, uint8_t cells, lv_coord_t gap);
+
+    // Show `text` (one char per cell). Only cells whose sprite changes are
+    // invalidated; switching atlases (colour change) updates every cell.
+    void setText(DigitRow &row, const Atlas &atlas, const char *text);
+
+} // namespace UiDigitAtlas
+
+#endif // UI_DIGIT_ATLAS_H
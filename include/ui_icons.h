@@ -2,27 +2,29 @@
  * @file ui_icons.h
  * @brief Icon Point Arrays and Drawing Functions
  *
- * All icons: 28x28 base size, 2px stroke, rounded ends
+ * All icons: 28x28 base size, 2px stroke, rounded ends.
+ * Colours are theme roles so icons follow day/night switches.
  */
 
 #ifndef UI_ICONS_H
 #define UI_ICONS_H
 
 #include <lvgl.h>
+#include "ui_theme.h"
 
 namespace UiIcons
 {
     // Core drawing helper
-    lv_obj_t *drawLine(lv_obj_t *parent, lv_point_t *pts, uint16_t cnt, lv_color_t col);
+    lv_obj_t *drawLine(lv_obj_t *parent, lv_point_t *pts, uint16_t cnt, UiTheme::Role col);
 
     // Icon drawing functions
-    void drawHomeIcon(lv_obj_t *cont, lv_color_t col);
-    void drawMosqueIcon(lv_obj_t *cont, lv_color_t col);
-    void drawMenuIcon(lv_obj_t *cont, lv_color_t col);
-    void drawSpeakerIcon(lv_obj_t *cont, bool isMuted, lv_color_t col, bool available = true);
-    void drawBrightnessIcon(lv_obj_t *cont, lv_color_t col);
-    void drawWiFiIcon(lv_obj_t *cont, lv_color_t col, bool connected = true);
-    void drawSyncIcon(lv_obj_t *cont, lv_color_t col, bool synced = true);
+    void drawHomeIcon(lv_obj_t *cont, UiTheme::Role col);
+    void drawMosqueIcon(lv_obj_t *cont, UiTheme::Role col);
+    void drawMenuIcon(lv_obj_t *cont, UiTheme::Role col);
+    void drawSpeakerIcon(lv_obj_t *cont, bool isMuted, UiTheme::Role col, bool available = true);
+    void drawBrightnessIcon(lv_obj_t *cont, UiTheme::Role col);
+    void drawWiFiIcon(lv_obj_t *cont, UiTheme::Role col, bool connected = true);
+    void drawSyncIcon(lv_obj_t *cont, UiTheme::Role col, bool synced = true);
 
 } // namespace UiIcons
 
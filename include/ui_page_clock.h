@@ -18,7 +18,10 @@
 namespace UiPageClock
 {
     lv_obj_t *create();
-    lv_obj_t *getScreen();
+    lv_obj_t *getScreen(); // nullptr until created / after destroy()
+
+    // Free the screen and its digit atlases (setters become no-ops)
+    void destroy();
 
     // Update clock display (called from dirty-flag handler every second)
     void setTime(int hour, int minute, int second);
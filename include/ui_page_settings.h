@@ -19,9 +19,12 @@ namespace UiPageSettings
     // Create/recreate settings screen
     lv_obj_t *create();
 
-    // Get the screen object
+    // Get the screen object (nullptr until created / after destroy())
     lv_obj_t *getScreen();
 
+    // Free the screen and the portal/QR page it owns (setters become no-ops)
+    void destroy();
+
     // Set callback for WiFi / "Telefondan Yönet" button press
     void setAdvancedCallback(AdvancedCallback cb);
 
@@ -9,6 +9,8 @@
 #ifndef UI_STATE_READER_H
 #define UI_STATE_READER_H
 
+#include <stdint.h>
+
 namespace UiStateReader
 {
     /**
@@ -29,6 +31,12 @@ namespace UiStateReader
     /** @brief Resume the LVGL timer (screen woken) */
     void resume();
 
+    /** @brief Change the polling period (refresh governor: 50 ms active, 1 s idle) */
+    void setPeriod(uint32_t periodMs);
+
+    /** @brief Run the next poll on the coming lv_timer_handler() pass */
+    void kick();
+
 } // namespace UiStateReader
 
 #endif // UI_STATE_READER_H
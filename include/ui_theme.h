@@ -4,6 +4,8 @@
 #include <lvgl.h>
 
 // ── Color macros — resolve at runtime from active palette ──
+// Value snapshot at call time: use for baked pixels (atlases, backgrounds).
+// Widgets take a UiTheme::Role instead so they follow theme switches.
 #define COLOR_BG lv_color_hex(UiTheme::p().bg)
 #define COLOR_BG2 lv_color_hex(UiTheme::p().bg2)
 #define COLOR_GOLD lv_color_hex(UiTheme::p().accent)
@@ -72,6 +74,26 @@ namespace UiTheme
 
     const ThemePalette &p();
 
+    // Palette slot a widget colour is bound to (same order as ThemePalette)
+    enum class Role : uint8_t
+    {
+        BG,
+        BG2,
+        STRIP_BG,
+        GOLD,
+        GOLD_LIGHT,
+        TEXT,
+        DIM,
+        BORDER,
+        GREEN,
+        AMBER,
+        BTN_HI,
+        BTN_LO,
+        COUNT
+    };
+
+    lv_color_t color(Role role);
+
     static constexpr int16_t SCREEN_W = 480;
     static constexpr int16_t SCREEN_H = 320;
 
@@ -90,8 +112,30 @@ namespace UiTheme
     static constexpr uint32_t DEBOUNCE_MS = 140;
 
     void initStyles();
+
+    // Switch palette at runtime: updates the shared styles in place, reports
+    // the change to LVGL once and runs the theme listeners. No allocation.
     void setThemeMode(ThemeMode mode);
     ThemeMode getThemeMode();
+
+    // Called after a palette switch — for assets that bake colours into
+    // pixels (digit atlases, background cache).
+    using ThemeListener = void (*)();
+    void addThemeListener(ThemeListener listener);
+
+    // ── Role colours ─────────────────────────────────────────────────
+    // Replace lv_obj_set_style_<prop>_color(obj, COLOR_X, sel). Each binds the
+    // object to one shared single-property style per (property, role), so a
+    // palette switch re-styles every widget without touching it. Calling again
+    // with another role swaps the style pointer in place (no heap churn).
+    void setTextColor(lv_obj_t *obj, Role role, lv_style_selector_t sel = 0);
+    void setBgColor(lv_obj_t *obj, Role role, lv_style_selector_t sel = 0);
+    void setBgGradColor(lv_obj_t *obj, Role role, lv_style_selector_t sel = 0);
+    void setBorderColor(lv_obj_t *obj, Role role, lv_style_selector_t sel = 0);
+    void setShadowColor(lv_obj_t *obj, Role role, lv_style_selector_t sel = 0);
+    void setLineColor(lv_obj_t *obj, Role role, lv_style_selector_t sel = 0);
+    void setArcColor(lv_obj_t *obj, Role role, lv_style_selector_t sel = 0);
+
     lv_style_t *getStyleScreen();
     lv_style_t *getStyleCard();
     lv_style_t *getStyleIconBar();
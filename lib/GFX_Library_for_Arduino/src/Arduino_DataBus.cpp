@@ -135,17 +135,38 @@ void Arduino_DataBus::batchOperation(const uint8_t *operations, size_t len)
 
 #if !defined(LITTLE_FOOT_PRINT)
 void Arduino_DataBus::write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h)
+{
+  write16bitBeRGBBitmapR1(bitmap, w, h, w);
+}
+
+void Arduino_DataBus::write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride)
 {
   uint16_t *p;
   for (int16_t i = 0; i < w; i++)
   {
-    p = bitmap + ((h - 1) * w) + i;
+    p = bitmap + ((int32_t)(h - 1) * stride) + i;
+    for (int16_t j = 0; j < h; j++)
+    {
+      _data16.value = *p;
+      write(_data16.lsb);
+      write(_data16.msb);
+      p -= stride;
+    }
+  }
+}
+
+void Arduino_DataBus::write16bitBeRGBBitmapR3(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride)
+{
+  uint16_t *p;
+  for (int16_t i = w - 1; i >= 0; i--)
+  {
+    p = bitmap + i;
     for (int16_t j = 0; j < h; j++)
     {
       _data16.value = *p;
       write(_data16.lsb);
       write(_data16.msb);
-      p -= w;
+      p += stride;
     }
   }
 }
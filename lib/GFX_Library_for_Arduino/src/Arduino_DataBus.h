@@ -290,6 +290,8 @@ public:
 
 #if !defined(LITTLE_FOOT_PRINT)
   virtual void write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h);
+  virtual void write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride);
+  virtual void write16bitBeRGBBitmapR3(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride);
   virtual void batchOperation(const uint8_t *operations, size_t len);
   virtual void writePattern(uint8_t *data, uint8_t len, uint32_t repeat);
   virtual void writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len);
@@ -736,6 +736,58 @@ void Arduino_TFT::draw16bitBeRGBBitmapR1(
   }
 }
 
+/**
+ * @brief draw16bitBeRGBBitmapR1 (strided sub-rectangle)
+ *
+ * Same 90° CW transfer as above, but reads a w × h window out of a larger
+ * row-major buffer whose rows are `stride` pixels apart. Used for partial
+ * (dirty-area) flushes; the window must lie fully on screen.
+ */
+void Arduino_TFT::draw16bitBeRGBBitmapR1(
+    int16_t x, int16_t y,
+    uint16_t *bitmap, int16_t w, int16_t h, int16_t stride)
+{
+  if (
+      (x < 0) ||                // Outside left
+      (y < 0) ||                // Outside top
+      ((x + h - 1) > _max_x) || // Outside right
+      ((y + w - 1) > _max_y)    // Outside bottom
+  )
+  {
+    return;
+  }
+
+  startWrite();
+  writeAddrWindow(x, y, h, w);
+  _bus->write16bitBeRGBBitmapR1(bitmap, w, h, stride);
+  endWrite();
+}
+
+/**
+ * @brief draw16bitBeRGBBitmapR3 (strided sub-rectangle)
+ *
+ * 90° CCW (270° CW) rotated transfer of a w × h window; output window is h × w.
+ */
+void Arduino_TFT::draw16bitBeRGBBitmapR3(
+    int16_t x, int16_t y,
+    uint16_t *bitmap, int16_t w, int16_t h, int16_t stride)
+{
+  if (
+      (x < 0) ||                // Outside left
+      (y < 0) ||                // Outside top
+      ((x + h - 1) > _max_x) || // Outside right
+      ((y + w - 1) > _max_y)    // Outside bottom
+  )
+  {
+    return;
+  }
+
+  startWrite();
+  writeAddrWindow(x, y, h, w);
+  _bus->write16bitBeRGBBitmapR3(bitmap, w, h, stride);
+  endWrite();
+}
+
 void Arduino_TFT::draw24bitRGBBitmap(
     int16_t x, int16_t y,
     const uint8_t bitmap[], int16_t w, int16_t h)
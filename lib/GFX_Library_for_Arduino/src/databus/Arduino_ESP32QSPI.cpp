@@ -1,4 +1,5 @@
 #include "Arduino_ESP32QSPI.h"
+#include "Arduino_ESP32QSPI_rotate.h"
 
 #if defined(ESP32)
 
@@ -562,70 +563,107 @@ void Arduino_ESP32QSPI::writeBytes(uint8_t *data, uint32_t len)
  */
 void Arduino_ESP32QSPI::write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h)
 {
-  if (h > ESP32QSPI_MAX_PIXELS_AT_ONCE)
+  writeRotatedBitmap(bitmap, w, h, w, 1);
+}
+
+/**
+ * @brief write16bitBeRGBBitmapR1  (strided sub-rectangle)
+ *
+ * @param bitmap  Top-left pixel of the window inside the source buffer
+ * @param w       Window width  (number of columns to send)
+ * @param h       Window height (pixels per column)
+ * @param stride  Source row pitch in pixels (>= w)
+ */
+void Arduino_ESP32QSPI::write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride)
+{
+  writeRotatedBitmap(bitmap, w, h, stride, 1);
+}
+
+/**
+ * @brief write16bitBeRGBBitmapR3  (strided sub-rectangle)
+ *
+ * Rotates landscape bitmap 90° CCW (270° CW) during QSPI DMA transfer
+ * (last column first, each column top-to-bottom). Output window is h × w.
+ */
+void Arduino_ESP32QSPI::write16bitBeRGBBitmapR3(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride)
+{
+  writeRotatedBitmap(bitmap, w, h, stride, 3);
+}
+
+/**
+ * @brief copyRotatedLines
+ *
+ * Gathers `count` output lines, starting at output line `line`, of the
+ * rotated bitmap into a DMA buffer. An output line is a source column
+ * (cache-blocked gather, see Arduino_ESP32QSPI_rotate.h).
+ */
+GFX_INLINE void Arduino_ESP32QSPI::copyRotatedLines(uint16_t *dst, uint16_t *bitmap, int16_t w, int16_t h, int16_t stride,
+                                                    uint8_t r, int16_t line, int16_t count)
+{
+  if (r == 3)
+  {
+    // Last column first, each column top-to-bottom
+    qspi_rotate_gather(dst, bitmap + (w - 1 - line), stride, -1, h, count);
+  }
+  else // r == 1
   {
-    log_e("h > ESP32QSPI_MAX_PIXELS_AT_ONCE, h: %d", h);
+    // First column first, each column bottom-to-top
+    qspi_rotate_gather(dst, bitmap + ((int32_t)(h - 1) * stride) + line, -(int32_t)stride, 1, h, count);
+  }
+}
+
+/**
+ * @brief writeRotatedBitmap  (double-buffered, multi-line)
+ *
+ * Shared ping-pong loop for the R1/R3 paths: the CPU gathers the next
+ * batch of rotated lines into one DMA buffer while the other is on the bus.
+ */
+void Arduino_ESP32QSPI::writeRotatedBitmap(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride, uint8_t r)
+{
+  const int16_t line_len = h; // one output line = one source column
+  const int16_t lines = w;
+
+  if (line_len > ESP32QSPI_MAX_PIXELS_AT_ONCE)
+  {
+    log_e("line > ESP32QSPI_MAX_PIXELS_AT_ONCE, line: %d", line_len);
     return;
   }
 
-  // How many columns fit in one DMA buffer?
-  int16_t cols_per_batch = ESP32QSPI_MAX_PIXELS_AT_ONCE / h;
-  if (cols_per_batch < 1)
-    cols_per_batch = 1;
+  // How many lines fit in one DMA buffer?
+  int16_t lines_per_batch = ESP32QSPI_MAX_PIXELS_AT_ONCE / line_len;
+  if (lines_per_batch < 1)
+    lines_per_batch = 1;
 
   CS_LOW();
 
-  uint16_t *origin_offset = bitmap + ((h - 1) * w);
   uint16_t *cur_buf = _buffer16;
   uint16_t *alt_buf = _2nd_buffer16;
-  int16_t col = 0;
+  int16_t line = 0;
 
   // --- First batch: copy into cur_buf, start DMA ---
-  int16_t batch = (w < cols_per_batch) ? w : cols_per_batch;
-  {
-    uint16_t *dst = cur_buf;
-    for (int16_t c = 0; c < batch; c++)
-    {
-      uint16_t *p = origin_offset + (col + c);
-      for (int16_t j = 0; j < h; j++)
-      {
-        *dst++ = *p;
-        p -= w;
-      }
-    }
-  }
+  int16_t batch = (lines < lines_per_batch) ? lines : lines_per_batch;
+  copyRotatedLines(cur_buf, bitmap, w, h, stride, r, line, batch);
 
   _spi_tran_ext.base.flags = SPI_TRANS_MODE_QIO;
   _spi_tran_ext.base.cmd = 0x32;
   _spi_tran_ext.base.addr = 0x003C00;
   _spi_tran_ext.base.tx_buffer = cur_buf;
-  _spi_tran_ext.base.length = (uint32_t)(batch * h) << 4;
+  _spi_tran_ext.base.length = (uint32_t)(batch * line_len) << 4;
   POLL_START();
 
   // Swap: next copy goes into alt_buf while cur_buf is DMA-ing
   uint16_t *tmp = cur_buf;
   cur_buf = alt_buf;
   alt_buf = tmp;
-  col += batch;
+  line += batch;
 
   // --- Remaining batches: overlap copy with DMA ---
-  while (col < w)
+  while (line < lines)
   {
-    batch = ((w - col) < cols_per_batch) ? (w - col) : cols_per_batch;
+    batch = ((lines - line) < lines_per_batch) ? (lines - line) : lines_per_batch;
 
     // Copy next batch into cur_buf WHILE DMA sends from alt_buf
-    {
-      uint16_t *dst = cur_buf;
-      for (int16_t c = 0; c < batch; c++)
-      {
-        uint16_t *p = origin_offset + (col + c);
-        for (int16_t j = 0; j < h; j++)
-        {
-          *dst++ = *p;
-          p -= w;
-        }
-      }
-    }
+    copyRotatedLines(cur_buf, bitmap, w, h, stride, r, line, batch);
 
     // Wait for previous DMA to finish
     POLL_END();
@@ -634,14 +672,14 @@ void Arduino_ESP32QSPI::write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int
     _spi_tran_ext.base.flags = SPI_TRANS_MODE_QIO | SPI_TRANS_VARIABLE_CMD |
                                SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_DUMMY;
     _spi_tran_ext.base.tx_buffer = cur_buf;
-    _spi_tran_ext.base.length = (uint32_t)(batch * h) << 4;
+    _spi_tran_ext.base.length = (uint32_t)(batch * line_len) << 4;
     POLL_START();
 
     // Swap buffers for next iteration
     tmp = cur_buf;
     cur_buf = alt_buf;
     alt_buf = tmp;
-    col += batch;
+    line += batch;
   }
 
   POLL_END();
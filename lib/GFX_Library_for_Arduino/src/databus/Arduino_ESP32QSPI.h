@@ -46,6 +46,8 @@ public:
   void writeRepeat(uint16_t p, uint32_t len) override;
   void writePixels(uint16_t *data, uint32_t len) override;
   void write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h) override;
+  void write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride) override;
+  void write16bitBeRGBBitmapR3(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride) override;
 
   void batchOperation(const uint8_t *operations, size_t len) override;
   void writeBytes(uint8_t *data, uint32_t len) override;
@@ -60,6 +62,9 @@ private:
   GFX_INLINE void CS_LOW(void);
   GFX_INLINE void POLL_START();
   GFX_INLINE void POLL_END();
+  GFX_INLINE void copyRotatedLines(uint16_t *dst, uint16_t *bitmap, int16_t w, int16_t h, int16_t stride,
+                                   uint8_t r, int16_t line, int16_t count);
+  void writeRotatedBitmap(uint16_t *bitmap, int16_t w, int16_t h, int16_t stride, uint8_t r);
 
   int8_t _cs, _sck, _mosi, _miso, _quadwp, _quadhd;
   bool _is_shared_interface;
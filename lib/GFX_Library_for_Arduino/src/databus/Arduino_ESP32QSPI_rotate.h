@@ -0,0 +1,124 @@
+/**
+ * @file Arduino_ESP32QSPI_rotate.h
+ * @brief Column-gather kernels for the rotated (R1/R3) QSPI transfers
+ *
+ * Header-only and platform-independent so the native benchmark
+ * (test/test_bench_rotate) compiles the exact code that runs on the ESP32.
+ *
+ * A rotated transfer emits source COLUMNS as output lines. Walking one column
+ * at a time strides a full source row (960 B for 480 px) per pixel, so every
+ * read lands on a different PSRAM cache line. The paired kernel instead walks
+ * a band of ESP32QSPI_ROTATE_TILE rows across all columns of the batch, so each
+ * cache line is fetched once per band and reused for every column in it, and
+ * moves 2×2 pixel micro-tiles with 32-bit loads and stores (Xtensa LX7 and x86
+ * are both little-endian). Blocking alone, with 16-bit moves, measured slower
+ * than the plain column walk and is not kept.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifndef ESP32QSPI_ROTATE_TILE
+#define ESP32QSPI_ROTATE_TILE 16
+#endif
+#ifndef ESP32QSPI_ROTATE_PAIRED
+#define ESP32QSPI_ROTATE_PAIRED 1
+#endif
+
+/**
+ * @brief Reference column walk (the original R1/R3 inner loop)
+ *
+ * dst[l * h + j] = first[l * col_step + j * row_step]
+ *
+ * @param dst       Output buffer, `count` lines of `h` pixels
+ * @param first     Source pixel that becomes dst[0]
+ * @param row_step  Source offset between consecutive pixels of one line (±stride)
+ * @param col_step  Source offset between consecutive lines (±1)
+ */
+static inline void qspi_rotate_gather_ref(uint16_t *dst, const uint16_t *first,
+                                          int32_t row_step, int32_t col_step,
+                                          int16_t h, int16_t count)
+{
+  for (int16_t l = 0; l < count; l++)
+  {
+    const uint16_t *p = first + l * col_step;
+    for (int16_t j = 0; j < h; j++)
+    {
+      *dst++ = *p;
+      p += row_step;
+    }
+  }
+}
+
+/**
+ * @brief Row-band blocked gather with 2×2 micro-tiles in 32-bit words
+ *
+ * Same output as qspi_rotate_gather_ref(), which it falls back to when source
+ * pixel pairs or output lines are not 32-bit aligned (odd window x, odd h,
+ * odd stride).
+ */
+static inline void qspi_rotate_gather_paired(uint16_t *dst, const uint16_t *first,
+                                             int32_t row_step, int32_t col_step,
+                                             int16_t h, int16_t count)
+{
+  // Leftmost source pixel of a line pair: first for col_step=+1, first-1 for -1.
+  const uint16_t *pair_base = (col_step > 0) ? first : first - 1;
+  if ((h & 1) || (row_step & 1) || (count < 2) ||
+      ((uintptr_t)pair_base & 3) || ((uintptr_t)dst & 3))
+  {
+    qspi_rotate_gather_ref(dst, first, row_step, col_step, h, count);
+    return;
+  }
+
+  const int16_t pairs = count >> 1;
+  for (int16_t jb = 0; jb < h; jb += ESP32QSPI_ROTATE_TILE)
+  {
+    const int16_t jn = (h - jb < ESP32QSPI_ROTATE_TILE) ? (h - jb) : ESP32QSPI_ROTATE_TILE;
+    for (int16_t lp = 0; lp < pairs; lp++)
+    {
+      const int16_t l = lp << 1;
+      // Line pair (l, l+1) sits at source columns (c, c+1), or (c-1, c) when col_step = -1
+      const uint16_t *p = pair_base + jb * row_step + l * col_step;
+      uint32_t *d0 = (uint32_t *)(dst + l * h + jb);
+      uint32_t *d1 = (uint32_t *)(dst + (l + 1) * h + jb);
+      for (int16_t j = 0; j < jn; j += 2)
+      {
+        const uint32_t a = *(const uint32_t *)p;              // row j:   lo = left, hi = right
+        const uint32_t b = *(const uint32_t *)(p + row_step); // row j+1
+        const uint32_t lo = (a & 0xFFFF) | (b << 16);
+        const uint32_t hi = (a >> 16) | (b & 0xFFFF0000);
+        if (col_step > 0)
+        {
+          *d0++ = lo;
+          *d1++ = hi;
+        }
+        else
+        {
+          *d0++ = hi;
+          *d1++ = lo;
+        }
+        p += 2 * row_step;
+      }
+    }
+  }
+
+  if (count & 1)
+  {
+    const int16_t l = count - 1;
+    qspi_rotate_gather_ref(dst + l * h, first + l * col_step, row_step, col_step, h, 1);
+  }
+}
+
+/**
+ * @brief Kernel used by Arduino_ESP32QSPI for R1/R3 batches
+ */
+static inline void qspi_rotate_gather(uint16_t *dst, const uint16_t *first,
+                                      int32_t row_step, int32_t col_step,
+                                      int16_t h, int16_t count)
+{
+#if ESP32QSPI_ROTATE_PAIRED
+  qspi_rotate_gather_paired(dst, first, row_step, col_step, h, count);
+#else
+  qspi_rotate_gather_ref(dst, first, row_step, col_step, h, count);
+#endif
+}
@@ -44,6 +44,11 @@ void bsp_touch_init(TwoWire *touch_i2c, int tp_rst, uint16_t rotation, uint16_t
     }
 }
 
+void bsp_touch_set_rotation(uint16_t rotation)
+{
+    g_rotation = rotation;
+}
+
 void bsp_touch_read(void)
 {
     uint8_t data[14] = {0};
@@ -24,3 +24,4 @@ void bsp_touch_read(void);
 bool bsp_touch_get_coordinates(touch_data_t *touch_data);
 // bool touch_init(TwoWire *touch_i2c, int tp_rst, int tp_int);
 void bsp_touch_init(TwoWire *touch_i2c, int tp_rst, uint16_t rotation, uint16_t width, uint16_t height);
+void bsp_touch_set_rotation(uint16_t rotation);
@@ -0,0 +1,105 @@
+/**
+ * @file png_writer.cpp
+ * @brief Minimal PNG encoder (stored deflate, no zlib dependency)
+ */
+
+#include "png_writer.h"
+#include <cstdio>
+#include <vector>
+
+namespace PngWriter
+{
+    static uint32_t crcTable[256];
+    static bool crcReady = false;
+
+    static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len)
+    {
+        if (!crcReady)
+        {
+            for (uint32_t n = 0; n < 256; n++)
+            {
+                uint32_t c = n;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                crcTable[n] = c;
+            }
+            crcReady = true;
+        }
+        crc = ~crc;
+        for (size_t i = 0; i < len; i++)
+            crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    static void putU32(std::vector<uint8_t> &out, uint32_t v)
+    {
+        out.push_back((uint8_t)(v >> 24));
+        out.push_back((uint8_t)(v >> 16));
+        out.push_back((uint8_t)(v >> 8));
+        out.push_back((uint8_t)v);
+    }
+
+    static void putChunk(std::vector<uint8_t> &out, const char type[4], const std::vector<uint8_t> &data)
+    {
+        putU32(out, (uint32_t)data.size());
+        const size_t typePos = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data.begin(), data.end());
+        putU32(out, crc32(0, out.data() + typePos, data.size() + 4));
+    }
+
+    bool writeRgb(const char *path, const uint8_t *rgb, int w, int h)
+    {
+        // Raw scanlines: filter byte 0 + RGB row
+        const size_t rowBytes = (size_t)w * 3;
+        std::vector<uint8_t> raw;
+        raw.reserve((rowBytes + 1) * h);
+        for (int y = 0; y < h; y++)
+        {
+            raw.push_back(0);
+            raw.insert(raw.end(), rgb + y * rowBytes, rgb + (y + 1) * rowBytes);
+        }
+
+        // zlib stream of stored deflate blocks (max 65535 bytes each)
+        std::vector<uint8_t> idat = {0x78, 0x01};
+        uint32_t a = 1, b = 0; // Adler-32
+        size_t pos = 0;
+        do
+        {
+            const size_t len = (raw.size() - pos < 65535) ? raw.size() - pos : 65535;
+            const bool last = (pos + len == raw.size());
+            idat.push_back(last ? 1 : 0);
+            idat.push_back((uint8_t)len);
+            idat.push_back((uint8_t)(len >> 8));
+            idat.push_back((uint8_t)~len);
+            idat.push_back((uint8_t)(~len >> 8));
+            for (size_t i = 0; i < len; i++)
+            {
+                const uint8_t v = raw[pos + i];
+                idat.push_back(v);
+                a = (a + v) % 65521;
+                b = (b + a) % 65521;
+            }
+            pos += len;
+        } while (pos < raw.size());
+        putU32(idat, (b << 16) | a);
+
+        std::vector<uint8_t> ihdr;
+        putU32(ihdr, (uint32_t)w);
+        putU32(ihdr, (uint32_t)h);
+        ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0}); // 8-bit, truecolor, deflate, filter 0, no interlace
+
+        std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        putChunk(png, "IHDR", ihdr);
+        putChunk(png, "IDAT", idat);
+        putChunk(png, "IEND", {});
+
+        FILE *f = fopen(path, "wb");
+        if (!f)
+            return false;
+        const bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+        fclose(f);
+        return ok;
+    }
+
+} // namespace PngWriter
@@ -0,0 +1,21 @@
+/**
+ * @file png_writer.h
+ * @brief Minimal PNG encoder for simulator snapshots
+ *
+ * Writes 8-bit RGB, filter 0, stored (uncompressed) deflate blocks.
+ * Files are larger than a real encoder's but need no zlib.
+ */
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <cstdint>
+
+namespace PngWriter
+{
+    /// Write a w × h RGB888 image (row-major, 3 bytes per pixel).
+    /// Returns false if the file cannot be written.
+    bool writeRgb(const char *path, const uint8_t *rgb, int w, int h);
+
+} // namespace PngWriter
+
+#endif // PNG_WRITER_H
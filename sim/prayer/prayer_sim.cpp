@@ -0,0 +1,265 @@
+/**
+ * @file prayer_sim.cpp
+ * @brief Fast-forward simulation of PrayerEngine + Scheduler (env:prayer_sim)
+ *
+ * Replays months of virtual time in seconds: the loop runs the due tasks,
+ * then jumps the virtual clock to the next deadline instead of waiting for
+ * it. On the way the wall clock is stepped like NTP and the RTC step it
+ * (small drift corrections, large resyncs, steps right across a prayer);
+ * after a week with the screen on comes a week awake with the screen off,
+ * then the device light-sleeps between prayers, crossing both DST
+ * transitions. At the end every adhan must have started exactly once, on
+ * time, from a pre-rolled file; the host CPU time spent in the engine is
+ * reported.
+ *
+ * Usage: program [days] [-v]    (-v: firmware serial log)
+ */
+
+#include "sim_world.h"
+#include "prayer_engine.h"
+#include "scheduler.h"
+#include "system_clock.h"
+#include "time_zone_rules.h"
+#include "civil_date.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr int DEFAULT_DAYS = 300;
+    constexpr int SCREEN_ON_DAYS = 7;         // then screen off, kept awake …
+    constexpr int AWAKE_DARK_DAYS = 7;        // … then light sleep between prayers
+    constexpr int64_t US = 1000000;
+    constexpr uint32_t AWAKE_CAP_MS = 3600UL * 1000;
+    constexpr uint32_t AUDIO_POLL_MS = 1000;  // main.cpp polls faster; the sim only needs the end
+    constexpr time_t SLEEP_WAKE_EARLY_SEC = 5; // PowerManager: wake ahead of the prayer
+    constexpr time_t MAX_SLEEP_SEC = 8 * 3600;
+    constexpr int64_t START_TOLERANCE_US = 2 * US; // small NTP corrections can land inside
+    constexpr int64_t CATCHUP_TOLERANCE_US = 5 * US;
+
+    struct Step
+    {
+        int64_t atUs;   // wall clock when it happens
+        int64_t stepUs; // correction
+    };
+
+    struct Expected
+    {
+        time_t at;
+        PrayerType prayer;
+        bool catchUp;
+        int starts;
+    };
+
+    std::mt19937 s_rng(20260201);
+
+    int64_t uniform(int64_t lo, int64_t hi)
+    {
+        return std::uniform_int_distribution<int64_t>(lo, hi)(s_rng);
+    }
+
+    // Nothing expected within `marginSec` of the wall interval [fromUs, toUs]
+    bool clearOfPrayers(const std::vector<Expected> &expected, int64_t fromUs, int64_t toUs, time_t marginSec)
+    {
+        if (fromUs > toUs)
+            std::swap(fromUs, toUs);
+        for (const Expected &e : expected)
+        {
+            const int64_t at = (int64_t)e.at * US;
+            if (at >= fromUs - marginSec * US && at <= toUs + marginSec * US)
+                return false;
+        }
+        return true;
+    }
+
+    int32_t localDay(time_t epoch)
+    {
+        return CivilDate::daysFromCivil(TimeZoneRules::current().localDate(epoch));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int days = DEFAULT_DAYS;
+    Serial.enabled = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-v") == 0)
+            Serial.enabled = true;
+        else
+            days = std::max(1, std::atoi(argv[i]));
+    }
+
+    // Boot at an odd sub-second time, mid-morning
+    const time_t boot = (time_t)CivilDate::daysFromCivil(2026, 2, 1) * 86400 + 9 * 3600 + 17 * 60 + 23;
+    SimWorld::startClock((int64_t)boot * US + 456789);
+
+    const time_t end = boot + (time_t)days * 86400;
+    const int64_t darkFromUs = ((int64_t)boot + SCREEN_ON_DAYS * 86400LL) * US;
+    const int64_t sleepFromUs = darkFromUs + AWAKE_DARK_DAYS * 86400LL * US;
+
+    // ── Expected adhans: every prayer but sunrise, strictly after boot ──
+    std::vector<Expected> expected;
+    for (int32_t day = localDay(boot); day <= localDay(end); day++)
+    {
+        time_t instants[6];
+        SimWorld::modelInstants(day, instants);
+        for (int p = 0; p < 6; p++)
+        {
+            const PrayerType prayer = static_cast<PrayerType>(p);
+            if (prayer == PrayerType::Sunrise || instants[p] <= boot + 60 || instants[p] >= end - 600)
+                continue;
+            expected.push_back({instants[p], prayer, false, 0});
+        }
+    }
+
+    // ── Clock steps ──
+    std::vector<Step> steps;
+    // NTP drift corrections every ~6 h, below the jump threshold
+    for (int64_t t = (int64_t)(boot + 3 * 3600) * US; t < (int64_t)end * US; t += 6 * 3600 * US + uniform(-600, 600) * US)
+        steps.push_back({t, uniform(-1500, 1500) * 1000});
+    // Weekly large resync (RTC was off by minutes), never across a prayer
+    for (int64_t t = (int64_t)(boot + 2 * 86400) * US; t < (int64_t)end * US; t += 7 * 86400 * US)
+    {
+        const int64_t step = uniform(-180, 180) * US;
+        if (clearOfPrayers(expected, t, t + step, 30))
+            steps.push_back({t, step});
+    }
+    // Every fifth day: one prayer sees a +4 s step 2 s before it (catch-up),
+    // another a step back across it after its adhan ended (must not repeat)
+    for (size_t i = 7; i + 3 < expected.size(); i += 25)
+    {
+        Expected &catchUp = expected[i];
+        catchUp.catchUp = true;
+        steps.push_back({((int64_t)catchUp.at - 2) * US, 4 * US});
+
+        // Adhan over at +180 s; back to 60 s before the prayer
+        const Expected &replay = expected[i + 2];
+        steps.push_back({((int64_t)replay.at + 200) * US, -260 * US});
+    }
+    std::sort(steps.begin(), steps.end(), [](const Step &a, const Step &b) { return a.atUs < b.atUs; });
+
+    // ── Run ──
+    Scheduler::init();
+    if (!PrayerEngine::init())
+    {
+        std::printf("PrayerEngine::init() failed\n");
+        return 1;
+    }
+
+    size_t nextStep = 0;
+    uint64_t wakeups = 0, sleeps = 0, clockSteps = 0;
+    std::chrono::nanoseconds cpu{0}, worst{0};
+
+    while (SimWorld::wallUs() < (int64_t)end * US)
+    {
+        while (nextStep < steps.size() && steps[nextStep].atUs <= SimWorld::wallUs())
+        {
+            SimWorld::stepWall(steps[nextStep++].stepUs);
+            Scheduler::clockChanged();
+            clockSteps++;
+        }
+
+        const auto t0 = std::chrono::steady_clock::now();
+        PrayerEngine::tick();
+        Scheduler::run();
+        const auto spent = std::chrono::steady_clock::now() - t0;
+        cpu += spent;
+        worst = std::max<std::chrono::nanoseconds>(worst, spent);
+        wakeups++;
+
+        if (SimWorld::wallUs() >= darkFromUs)
+            SimWorld::setScreenAlwaysOn(false);
+
+        // Light sleep until shortly before the next prayer, then the RTC
+        // restores the wall clock with a little error
+        const int secondsUntil = PrayerEngine::getSecondsUntilNextPrayer();
+        if (SimWorld::wallUs() >= sleepFromUs && !SimWorld::screenOn() && !SimWorld::wakeLockHeld() &&
+            !SimWorld::audioPlaying() &&
+            Scheduler::msUntilNext(1) > 0 && secondsUntil > SLEEP_WAKE_EARLY_SEC)
+        {
+            int64_t sleepUs = std::min<int64_t>((secondsUntil - SLEEP_WAKE_EARLY_SEC) * US, MAX_SLEEP_SEC * US);
+            if (nextStep < steps.size()) // the step wakes it (an NTP sync is a timer too)
+                sleepUs = std::clamp<int64_t>(steps[nextStep].atUs - SimWorld::wallUs(), 0, sleepUs);
+            SimWorld::advance((uint64_t)sleepUs);
+            SimWorld::stepWall(uniform(-900, 900) * 1000);
+            sleeps++;
+            Scheduler::clockChanged();
+            Scheduler::after(Scheduler::Task::PRAYER, 0);
+            continue;
+        }
+
+        uint32_t capMs = SimWorld::audioPlaying() ? AUDIO_POLL_MS : AWAKE_CAP_MS;
+        if (nextStep < steps.size())
+        {
+            const int64_t untilStepMs = (steps[nextStep].atUs - SimWorld::wallUs() + 999) / 1000;
+            capMs = (uint32_t)std::clamp<int64_t>(untilStepMs, 0, capMs);
+        }
+        SimWorld::advance((uint64_t)Scheduler::msUntilNext(capMs) * 1000);
+    }
+
+    // ── Check ──
+    int failures = 0;
+    int prerolled = 0;
+    int started = 0;
+    int64_t latest = 0;
+    std::vector<bool> matched(SimWorld::adhanStarts().size(), false);
+    for (Expected &e : expected)
+    {
+        const int64_t at = (int64_t)e.at * US;
+        const int64_t tolerance = e.catchUp ? CATCHUP_TOLERANCE_US : START_TOLERANCE_US;
+        for (size_t i = 0; i < SimWorld::adhanStarts().size(); i++)
+        {
+            const SimWorld::AdhanStart &start = SimWorld::adhanStarts()[i];
+            if (start.prayer != e.prayer || start.wallUs < at - START_TOLERANCE_US || start.wallUs > at + tolerance)
+                continue;
+            matched[i] = true;
+            e.starts++;
+            started++;
+            prerolled += start.prerolled;
+            latest = std::max(latest, start.wallUs - at);
+        }
+        if (e.starts != 1)
+        {
+            const time_t local = TimeZoneRules::current().toLocal(e.at);
+            const CivilDate::Date date = CivilDate::civilFromDays((int32_t)(local / 86400));
+            std::printf("FAIL %04d-%02d-%02d %02d:%02d %s: adhan started %d times\n",
+                        date.year, date.month, date.day, (int)(local % 86400 / 3600), (int)(local % 3600 / 60),
+                        getPrayerName(e.prayer).data(), e.starts);
+            failures++;
+        }
+    }
+    for (size_t i = 0; i < matched.size(); i++)
+    {
+        if (!matched[i])
+        {
+            std::printf("FAIL unexpected adhan (%s) at wall %lld us\n",
+                        getPrayerName(SimWorld::adhanStarts()[i].prayer).data(),
+                        (long long)SimWorld::adhanStarts()[i].wallUs);
+            failures++;
+        }
+    }
+
+    if (prerolled != started)
+    {
+        std::printf("FAIL %d of %d adhans started without a pre-roll\n", started - prerolled, started);
+        failures++;
+    }
+
+    const double cpuMs = std::chrono::duration<double, std::milli>(cpu).count();
+    std::printf("Simulated %d days: %zu adhans (%d pre-rolled, latest start %+.3f s), %llu clock steps, %llu light sleeps\n",
+                days, expected.size(), prerolled, latest / 1e6,
+                (unsigned long long)clockSteps, (unsigned long long)sleeps);
+    std::printf("Loop passes %llu (%.0f/day), CPU in tick()+run() %.1f ms total, %.2f us/pass, worst %.1f us\n",
+                (unsigned long long)wakeups, (double)wakeups / days, cpuMs,
+                wakeups ? cpuMs * 1000 / wakeups : 0.0,
+                std::chrono::duration<double, std::micro>(worst).count());
+    std::printf("%s\n", failures ? "FAILED" : "OK: every adhan fired exactly once, pre-rolled");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,309 @@
+/**
+ * @file sim_stubs.cpp
+ * @brief Host stand-ins for what PrayerEngine calls into (env:prayer_sim)
+ *
+ * SystemClock reads the virtual clock; settings are fixed (calculated
+ * method, Leuven, CET/CEST, every adhan enabled); the prayer table serves
+ * the SimWorld model; audio and power only record what was asked of them.
+ * Network and the Diyanet cache are always unavailable.
+ */
+
+#include "sim_world.h"
+#include "system_clock.h"
+#include "settings_manager.h"
+#include "network.h"
+#include "prayer_api.h"
+#include "prayer_table.h"
+#include "prayer_calculator.h"
+#include "time_zone_rules.h"
+#include "audio_player.h"
+#include "power_manager.h"
+#include "scheduler.h"
+#include "qibla.h"
+#include "config.h"
+#include <cmath>
+#include <string_view>
+
+// ═══════════════════════════════════════════════════════════════
+// SIM WORLD
+// ═══════════════════════════════════════════════════════════════
+
+namespace
+{
+    int64_t s_wallOffsetUs = 0; // wall - monotonic
+    uint64_t s_monotonicUs = 0;
+
+    std::vector<SimWorld::AdhanStart> s_starts;
+    bool s_playing = false;
+    uint64_t s_playStartUs = 0;
+    PrayerType s_preparedPrayer = PrayerType::Fajr;
+    bool s_prepared = false;
+
+    uint8_t s_wakeLocks = 0;
+    bool s_screenAlwaysOn = true;
+    uint64_t s_screenOnUntilUs = 0;
+
+    constexpr double PI = 3.14159265358979323846;
+}
+
+void SimWorld::startClock(int64_t wallUs)
+{
+    s_monotonicUs = 0;
+    s_wallOffsetUs = wallUs;
+}
+
+void SimWorld::advance(uint64_t us)
+{
+    s_monotonicUs += us;
+}
+
+void SimWorld::stepWall(int64_t us)
+{
+    s_wallOffsetUs += us;
+}
+
+int64_t SimWorld::wallUs()
+{
+    return static_cast<int64_t>(s_monotonicUs) + s_wallOffsetUs;
+}
+
+uint64_t SimWorld::monotonicUs()
+{
+    return s_monotonicUs;
+}
+
+void SimWorld::modelInstants(int32_t day, time_t out[6])
+{
+    const CivilDate::Date date = CivilDate::civilFromDays(day);
+    const int dayOfYear = day - CivilDate::daysFromCivil(date.year, 1, 1);
+    const double season = std::cos(2 * PI * (dayOfYear - 172) / 365.25); // +1 at midsummer
+
+    const double halfDayMin = 6 * 60 + 120 * season; // sunrise → noon
+    const double twilightMin = 80 + 30 * season;
+    const double noon = (double)day * 86400 + 11 * 3600 + 41 * 60; // 4.7° E
+
+    const double minutes[6] = {
+        -(halfDayMin + twilightMin), // Fajr
+        -halfDayMin,                 // Sunrise
+        5,                           // Dhuhr
+        0.6 * halfDayMin,            // Asr
+        halfDayMin,                  // Maghrib
+        halfDayMin + twilightMin,    // Isha
+    };
+    for (int i = 0; i < 6; i++)
+        out[i] = (time_t)(std::floor((noon + minutes[i] * 60) / 60) * 60);
+}
+
+void SimWorld::modelDay(int32_t day, DailyPrayers &out)
+{
+    time_t instants[6];
+    modelInstants(day, instants);
+    const TimeZoneRules::Zone &zone = TimeZoneRules::current();
+    for (int i = 0; i < 6; i++)
+    {
+        const time_t local = zone.toLocal(instants[i]);
+        out[static_cast<PrayerType>(i)] = PrayerTime::fromMinutes((int)((local - (time_t)day * 86400) / 60));
+    }
+}
+
+std::vector<SimWorld::AdhanStart> &SimWorld::adhanStarts()
+{
+    return s_starts;
+}
+
+bool SimWorld::audioPlaying()
+{
+    return s_playing && s_monotonicUs < s_playStartUs + ADHAN_DURATION_US;
+}
+
+bool SimWorld::wakeLockHeld()
+{
+    return s_wakeLocks != 0;
+}
+
+void SimWorld::setScreenAlwaysOn(bool on)
+{
+    s_screenAlwaysOn = on;
+}
+
+void SimWorld::keepScreenOnUntil(uint64_t monotonicUs)
+{
+    if (monotonicUs > s_screenOnUntilUs)
+        s_screenOnUntilUs = monotonicUs;
+}
+
+bool SimWorld::screenOn()
+{
+    return s_screenAlwaysOn || s_monotonicUs < s_screenOnUntilUs;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// CLOCK
+// ═══════════════════════════════════════════════════════════════
+
+time_t SystemClock::now()
+{
+    const int64_t us = SimWorld::wallUs();
+    return (time_t)(us >= 0 ? us / 1000000 : (us - 999999) / 1000000);
+}
+
+int64_t SystemClock::nowUs()
+{
+    return SimWorld::wallUs();
+}
+
+uint64_t SystemClock::monotonicUs()
+{
+    return SimWorld::monotonicUs();
+}
+
+bool SystemClock::localTime(struct tm &out, uint32_t)
+{
+    const time_t local = TimeZoneRules::current().toLocal(now());
+    const int32_t day = (int32_t)(local / 86400);
+    const int secs = (int)(local - (time_t)day * 86400);
+    const CivilDate::Date date = CivilDate::civilFromDays(day);
+    out = {};
+    out.tm_year = date.year - 1900;
+    out.tm_mon = date.month - 1;
+    out.tm_mday = date.day;
+    out.tm_hour = secs / 3600;
+    out.tm_min = secs / 60 % 60;
+    out.tm_sec = secs % 60;
+    out.tm_wday = (int)((day % 7 + 11) % 7);
+    return date.year >= 2016; // getLocalTime's "clock is set" test
+}
+
+// ═══════════════════════════════════════════════════════════════
+// SETTINGS / NETWORK / DATA SOURCES
+// ═══════════════════════════════════════════════════════════════
+
+namespace SettingsManager
+{
+    int getPrayerMethod() { return 3; } // any calculated method: served by the model
+    bool getAdhanEnabled(PrayerType) { return true; }
+    double getLatitude() { return Config::TEST_LATITUDE; }
+    double getLongitude() { return Config::TEST_LONGITUDE; }
+    const char *getShortCityName() { return "Leuven"; }
+    int32_t getDiyanetId() { return Config::TEST_DIYANET_ILCE_ID; }
+    bool needsRecalculation() { return false; }
+    void clearRecalculationFlag() {}
+    const char *getTimezone() { return SimWorld::TIMEZONE; }
+}
+
+namespace Network
+{
+    bool isConnected() { return false; }
+}
+
+bool PrayerAPI::fetchMonthlyPrayerTimes(int) { return false; }
+bool PrayerAPI::getCachedPrayerTimes(const CivilDate::Date &, DailyPrayers &) { return false; }
+
+bool PrayerTable::lookupDiyanet(int32_t, const CivilDate::Date &, DailyPrayers &) { return false; }
+
+bool PrayerTable::lookupCalculated(int, double, double, const CivilDate::Date &date, DailyPrayers &out)
+{
+    SimWorld::modelDay(CivilDate::daysFromCivil(date), out);
+    return true;
+}
+
+bool PrayerTable::buildCalculated(int, double, double, const CivilDate::Date &, uint16_t) { return true; }
+
+int PrayerCalculator::calculateRange(int, double, double, const CalcDate &start, int days, DailyPrayers out[])
+{
+    for (int i = 0; i < days; i++)
+        SimWorld::modelDay(CivilDate::daysFromCivil(start) + i, out[i]);
+    return days;
+}
+
+PrayerCalculator::CalcDate PrayerCalculator::addDays(const CalcDate &date, int days)
+{
+    return CivilDate::civilFromDays(CivilDate::daysFromCivil(date) + days);
+}
+
+void Qibla::update(double, double) {}
+
+// ═══════════════════════════════════════════════════════════════
+// AUDIO / POWER
+// ═══════════════════════════════════════════════════════════════
+
+static PrayerType prayerOfFile(const char *filename)
+{
+    for (uint8_t i = 0; i < ADHAN_FILES.size(); i++)
+    {
+        if (!ADHAN_FILES[i].empty() && ADHAN_FILES[i] == std::string_view(filename))
+            return static_cast<PrayerType>(i);
+    }
+    return PrayerType::Sunrise;
+}
+
+static void recordStart(PrayerType prayer, bool prerolled)
+{
+    s_starts.push_back({prayer, SimWorld::wallUs(), prerolled});
+    s_playing = true;
+    s_playStartUs = s_monotonicUs;
+}
+
+bool playAudioFile(const char *filename)
+{
+    s_prepared = false;
+    recordStart(prayerOfFile(filename), false);
+    return true;
+}
+
+bool prepareAudioFile(const char *filename)
+{
+    s_preparedPrayer = prayerOfFile(filename);
+    s_prepared = true;
+    return true;
+}
+
+bool startPreparedAudio()
+{
+    if (!s_prepared)
+        return false;
+    s_prepared = false;
+    recordStart(s_preparedPrayer, true);
+    return true;
+}
+
+void cancelPreparedAudio()
+{
+    s_prepared = false;
+}
+
+bool takeStartLatency(uint32_t &) { return false; } // no audio task to measure
+
+bool isAudioFinished()
+{
+    if (s_playing && !SimWorld::audioPlaying())
+        s_playing = false;
+    return !s_playing;
+}
+
+void setVolume(uint8_t) {}
+void setTargetVolume(uint8_t) {}
+
+namespace PowerManager
+{
+    bool isScreenOn() { return SimWorld::screenOn(); }
+
+    uint8_t acquireWakeLock(const char *)
+    {
+        s_wakeLocks++;
+        return 0;
+    }
+
+    void releaseWakeLock(uint8_t)
+    {
+        if (s_wakeLocks)
+            s_wakeLocks--;
+    }
+
+    void wakeScreen()
+    {
+        SimWorld::keepScreenOnUntil(s_monotonicUs + 60ULL * 1000000);
+        Scheduler::after(Scheduler::Task::CLOCK, 0);
+        Scheduler::after(Scheduler::Task::PRAYER, 0);
+    }
+}
@@ -0,0 +1,55 @@
+/**
+ * @file sim_world.h
+ * @brief Shared state of the prayer simulator (env:prayer_sim)
+ *
+ * The virtual clock behind SystemClock, the synthetic prayer-time model the
+ * PrayerTable stand-in serves, and what the AudioPlayer / PowerManager
+ * stand-ins observed. prayer_sim.cpp drives it, sim_stubs.cpp implements
+ * the firmware functions on top of it.
+ */
+#pragma once
+
+#include "prayer_types.h"
+#include "daily_prayers.h"
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+namespace SimWorld
+{
+    // Leuven (Config::TEST_LATITUDE/LONGITUDE), Central European rules
+    constexpr const char *TIMEZONE = "CET-1CEST,M3.5.0,M10.5.0/3";
+    constexpr uint64_t ADHAN_DURATION_US = 180ULL * 1000000; // simulated playback length
+
+    // ── Virtual clock ──
+    // Wall = UTC µs, stepped by NTP/RTC; monotonic = µs since boot, never stepped
+    void startClock(int64_t wallUs);
+    void advance(uint64_t us);   // time passes (both clocks)
+    void stepWall(int64_t us);   // clock correction (wall only)
+    int64_t wallUs();
+    uint64_t monotonicUs();
+
+    // ── Prayer-time model ──
+    // UTC instants (whole minutes) of the six times of local day `day`
+    // (days since 1970-01-01); a smooth seasonal curve, not astronomy
+    void modelInstants(int32_t day, time_t out[6]);
+    // The same as local wall-clock times, as a calculated table would store them
+    void modelDay(int32_t day, DailyPrayers &out);
+
+    // ── Observed ──
+    struct AdhanStart
+    {
+        PrayerType prayer;
+        int64_t wallUs;
+        bool prerolled;
+    };
+    std::vector<AdhanStart> &adhanStarts();
+    bool audioPlaying();   // started and not past ADHAN_DURATION_US
+    bool wakeLockHeld();
+
+    // Screen lit (PowerManager::isScreenOn): always in the first phase, then
+    // only for a while after each wake
+    void setScreenAlwaysOn(bool on);
+    void keepScreenOnUntil(uint64_t monotonicUs);
+    bool screenOn();
+}
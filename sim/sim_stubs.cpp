@@ -0,0 +1,99 @@
+/**
+ * @file sim_stubs.cpp
+ * @brief Host stand-ins for the firmware modules the UI pages call into
+ *
+ * Only the functions referenced by ui_*.cpp are provided. State goes through
+ * g_state exactly like on the device, so widget callbacks (volume slider,
+ * sleep toggle, WiFi button) behave the same in the simulator.
+ */
+
+#include "app_state.h"
+#include "settings_manager.h"
+#include "volume_control.h"
+#include "network.h"
+#include "wifi_portal.h"
+#include "lvgl_display.h"
+#include "power_manager.h"
+#include "ui_page_settings.h"
+#include <WiFi.h>
+#include <lvgl.h>
+
+WiFiClass WiFi;
+
+namespace SettingsManager
+{
+    static PowerMode powerMode = PowerMode::ALWAYS_ON;
+
+    PowerMode getPowerMode()
+    {
+        return powerMode;
+    }
+
+    bool setPowerMode(PowerMode mode)
+    {
+        powerMode = mode;
+        return true;
+    }
+}
+
+namespace VolumeControl
+{
+    void applyRuntime(uint8_t volumePct)
+    {
+        AppStateHelper::setVolume(volumePct);
+    }
+
+    bool persist(uint8_t volumePct)
+    {
+        (void)volumePct;
+        return true;
+    }
+}
+
+namespace Network
+{
+    bool isConnected()
+    {
+        return g_state.wifiState == WifiState::CONNECTED;
+    }
+}
+
+namespace WiFiPortal
+{
+    bool isActive()
+    {
+        return g_state.wifiState == WifiState::PORTAL;
+    }
+}
+
+namespace PowerManager
+{
+    void reportActivity()
+    {
+        // No dim / screen-off timers in the simulator
+    }
+}
+
+namespace LvglDisplay
+{
+    void setBacklight(uint8_t brightness)
+    {
+        (void)brightness;
+    }
+
+    void goToPortalPage()
+    {
+        lv_obj_t *portalScr = UiPageSettings::getPortalScreen();
+        if (portalScr)
+            lv_scr_load(portalScr);
+    }
+
+    bool leavePortalPageIfActive()
+    {
+        lv_obj_t *portalScr = UiPageSettings::getPortalScreen();
+        if (!portalScr || lv_scr_act() != portalScr)
+            return false;
+        lv_scr_load(UiPageSettings::getScreen());
+        return true;
+    }
+}
@@ -0,0 +1,58 @@
+/**
+ * @file Arduino.h
+ * @brief Host stand-in for the Arduino core (env:sim, env:prayer_sim)
+ *
+ * The UI sources never call into the Arduino core, but some of the headers
+ * they include (audio_player.h) pull it in. The prayer simulator also needs
+ * Serial (logs, can be silenced) and the FreeRTOS task notification used by
+ * Scheduler::wait(), which the simulator never calls. Only the basics are
+ * provided.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+
+class SimSerial
+{
+public:
+    bool enabled = true;
+
+    int printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        if (!enabled)
+            return 0;
+        va_list args;
+        va_start(args, format);
+        const int n = vprintf(format, args);
+        va_end(args);
+        return n;
+    }
+
+    void print(const char *text)
+    {
+        if (enabled)
+            fputs(text, stdout);
+    }
+
+    void println(const char *text = "")
+    {
+        if (enabled)
+            puts(text);
+    }
+
+    void flush() { fflush(stdout); }
+};
+
+inline SimSerial Serial;
+
+// FreeRTOS task notification (Scheduler::init / notify / wait)
+typedef void *TaskHandle_t;
+typedef uint32_t TickType_t;
+#define portTICK_PERIOD_MS 1
+#define pdTRUE 1
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return nullptr; }
+inline void xTaskNotifyGive(TaskHandle_t) {}
+inline uint32_t ulTaskNotifyTake(int, TickType_t) { return 0; }
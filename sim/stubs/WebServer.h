@@ -0,0 +1,5 @@
+/**
+ * @file WebServer.h
+ * @brief Empty host stand-in (env:sim only) — wifi_portal.h includes it, the UI never uses it
+ */
+#pragma once
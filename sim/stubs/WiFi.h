@@ -0,0 +1,22 @@
+/**
+ * @file WiFi.h
+ * @brief Host stand-in for the ESP32 WiFi class (env:sim only)
+ *
+ * Covers what the settings page reads: WiFi.localIP().toString().c_str().
+ */
+#pragma once
+
+#include <string>
+
+struct IPAddress
+{
+    std::string toString() const { return "192.168.1.42"; }
+};
+
+class WiFiClass
+{
+public:
+    IPAddress localIP() const { return IPAddress(); }
+};
+
+extern WiFiClass WiFi;
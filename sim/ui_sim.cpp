@@ -0,0 +1,382 @@
+/**
+ * @file ui_sim.cpp
+ * @brief Headless UI simulator — renders the real pages on the host
+ *
+ * Builds UiPageHome / UiPageClock / UiPageSettings / UiPageStatus and
+ * UiStateReader against LVGL with an in-memory display driver (same 480×320
+ * landscape, partial mode, full-screen buffer as lvgl_display.cpp) and drives
+ * them through g_state like main.cpp does.
+ *
+ * For every page and every scripted state change it reports:
+ *   - render time   host wall-clock spent in lv_refr_now()
+ *   - invalidated   areas / pixels LVGL queued before joining them
+ *   - flushed       areas / pixels / bytes handed to flush_cb (= QSPI traffic)
+ * and dumps a PNG snapshot of the resulting frame.
+ *
+ * Usage:  pio run -e sim && .pio/build/sim/program [output_dir]
+ */
+
+#include <lvgl.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "app_state.h"
+#include "ui_state_reader.h"
+#include "ui_page_home.h"
+#include "ui_page_clock.h"
+#include "ui_page_settings.h"
+#include "ui_page_status.h"
+#include "ui_components.h"
+#include "ui_sim_tick.h"
+#include "png_writer.h"
+
+// ═══════════════════════════════════════════════════════════════
+// VIRTUAL CLOCK
+// ═══════════════════════════════════════════════════════════════
+
+static uint32_t simTickMs = 0;
+
+extern "C" uint32_t ui_sim_tick_ms(void)
+{
+    return simTickMs;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// IN-MEMORY DISPLAY DRIVER
+// ═══════════════════════════════════════════════════════════════
+
+// Logical resolution (landscape) — matches lvgl_display.cpp
+static const uint16_t SCR_W = 480;
+static const uint16_t SCR_H = 320;
+
+// One simulated frame = LVGL's default refresh period
+static const uint32_t FRAME_MS = LV_DISP_DEF_REFR_PERIOD;
+
+// Simulated time each scenario runs for: long enough for the 50 ms
+// UiStateReader timer and the toggle/slider animations to settle.
+static const uint32_t SETTLE_MS = 1000;
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_color_t *renderBuf = nullptr;
+static lv_color_t *frameBuf = nullptr; // what the panel would show
+static lv_disp_drv_t disp_drv;
+static lv_disp_t *disp = nullptr;
+
+struct Stats
+{
+    uint32_t frames = 0;    // refreshes that flushed something
+    uint32_t invAreas = 0;  // areas queued by lv_obj_invalidate (before join)
+    uint64_t invPixels = 0; // sum of their sizes (overlaps counted twice)
+    uint32_t flushes = 0;
+    uint64_t flushedPixels = 0;
+    double renderMs = 0;
+};
+
+static Stats current;
+
+static void sim_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    const int32_t w = lv_area_get_width(area);
+    const int32_t h = lv_area_get_height(area);
+
+    // Partial mode: color_p is a compact w × h block
+    for (int32_t y = 0; y < h; y++)
+        memcpy(&frameBuf[(area->y1 + y) * SCR_W + area->x1], &color_p[y * w], w * sizeof(lv_color_t));
+
+    current.flushes++;
+    current.flushedPixels += (uint64_t)w * h;
+    lv_disp_flush_ready(drv);
+}
+
+static void initDisplay()
+{
+    lv_init();
+
+    size_t buf_size = SCR_W * SCR_H;
+    renderBuf = new lv_color_t[buf_size];
+    frameBuf = new lv_color_t[buf_size]();
+    lv_disp_draw_buf_init(&draw_buf, renderBuf, nullptr, buf_size);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = SCR_W;
+    disp_drv.ver_res = SCR_H;
+    disp_drv.flush_cb = sim_flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp = lv_disp_drv_register(&disp_drv);
+
+    // Refreshes are driven (and timed) by runFrames(), not by lv_timer_handler()
+    lv_timer_pause(disp->refr_timer);
+}
+
+// ═══════════════════════════════════════════════════════════════
+// FRAME LOOP
+// ═══════════════════════════════════════════════════════════════
+
+// Advance the virtual clock by `ms`, one refresh period at a time.
+// Each step runs the LVGL timers (UiStateReader, animations), then records
+// the pending invalidations and times the refresh that renders them.
+static Stats runFrames(uint32_t ms)
+{
+    current = Stats();
+    for (uint32_t t = 0; t < ms; t += FRAME_MS)
+    {
+        simTickMs += FRAME_MS;
+        lv_timer_handler();
+
+        if (disp->inv_p == 0)
+            continue;
+
+        for (uint16_t i = 0; i < disp->inv_p; i++)
+        {
+            current.invAreas++;
+            current.invPixels += lv_area_get_size(&disp->inv_areas[i]);
+        }
+
+        const uint32_t flushesBefore = current.flushes;
+        auto start = std::chrono::steady_clock::now();
+        lv_refr_now(disp);
+        auto end = std::chrono::steady_clock::now();
+        current.renderMs += std::chrono::duration<double, std::milli>(end - start).count();
+        if (current.flushes != flushesBefore)
+            current.frames++;
+    }
+    return current;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// REPORT + SNAPSHOTS
+// ═══════════════════════════════════════════════════════════════
+
+static std::string outDir = "sim_out";
+static int snapshotIndex = 0;
+
+static void saveSnapshot(const char *name)
+{
+    std::vector<uint8_t> rgb((size_t)SCR_W * SCR_H * 3);
+    for (size_t i = 0; i < (size_t)SCR_W * SCR_H; i++)
+    {
+        // lv_color_to32 undoes LV_COLOR_16_SWAP
+        const uint32_t c = lv_color_to32(frameBuf[i]);
+        rgb[i * 3 + 0] = (uint8_t)(c >> 16);
+        rgb[i * 3 + 1] = (uint8_t)(c >> 8);
+        rgb[i * 3 + 2] = (uint8_t)c;
+    }
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%02d_%s.png", outDir.c_str(), snapshotIndex++, name);
+    if (!PngWriter::writeRgb(path, rgb.data(), SCR_W, SCR_H))
+        printf("[Sim] ERROR: cannot write %s\n", path);
+}
+
+static void printHeader()
+{
+    printf("\n%-26s %6s %6s %9s %7s %9s %9s %10s\n",
+           "scenario", "frames", "inv", "inv px", "flushes", "flush px", "KB", "render ms");
+    printf("%-26s %6s %6s %9s %7s %9s %9s %10s\n",
+           "--------", "------", "---", "------", "-------", "--------", "--", "---------");
+}
+
+static void report(const char *name, const Stats &s)
+{
+    printf("%-26s %6u %6u %9llu %7u %9llu %9.1f %10.3f\n",
+           name, s.frames, s.invAreas, (unsigned long long)s.invPixels,
+           s.flushes, (unsigned long long)s.flushedPixels,
+           s.flushedPixels * sizeof(lv_color_t) / 1024.0, s.renderMs);
+    saveSnapshot(name);
+}
+
+// ═══════════════════════════════════════════════════════════════
+// STUB STATE
+// ═══════════════════════════════════════════════════════════════
+
+// A plausible evening in Istanbul, between Asr and Maghrib
+static void seedState()
+{
+    AppStateHelper::setTime(17, 42, 5);
+    g_state.gregorianFull = "8 Mart 2026 \xC2\xB7 Pazar";
+    AppStateHelper::setDate("\xC2\xB7 8 Mart \xC2\xB7 Pazar");
+    AppStateHelper::setLocation("Istanbul");
+    g_state.hijriDay = 18;
+    g_state.hijriMonth = 9;
+    AppStateHelper::setHijriDate("18 Ramazan 1447");
+    AppStateHelper::setPrayerTimes("05:41", "07:06", "13:17", "16:38", "19:18", "20:37", 3);
+    AppStateHelper::setNextPrayer("Ak\xC5\x9F"
+                                  "am",
+                                  "19:18");
+    AppStateHelper::setCountdown(5755);
+    AppStateHelper::setProgress(42);
+    AppStateHelper::setWifiState(WifiState::CONNECTED, "192.168.1.42");
+    AppStateHelper::setVolume(80);
+    AppStateHelper::setMuted(false);
+    g_state.markDirty(DirtyFlag::ALL & ~DirtyFlag::STATUS_SCREEN);
+}
+
+// ═══════════════════════════════════════════════════════════════
+// SCENARIOS
+// ═══════════════════════════════════════════════════════════════
+
+struct Scenario
+{
+    const char *name;
+    void (*apply)();
+};
+
+static void tickSecond()
+{
+    int8_t s = g_state.second + 1;
+    int8_t m = g_state.minute;
+    if (s == 60)
+    {
+        s = 0;
+        m++;
+    }
+    AppStateHelper::setTime(g_state.hour, m, s);
+    AppStateHelper::setCountdown(g_state.secondsToNext - 1);
+}
+
+static void tickMinute()
+{
+    AppStateHelper::setTime(g_state.hour, g_state.minute + 1, 0);
+    AppStateHelper::setCountdown(g_state.secondsToNext - 60);
+    AppStateHelper::setProgress(g_state.activePrayerProgress + 1);
+}
+
+static void nextPrayer()
+{
+    AppStateHelper::setTime(19, 18, 0);
+    AppStateHelper::setPrayerTimes("05:41", "07:06", "13:17", "16:38", "19:18", "20:37", 4);
+    AppStateHelper::setNextPrayer("Yats\xC4\xB1", "20:37");
+    AppStateHelper::setCountdown(4740);
+    AppStateHelper::setProgress(0);
+}
+
+static void toggleMute()
+{
+    AppStateHelper::setMuted(!g_state.muted);
+}
+
+static void changeVolume()
+{
+    AppStateHelper::setVolume(g_state.volume >= 50 ? 35 : 80);
+}
+
+static void wifiDrop()
+{
+    AppStateHelper::setWifiState(WifiState::DISCONNECTED);
+}
+
+static void newDay()
+{
+    AppStateHelper::setTime(0, 0, 0);
+    g_state.gregorianFull = "9 Mart 2026 \xC2\xB7 Pazartesi";
+    AppStateHelper::setDate("\xC2\xB7 9 Mart \xC2\xB7 Pazartesi");
+    g_state.hijriDay = 19;
+    AppStateHelper::setHijriDate("19 Ramazan 1447");
+    AppStateHelper::setPrayerTimes("05:39", "07:04", "13:17", "16:39", "19:19", "20:38", -1);
+}
+
+static void loadScreen(lv_obj_t *scr)
+{
+    lv_scr_load(scr);
+}
+
+static void runPage(const char *name, lv_obj_t *scr)
+{
+    loadScreen(scr);
+    report(name, runFrames(SETTLE_MS));
+}
+
+static void runStateChanges(const char *page, const Scenario *list, size_t count)
+{
+    char name[64];
+    for (size_t i = 0; i < count; i++)
+    {
+        list[i].apply();
+        snprintf(name, sizeof(name), "%s/%s", page, list[i].name);
+        report(name, runFrames(SETTLE_MS));
+    }
+}
+
+static void runStatus(const char *name, void (*show)())
+{
+    show();
+    report(name, runFrames(SETTLE_MS));
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+        outDir = argv[1];
+    std::filesystem::create_directories(outDir);
+
+    initDisplay();
+    UiStateReader::init();
+
+    // Same order as LvglDisplay::showPrayerScreen()
+    UiComponents::createSharedAssets();
+    UiPageHome::create();
+    UiPageClock::create();
+    UiPageSettings::create();
+    seedState();
+
+    printf("[Sim] %ux%u, partial mode, %u ms/frame, %u ms per scenario -> %s/\n",
+           SCR_W, SCR_H, FRAME_MS, SETTLE_MS, outDir.c_str());
+
+    // ── Full-page renders (page switch = one full flush) ──────────
+    printHeader();
+    runPage("home", UiPageHome::getScreen());
+    runPage("clock", UiPageClock::getScreen());
+    runPage("settings", UiPageSettings::getScreen());
+
+    // ── State changes on the page that shows them ─────────────────
+    static const Scenario homeChanges[] = {
+        {"tick_second", tickSecond},
+        {"tick_minute", tickMinute},
+        {"next_prayer", nextPrayer},
+        {"mute", toggleMute},
+        {"unmute", toggleMute},
+    };
+    static const Scenario clockChanges[] = {
+        {"tick_second", tickSecond},
+        {"tick_minute", tickMinute},
+        {"new_day", newDay},
+    };
+    static const Scenario settingsChanges[] = {
+        {"volume", changeVolume},
+        {"wifi_drop", wifiDrop},
+        {"mute", toggleMute},
+    };
+
+    printHeader();
+    loadScreen(UiPageHome::getScreen());
+    runFrames(SETTLE_MS);
+    runStateChanges("home", homeChanges, sizeof(homeChanges) / sizeof(homeChanges[0]));
+
+    loadScreen(UiPageClock::getScreen());
+    runFrames(SETTLE_MS);
+    runStateChanges("clock", clockChanges, sizeof(clockChanges) / sizeof(clockChanges[0]));
+
+    loadScreen(UiPageSettings::getScreen());
+    runFrames(SETTLE_MS);
+    runStateChanges("settings", settingsChanges, sizeof(settingsChanges) / sizeof(settingsChanges[0]));
+
+    // ── Status screens (UiStateReader switches to UiPageStatus) ───
+    printHeader();
+    runStatus("status/connecting", []()
+              { AppStateHelper::showConnecting("EvAgi_5G"); });
+    runStatus("status/portal", []()
+              { AppStateHelper::showPortal("AdhanSettings", "12345678", "192.168.4.1"); });
+    runStatus("status/message", []()
+              { AppStateHelper::showMessage("Guncelleniyor", "Namaz vakitleri aliniyor"); });
+    runStatus("status/error", []()
+              { AppStateHelper::showError("Baglanti Hatasi", "WiFi bulunamadi"); });
+    runStatus("status/cleared", []()
+              { AppStateHelper::clearStatusScreen(); });
+
+    printf("\n[Sim] %d snapshots written to %s/\n", snapshotIndex, outDir.c_str());
+    return 0;
+}
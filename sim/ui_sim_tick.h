@@ -0,0 +1,25 @@
+/**
+ * @file ui_sim_tick.h
+ * @brief Virtual LVGL tick for the headless simulator (env:sim)
+ *
+ * lv_conf.h uses this as LV_TICK_CUSTOM when UI_SIM is defined, so timers and
+ * animations advance only when ui_sim.cpp steps the clock — runs are
+ * reproducible and independent of host speed.
+ */
+#ifndef UI_SIM_TICK_H
+#define UI_SIM_TICK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    uint32_t ui_sim_tick_ms(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_SIM_TICK_H
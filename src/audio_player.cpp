@@ -3,6 +3,7 @@
 #include "pmu_manager.h"
 #include <LittleFS.h>
 #include "es8311.h"
+#include <esp_timer.h>
 #include <cmath>
 
 static constexpr int AUDIO_BUFFER_SIZE = 8000;
@@ -21,6 +22,9 @@ static es8311_handle_t codecHandle = NULL;
 static uint8_t s_currentRampVolume = AudioConfig::DEFAULT_VOLUME;
 static uint8_t s_targetRampVolume = AudioConfig::DEFAULT_VOLUME;
 static uint32_t s_lastVolumeRampMs = 0;
+static bool s_prepared = false;              // file opened and paused by prepareAudioFile()
+static volatile int64_t s_startUs = 0;       // playback released, 0 = not measuring
+static volatile int64_t s_firstFrameUs = 0;  // first audio.loop() after the release
 
 static void applyCodecVolume(uint8_t vol, bool syncRampState)
 {
@@ -125,6 +129,9 @@ void audioTask(void *parameter)
             audioLock();
             audio.loop();
             audioUnlock();
+            // First pass decodes and queues the first frames to I2S DMA
+            if (s_startUs && !s_firstFrameUs)
+                s_firstFrameUs = esp_timer_get_time();
             vTaskDelay(1);
         }
     }
@@ -163,6 +170,7 @@ bool audioPlayerInit()
 
 bool playAudioFile(const char *filename)
 {
+    cancelPreparedAudio();
     if (!LittleFS.exists(filename))
     {
         Serial.printf("[Audio] File not found: %s\n", filename);
@@ -173,6 +181,8 @@ bool playAudioFile(const char *filename)
     enableAmp();
     delay(CODEC_STABILIZE_MS);
     audioFinished = false;
+    s_firstFrameUs = 0;
+    s_startUs = esp_timer_get_time();
     audioLock();
     audio.connecttoFS(LittleFS, filename);
     audioUnlock();
@@ -184,6 +194,70 @@ bool playAudioFile(const char *filename)
     return true;
 }
 
+bool prepareAudioFile(const char *filename)
+{
+    cancelPreparedAudio();
+    if (!codecHandle && !initCodec()) // resume after light sleep may have failed
+        return false;
+    if (!LittleFS.exists(filename))
+    {
+        Serial.printf("[Audio] File not found: %s\n", filename);
+        return false;
+    }
+
+    // Amp on with the codec still muted: silent until startPreparedAudio()
+    PmuManager::setSpeakerAmpEnabled(true);
+    delay(CODEC_STABILIZE_MS);
+    audioFinished = false;
+    audioLock();
+    s_prepared = audio.connecttoFS(LittleFS, filename) && audio.pauseResume();
+    audioUnlock();
+    if (!s_prepared)
+    {
+        Serial.printf("[Audio] Pre-roll failed: %s\n", filename);
+        stopAudio();
+        return false;
+    }
+    Serial.printf("[Audio] Pre-rolled: %s\n", filename);
+    return true;
+}
+
+bool startPreparedAudio()
+{
+    if (!s_prepared)
+        return false;
+    s_prepared = false;
+    s_firstFrameUs = 0;
+    s_startUs = esp_timer_get_time();
+
+    audioLock();
+    audio.pauseResume();
+    audioUnlock();
+    if (codecHandle)
+        es8311_voice_mute(codecHandle, false);
+    if (audioTaskHandle)
+        xTaskNotifyGive(audioTaskHandle);
+    return true;
+}
+
+void cancelPreparedAudio()
+{
+    if (!s_prepared)
+        return;
+    s_prepared = false;
+    stopAudio();
+    Serial.println("[Audio] Pre-roll cancelled");
+}
+
+bool takeStartLatency(uint32_t &us)
+{
+    if (!s_startUs || !s_firstFrameUs)
+        return false;
+    us = static_cast<uint32_t>(s_firstFrameUs - s_startUs);
+    s_startUs = 0;
+    return true;
+}
+
 bool isPlaying()
 {
     return !audioFinished && audio.isRunning();
@@ -196,6 +270,7 @@ bool isAudioFinished()
 
 void stopAudio()
 {
+    s_prepared = false;
     audioLock();
     audio.stopSong();
     audioUnlock();
@@ -1,8 +1,12 @@
 #include "display_ticker.h"
 #include "app_state.h"
 #include "hijri_date.h"
+#include "religious_calendar.h"
 #include "locale_tr.h"
 #include "pmu_manager.h"
+#include "power_manager.h"
+#include "scheduler.h"
+#include "system_clock.h"
 #include "network.h"
 #include <WiFi.h>
 #include <Arduino.h>
@@ -10,7 +14,6 @@
 namespace DisplayTicker
 {
     static int s_lastMinute = -1;
-    static unsigned long s_lastCheck = 0;
     static unsigned long s_lastSignalCheck = 0;
 
     // Push Gregorian + Hijri date strings into AppState.
@@ -29,40 +32,68 @@ namespace DisplayTicker
                  t.tm_mday, LocaleTR::MONTHS[t.tm_mon], 1900 + t.tm_year, LocaleTR::DAYS[t.tm_wday]);
         g_state.gregorianFull = gbuf;
 
-        HijriDate h = gregorianToHijri(1900 + t.tm_year, t.tm_mon + 1, t.tm_mday);
+        // Hijri date and events from the precomputed calendar (tabular fallback)
+        using ReligiousCalendar::Event;
+        ReligiousCalendar::DayInfo info;
+        const int32_t day = CivilDate::daysFromCivil(1900 + t.tm_year, t.tm_mon + 1, t.tm_mday);
+        if (!ReligiousCalendar::describe(day, info))
+            info = {ReligiousCalendar::tabularHijri(day), ReligiousCalendar::tabularMonthLength(day),
+                    Event::NONE, 0, Event::NONE, -1};
+        const HijriDate &h = info.hijri;
         g_state.hijriDay = h.day;
         g_state.hijriMonth = h.month;
+        g_state.hijriMonthLength = info.monthLength;
         char hbuf[32];
         snprintf(hbuf, sizeof(hbuf), "%d %s %d", h.day, getHijriMonth(h.month), h.year);
         AppStateHelper::setHijriDate(hbuf);
+
+        // "Kurban Bayramı 2. Gün"
+        char special[32];
+        if (info.special == Event::RAMAZAN_BAYRAMI || info.special == Event::KURBAN_BAYRAMI)
+            snprintf(special, sizeof(special), "%s %u. G\xC3\xBCn", ReligiousCalendar::eventName(info.special),
+                     info.ordinal);
+        else
+            snprintf(special, sizeof(special), "%s", ReligiousCalendar::eventName(info.special));
+        AppStateHelper::setCalendarEvents(special, ReligiousCalendar::eventName(info.next), info.daysToNext);
     }
 
     static void pushNtpStatus()
     {
         struct tm tmp;
-        AppStateHelper::setNtpSynced(getLocalTime(&tmp, 0));
+        AppStateHelper::setNtpSynced(SystemClock::localTime(tmp, 0));
     }
 
-    void forceUpdate()
+    static void pushWifiSignal()
     {
-        struct tm t;
-        if (!getLocalTime(&t))
-            return;
-        AppStateHelper::setTime(t.tm_hour, t.tm_min, t.tm_sec);
-        pushDateTime(t);
-        pushNtpStatus();
-        s_lastMinute = t.tm_hour * 60 + t.tm_min;
+        // WiFi signal: RSSI → 0-3 bars
+        uint8_t bars = 0;
+        if (WiFi.isConnected())
+        {
+            int rssi = WiFi.RSSI();
+            if (rssi > -50)
+                bars = 3;
+            else if (rssi > -70)
+                bars = 2;
+            else if (rssi > -85)
+                bars = 1;
+        }
+        AppStateHelper::setWifiSignal(bars);
     }
 
-    void tick()
+    // Next whole second while the clock is visible, next minute otherwise
+    static void armNext()
     {
-        unsigned long now = millis();
-        if (now - s_lastCheck < 1000)
-            return;
-        s_lastCheck = now;
+        const time_t now = SystemClock::now();
+        Scheduler::at(Scheduler::Task::CLOCK,
+                      PowerManager::isScreenOn() ? now + 1 : now - now % 60 + 60);
+    }
+
+    static void onClockDue()
+    {
+        armNext();
 
         struct tm t;
-        if (!getLocalTime(&t))
+        if (!SystemClock::localTime(t, 0))
             return;
 
         // Update time every second (Clock screen needs seconds)
@@ -78,24 +109,29 @@ namespace DisplayTicker
         }
 
         // Update WiFi signal every 5 seconds
+        unsigned long now = SystemClock::uptimeMs();
         if (now - s_lastSignalCheck >= 5000)
         {
             s_lastSignalCheck = now;
-
-            // WiFi signal: RSSI → 0-3 bars
-            uint8_t bars = 0;
-            if (WiFi.isConnected())
-            {
-                int rssi = WiFi.RSSI();
-                if (rssi > -50)
-                    bars = 3;
-                else if (rssi > -70)
-                    bars = 2;
-                else if (rssi > -85)
-                    bars = 1;
-            }
-            AppStateHelper::setWifiSignal(bars);
+            pushWifiSignal();
         }
     }
 
+    void init()
+    {
+        Scheduler::on(Scheduler::Task::CLOCK, onClockDue);
+        armNext();
+    }
+
+    void forceUpdate()
+    {
+        struct tm t;
+        if (!SystemClock::localTime(t))
+            return;
+        AppStateHelper::setTime(t.tm_hour, t.tm_min, t.tm_sec);
+        pushDateTime(t);
+        pushNtpStatus();
+        s_lastMinute = t.tm_hour * 60 + t.tm_min;
+    }
+
 } // namespace DisplayTicker
@@ -13,6 +13,13 @@ static constexpr uint8_t REG_CTRL1 = 0x02;
 static constexpr uint8_t REG_STATUS0 = 0x2E;
 static constexpr uint8_t REG_STATUS1 = 0x2F;
 
+// Mount detection: gravity along the panel's short edge (QMI8658 X on this
+// board). Below the threshold the device is lying flat or on its side.
+static constexpr bool FLIPPED_WHEN_X_POSITIVE = true;
+static constexpr float MOUNT_THRESHOLD_G = 0.5f;
+static constexpr uint8_t MOUNT_SAMPLES = 4;
+static constexpr uint32_t MOUNT_TIMEOUT_MS = 100;
+
 static bool writeRawReg(uint8_t reg, uint8_t value)
 {
     Wire.beginTransmission(QMI8658_L_SLAVE_ADDRESS);
@@ -137,4 +144,46 @@ namespace ImuManager
         wakeOnMotionArmed = false;
     }
 
+    Mount readMount()
+    {
+        if (!initialized || wakeOnMotionArmed)
+            return Mount::UNKNOWN;
+
+        if (qmi.configAccelerometer(SensorQMI8658::ACC_RANGE_2G, SensorQMI8658::ACC_ODR_125Hz) != 0 ||
+            !qmi.enableAccelerometer())
+        {
+            Serial.println("[IMU] Accelerometer start failed");
+            qmi.powerDown();
+            return Mount::UNKNOWN;
+        }
+
+        float sum = 0;
+        uint8_t samples = 0;
+        const uint32_t start = millis();
+        while (samples < MOUNT_SAMPLES && millis() - start < MOUNT_TIMEOUT_MS)
+        {
+            float x, y, z;
+            if (qmi.getDataReady() && qmi.getAccelerometer(x, y, z))
+            {
+                sum += x;
+                samples++;
+            }
+            else
+            {
+                delay(2);
+            }
+        }
+        qmi.disableAccelerometer();
+        qmi.powerDown();
+
+        if (samples == 0)
+            return Mount::UNKNOWN;
+        const float gx = sum / samples;
+        if (gx > MOUNT_THRESHOLD_G)
+            return FLIPPED_WHEN_X_POSITIVE ? Mount::FLIPPED : Mount::NORMAL;
+        if (gx < -MOUNT_THRESHOLD_G)
+            return FLIPPED_WHEN_X_POSITIVE ? Mount::NORMAL : Mount::FLIPPED;
+        return Mount::UNKNOWN;
+    }
+
 } // namespace ImuManager
@@ -0,0 +1,75 @@
+#include "loop_metrics.h"
+#include "system_clock.h"
+#include <Arduino.h>
+
+namespace
+{
+    constexpr uint32_t CYCLE_SAFE_MS = 10000; // well inside the counter's wrap at 240 MHz
+
+    constexpr const char *NAMES[LoopMetrics::PROBE_COUNT] = {
+        "display", "portal", "wifi", "prayer", "audio", "scheduler", "server", "pass",
+    };
+
+    static LoopMetrics::Histogram s_histograms[LoopMetrics::PROBE_COUNT];
+    static uint32_t s_sleeps = 0;
+    static uint32_t s_cyclesPerUs = 0;
+    static unsigned long s_windowStartMs = 0;
+}
+
+LoopMetrics::Stamp LoopMetrics::start()
+{
+    return {ESP.getCycleCount(), xTaskGetTickCount(), s_sleeps};
+}
+
+void LoopMetrics::stop(Probe probe, const Stamp &since)
+{
+    const uint32_t cycles = ESP.getCycleCount() - since.cycles;
+    const uint32_t elapsedMs = (xTaskGetTickCount() - since.ticks) * portTICK_PERIOD_MS;
+    if (since.sleeps != s_sleeps)
+        return; // light sleep in between: neither counter is meaningful
+
+    if (s_cyclesPerUs == 0)
+        s_cyclesPerUs = ESP.getCpuFreqMHz();
+    const uint32_t us = elapsedMs < CYCLE_SAFE_MS ? cycles / s_cyclesPerUs : elapsedMs * 1000;
+    s_histograms[static_cast<uint8_t>(probe)].add(us);
+}
+
+void LoopMetrics::lightSleepDone()
+{
+    s_sleeps++;
+}
+
+const char *LoopMetrics::name(Probe probe)
+{
+    return NAMES[static_cast<uint8_t>(probe)];
+}
+
+const LoopMetrics::Histogram &LoopMetrics::histogram(Probe probe)
+{
+    return s_histograms[static_cast<uint8_t>(probe)];
+}
+
+uint32_t LoopMetrics::windowMs()
+{
+    return SystemClock::uptimeMs() - s_windowStartMs;
+}
+
+void LoopMetrics::reset()
+{
+    for (Histogram &histogram : s_histograms)
+        histogram.reset();
+    s_windowStartMs = SystemClock::uptimeMs();
+}
+
+void LoopMetrics::dump()
+{
+    Serial.printf("[Metrics] Loop timing over %lu s (us)\n", (unsigned long)(windowMs() / 1000));
+    Serial.printf("[Metrics] %-10s %9s %7s %7s %7s %9s %7s\n", "probe", "count", "min", "p50", "p99", "max", "mean");
+    for (uint8_t i = 0; i < PROBE_COUNT; i++)
+    {
+        const Histogram &h = s_histograms[i];
+        Serial.printf("[Metrics] %-10s %9lu %7lu %7lu %7lu %9lu %7lu\n", NAMES[i],
+                      (unsigned long)h.count(), (unsigned long)h.min(), (unsigned long)h.percentile(50),
+                      (unsigned long)h.percentile(99), (unsigned long)h.max(), (unsigned long)h.mean());
+    }
+}
@@ -19,9 +19,11 @@
 #include <display/Arduino_AXS15231B.h>
 #include "esp_lcd_touch_axs15231b.h"
 
+#include "config.h"
 #include "tft_config.h"
 #include "tca_expander.h"
 #include "power_manager.h"
+#include "imu_manager.h"
 #include "app_state.h"
 #include "ui_state_reader.h"
 #include "ui_page_home.h"
@@ -43,17 +45,28 @@ static const uint16_t GFX_H = 480;
 static const uint16_t SCR_W = 480;
 static const uint16_t SCR_H = 320;
 
-// Single switch for opposite-landscape orientation.
-// true  = rotate UI 180° within landscape (other side)
-// false = current orientation
+// Height of one render buffer in landscape lines (Config::LVGL_PARTIAL_FLUSH).
+// Small enough that a full-screen refresh is split into several parts — only
+// then can LVGL render the next part while the worker pushes the previous one.
+static const uint16_t BUF_LINES = 40;
+
+// Landscape orientation. With Config::IMU_AUTO_MOUNT, LvglDisplay::followMount()
+// corrects it from the IMU at boot and after each light-sleep wake.
+// true  = rotate UI 180° within landscape (other side) — R3 transfer
+// false = current orientation                        — R1 transfer
 static constexpr bool FLIP_LANDSCAPE_180 = true;
-static constexpr uint16_t TOUCH_ROTATION = FLIP_LANDSCAPE_180 ? 3 : 1;
+static bool flipLandscape = FLIP_LANDSCAPE_180;
+
+static uint16_t touchRotation()
+{
+    return flipLandscape ? 3 : 1;
+}
 
 static Arduino_DataBus *bus = new Arduino_ESP32QSPI(
     QSPI_CS, QSPI_CLK, QSPI_D0, QSPI_D1, QSPI_D2, QSPI_D3);
 
 // Hardware stays in native portrait — software rotation in flush_cb
-static Arduino_GFX *gfx = new Arduino_AXS15231B(
+static Arduino_TFT *gfx = new Arduino_AXS15231B(
     bus, -1 /* RST */, 0 /* Native Portrait */, false /* IPS */,
     GFX_W, GFX_H);
 
@@ -61,8 +74,11 @@ static Arduino_GFX *gfx = new Arduino_AXS15231B(
 // STATIC OBJECTS
 // ═══════════════════════════════════════════════════════════════
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t *buf1 = nullptr; // LVGL render buffer (persistent, full-screen landscape)
+static lv_color_t *buf1 = nullptr; // LVGL render buffers — partial: landscape strips, ping-pong,
+static lv_color_t *buf2 = nullptr; // one rendered while the other is on the QSPI bus;
+                                   // direct_mode: buf1 only, persistent full-screen landscape
 static lv_disp_drv_t disp_drv;
+static lv_disp_t *disp = nullptr;
 static lv_indev_drv_t indev_drv;
 static bool initialized = false;
 
@@ -70,6 +86,62 @@ static bool initialized = false;
 // LVGL CALLBACKS
 // ═══════════════════════════════════════════════════════════════
 
+// Flush worker — owns the QSPI bus while a frame part is in flight.
+// flush_cb only queues the job; the worker transfers it and then calls
+// lv_disp_flush_ready(), so LVGL renders the next part into the other buffer
+// and the Arduino loop never waits on the DMA.
+struct FlushJob
+{
+    lv_disp_drv_t *drv;
+    lv_area_t area;
+    lv_color_t *pixels;
+};
+
+static QueueHandle_t flushQueue = NULL;
+static SemaphoreHandle_t flushDone = NULL; // given by the worker after each part
+static TaskHandle_t flushTaskHandle = NULL;
+static volatile bool flushBusy = false;
+
+// Overlap counters: transfer time in the worker vs time LVGL spent blocked
+// on it. Transfer the loop never waited for ran behind rendering.
+static volatile uint32_t flushParts = 0;
+static volatile uint32_t flushPushUs = 0;
+static uint32_t flushWaitUs = 0;
+
+// Send one rendered landscape area (compact w × h buffer) to its rotated window
+// on the portrait panel. R1 (90° CW) for the default mount, R3 (90° CCW) for the
+// flipped one — both rotate inside the DMA column copy.
+static void pushArea(const lv_area_t &a, lv_color_t *pixels)
+{
+    const int16_t w = lv_area_get_width(&a);
+    const int16_t h = lv_area_get_height(&a);
+    uint16_t *src = (uint16_t *)pixels;
+
+    if (flipLandscape)
+        gfx->draw16bitBeRGBBitmapR3(a.y1, SCR_W - 1 - a.x2, src, w, h, w);
+    else
+        gfx->draw16bitBeRGBBitmapR1(SCR_H - 1 - a.y2, a.x1, src, w, h, w);
+}
+
+// Flush task runs on Core 0 — blocks when idle, woken by flushQueue
+static void flushTask(void *parameter)
+{
+    FlushJob job;
+    while (true)
+    {
+        if (xQueueReceive(flushQueue, &job, portMAX_DELAY) != pdTRUE)
+            continue;
+
+        const uint32_t t0 = micros();
+        pushArea(job.area, job.pixels);
+        flushPushUs += micros() - t0;
+        flushParts++;
+        flushBusy = false;
+        lv_disp_flush_ready(job.drv);
+        xSemaphoreGive(flushDone);
+    }
+}
+
 // Reverse pixel order in-place for 180° flip (fast — ~0.5ms on ESP32)
 static void reverseBuffer16(uint16_t *buf, uint32_t count)
 {
@@ -84,17 +156,17 @@ static void reverseBuffer16(uint16_t *buf, uint32_t count)
     }
 }
 
-static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+// direct_mode: LVGL only re-renders dirty widgets into the persistent buf1.
+// On the last flush of a refresh the entire buf1 goes out through R1, which
+// rotates 90° CW during the QSPI DMA transfer. The flipped mount reverses the
+// buffer around the proven full-frame R1 path and restores it for LVGL.
+static void flushFullFrame(lv_disp_drv_t *drv)
 {
-    // direct_mode: buf1 is persistent full-screen landscape buffer.
-    // LVGL only re-renders dirty widgets into buf1.
-    // On last flush, send entire buf1 to display via draw16bitBeRGBBitmapR1
-    // which does 90° CW rotation DURING the QSPI DMA transfer — no rot_buf needed.
     if (lv_disp_flush_is_last(drv))
     {
-        if (FLIP_LANDSCAPE_180)
+        const uint32_t t0 = micros();
+        if (flipLandscape)
         {
-            // 180° flip: reverse buffer, send via proven R1 DMA, then restore for LVGL direct_mode.
             const uint32_t pixelCount = (uint32_t)SCR_W * SCR_H;
             reverseBuffer16((uint16_t *)buf1, pixelCount);
             gfx->draw16bitBeRGBBitmapR1(0, 0, (uint16_t *)buf1, SCR_W, SCR_H);
@@ -104,10 +176,46 @@ static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
         {
             gfx->draw16bitBeRGBBitmapR1(0, 0, (uint16_t *)buf1, SCR_W, SCR_H);
         }
+        flushPushUs += micros() - t0;
+        flushParts++;
     }
     lv_disp_flush_ready(drv);
 }
 
+// Block until the worker has released the bus (for direct panel commands).
+static void waitForFlush()
+{
+    while (flushBusy)
+        vTaskDelay(1);
+}
+
+static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    if (!Config::LVGL_PARTIAL_FLUSH)
+    {
+        flushFullFrame(drv);
+        return;
+    }
+
+    // Partial mode with two buffers: LVGL joins the invalidated areas, renders
+    // each into the free buffer in BUF_LINES strips and reports it here. With
+    // the other buffer still in flight LVGL calls lvgl_wait_cb, not here.
+    FlushJob job = {drv, *area, color_p};
+    flushBusy = true;
+    xQueueSend(flushQueue, &job, portMAX_DELAY);
+}
+
+// LVGL needs the buffer that is still on the bus. Without a wait_cb it spins
+// on draw_buf->flushing; block on the worker instead so core 1 stays free.
+// A stale give only returns early once — LVGL re-checks and calls again.
+static void lvgl_wait_cb(lv_disp_drv_t *drv)
+{
+    const uint32_t t0 = micros();
+    if (drv->draw_buf->flushing)
+        xSemaphoreTake(flushDone, 1);
+    flushWaitUs += micros() - t0;
+}
+
 // Touch input callback for LVGL (I2C capacitive — AXS15231B)
 static lv_point_t touchStart = {0, 0};
 static bool touchActive = false;
@@ -193,21 +301,158 @@ static void lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data)
 // SWIPE GESTURE — horizontal swipe to switch screens
 // ═══════════════════════════════════════════════════════════════
 
-static lv_obj_t *getScreenForPage(int page)
+// ═══════════════════════════════════════════════════════════════
+// PAGE LIFECYCLE — built on first visit, freed after idle
+// ═══════════════════════════════════════════════════════════════
+
+// Home (page 0) is built at boot and always resident. Clock (1) and
+// settings (2) are built the first time they are shown and freed once they
+// have been hidden for Config::UI_PAGE_IDLE_FREE_MS. The portal/QR page (3)
+// belongs to settings, which is kept while it exists.
+// Page setters are no-ops while a page is not built; a (re)built page is
+// filled from g_state before its first frame.
+static const int NUM_LAZY_PAGES = 3;
+
+struct PageSlot
+{
+    lv_obj_t *(*create)();
+    lv_obj_t *(*getScreen)();
+    void (*destroy)();
+    uint32_t hiddenSinceMs;
+};
+
+static PageSlot pages[NUM_LAZY_PAGES] = {
+    {UiPageHome::create, UiPageHome::getScreen, nullptr, 0},
+    {UiPageClock::create, UiPageClock::getScreen, UiPageClock::destroy, 0},
+    {UiPageSettings::create, UiPageSettings::getScreen, UiPageSettings::destroy, 0},
+};
+
+// Snapshot of the last freed page, shown the moment it is swiped to again
+// while the real page is rebuilt on the next loop pass. One slot only: a
+// 300 KB image per page would cost more than the widgets it replaces.
+static lv_obj_t *placeholderScr = nullptr;
+static lv_obj_t *placeholderImg = nullptr;
+static lv_img_dsc_t *placeholderSnap = nullptr;
+static int placeholderPage = -1;
+static int pendingBuildPage = -1;
+
+static void releasePlaceholder()
+{
+    if (!placeholderSnap)
+        return;
+    if (placeholderImg)
+        lv_img_set_src(placeholderImg, nullptr);
+    lv_img_cache_invalidate_src(placeholderSnap);
+    lv_snapshot_free(placeholderSnap);
+    placeholderSnap = nullptr;
+    placeholderPage = -1;
+}
+
+static void takePlaceholder(int page, lv_obj_t *scr)
+{
+    if (!Config::UI_PAGE_PLACEHOLDER)
+        return;
+    releasePlaceholder();
+    placeholderSnap = lv_snapshot_take(scr, LV_IMG_CF_TRUE_COLOR);
+    if (!placeholderSnap)
+        return;
+    placeholderPage = page;
+
+    if (!placeholderScr)
+    {
+        placeholderScr = lv_obj_create(nullptr);
+        lv_obj_remove_style_all(placeholderScr);
+        lv_obj_clear_flag(placeholderScr, LV_OBJ_FLAG_SCROLLABLE);
+        placeholderImg = lv_img_create(placeholderScr);
+        lv_obj_set_pos(placeholderImg, 0, 0);
+    }
+    lv_img_set_src(placeholderImg, placeholderSnap);
+}
+
+// Build the page if needed; returns its screen (home as the fallback)
+static lv_obj_t *ensurePage(int page)
+{
+    if (page == 3)
+    {
+        // Portal/QR screen is created by settings from the WiFi state
+        if (!UiPageSettings::getScreen())
+            ensurePage(2);
+        lv_obj_t *portal = UiPageSettings::getPortalScreen();
+        return portal ? portal : UiPageSettings::getScreen();
+    }
+    if (page < 0 || page >= NUM_LAZY_PAGES)
+        page = 0;
+
+    PageSlot &slot = pages[page];
+    if (lv_obj_t *scr = slot.getScreen())
+        return scr;
+
+    const uint32_t start = millis();
+    lv_obj_t *scr = slot.create();
+    slot.hiddenSinceMs = start;
+    g_state.markDirty(DirtyFlag::ALL & ~DirtyFlag::STATUS_SCREEN);
+    UiStateReader::update();
+    if (placeholderPage == page)
+        releasePlaceholder();
+    Serial.printf("[Display] Page %d built in %lu ms (PSRAM free %u KB)\n", page,
+                  (unsigned long)(millis() - start),
+                  (unsigned)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024));
+    return scr;
+}
+
+static void freeIdlePages()
+{
+    if (Config::UI_PAGE_IDLE_FREE_MS == 0 || g_state.statusScreen != StatusScreenType::NONE)
+        return;
+
+    const uint32_t now = millis();
+    for (int page = 1; page < NUM_LAZY_PAGES; page++)
+    {
+        PageSlot &slot = pages[page];
+        lv_obj_t *scr = slot.getScreen();
+        if (!scr || page == currentPage || scr == lv_scr_act())
+            continue;
+        if (page == 2 && (currentPage == 3 || UiPageSettings::getPortalScreen()))
+            continue;
+        if (now - slot.hiddenSinceMs < Config::UI_PAGE_IDLE_FREE_MS)
+            continue;
+
+        takePlaceholder(page, scr);
+        slot.destroy();
+        Serial.printf("[Display] Page %d freed after %lu s idle (PSRAM free %u KB)\n", page,
+                      (unsigned long)((now - slot.hiddenSinceMs) / 1000),
+                      (unsigned)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024));
+    }
+}
+
+// Deferred half of a placeholder switch: build the page, then swap it in
+static void finishPendingBuild()
+{
+    const int page = pendingBuildPage;
+    pendingBuildPage = -1;
+    lv_obj_t *scr = ensurePage(page);
+    if (page == currentPage)
+        lv_scr_load(scr);
+}
+
+// ═══════════════════════════════════════════════════════════════
+// SWIPE GESTURE — horizontal swipe to switch screens
+// ═══════════════════════════════════════════════════════════════
+
+static void showPage(int page)
 {
-    switch (page)
+    if (currentPage >= 0 && currentPage < NUM_LAZY_PAGES)
+        pages[currentPage].hiddenSinceMs = millis();
+    currentPage = page;
+
+    // Freed page with a snapshot: show it now, rebuild on the next loop pass
+    if (page == placeholderPage && page < NUM_LAZY_PAGES && !pages[page].getScreen())
     {
-    case 0:
-        return UiPageHome::getScreen();
-    case 1:
-        return UiPageClock::getScreen();
-    case 2:
-        return UiPageSettings::getScreen();
-    case 3:
-        return UiPageSettings::getPortalScreen();
-    default:
-        return UiPageHome::getScreen();
+        pendingBuildPage = page;
+        lv_scr_load(placeholderScr);
+        return;
     }
+    lv_scr_load(ensurePage(page));
 }
 
 static void goToPage(int page)
@@ -221,12 +466,67 @@ static void goToPage(int page)
         return;
     // Partial updates + software rotation: page switch is fast enough.
     // lv_scr_load marks full screen dirty = one full flush, then back to partials.
-    currentPage = page;
-    lv_obj_t *scr = getScreenForPage(page);
-    lv_scr_load(scr);
+    showPage(page);
     lv_refr_now(NULL);
 }
 
+// ═══════════════════════════════════════════════════════════════
+// REFRESH GOVERNOR — 60 Hz while interacting, ~1 Hz when idle
+// ═══════════════════════════════════════════════════════════════
+
+// FAST: LVGL refresh every 16 ms, UiStateReader poll every 50 ms.
+// IDLE: both drop to 1 s. Nothing is lost — a g_state change or a pending
+// invalidation kicks the timers on the next loop() pass, so the once-a-second
+// clock tick still lands within one loop iteration; only the empty wakeups go.
+static const uint32_t REFR_PERIOD_FAST_MS = LV_DISP_DEF_REFR_PERIOD;
+static const uint32_t REFR_PERIOD_IDLE_MS = 1000;
+static const uint32_t STATE_SYNC_FAST_MS = 50;
+static const uint32_t STATE_SYNC_IDLE_MS = 1000;
+static const uint32_t FAST_HOLD_MS = 2000; // stay fast this long after the last touch/animation
+
+static bool refreshFast = true;
+static uint32_t lastBusyMs = 0;
+
+static void setRefreshFast(bool fast)
+{
+    if (fast == refreshFast)
+        return;
+    refreshFast = fast;
+    lv_timer_set_period(disp->refr_timer, fast ? REFR_PERIOD_FAST_MS : REFR_PERIOD_IDLE_MS);
+    UiStateReader::setPeriod(fast ? STATE_SYNC_FAST_MS : STATE_SYNC_IDLE_MS);
+    if (fast)
+        lv_timer_ready(disp->refr_timer);
+    Serial.printf("[Display] Refresh → %s\n", fast ? "FAST (60 Hz)" : "IDLE (1 Hz)");
+}
+
+// Called before every lv_timer_handler() pass
+static void governRefreshRate()
+{
+    const uint32_t now = millis();
+    if (touchActive || lv_anim_count_running() > 0)
+        lastBusyMs = now;
+
+    // Policy follows PowerManager: only a lit, active screen earns 60 Hz
+    const PowerManager::State power = PowerManager::getState();
+    const bool wantFast = power == PowerManager::State::ACTIVE && (now - lastBusyMs) < FAST_HOLD_MS;
+    setRefreshFast(wantFast);
+
+    if (refreshFast || power == PowerManager::State::SCREEN_OFF)
+        return;
+
+    // Idle: serve changes as they happen instead of waiting out the period.
+    // UiStateReader's timer runs before the refresh timer in the same pass.
+    if (g_state.dirty != DirtyFlag::NONE)
+    {
+        UiStateReader::kick();
+        lv_timer_ready(disp->refr_timer);
+    }
+    else if (disp->inv_p > 0)
+    {
+        lv_timer_ready(disp->refr_timer);
+    }
+}
+
 // Static buffer for prayer date (used by formatPrayerDate)
 static char prayerDateBuffer[48];
 
@@ -267,31 +567,69 @@ namespace LvglDisplay
         lv_init();
 
         // Init capacitive touch (I2C, rotation follows selected landscape orientation)
-        bsp_touch_init(&Wire, TOUCH_RST, TOUCH_ROTATION, SCR_W, SCR_H);
+        bsp_touch_init(&Wire, TOUCH_RST, touchRotation(), SCR_W, SCR_H);
 
-        // Buffer in PSRAM for LVGL rendering (no rotation buffer needed)
-        size_t buf_size = SCR_W * SCR_H;
-        buf1 = (lv_color_t *)heap_caps_aligned_alloc(32, buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-        if (!buf1)
+        if (Config::LVGL_PARTIAL_FLUSH)
         {
-            Serial.println("[Display] ERROR: Buffer allocation failed!");
-            return false;
+            // Two strip buffers in PSRAM for LVGL rendering (no rotation buffer needed)
+            size_t buf_size = SCR_W * BUF_LINES;
+            buf1 = (lv_color_t *)heap_caps_aligned_alloc(32, buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+            buf2 = (lv_color_t *)heap_caps_aligned_alloc(32, buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+            if (!buf1 || !buf2)
+            {
+                Serial.println("[Display] ERROR: Buffer allocation failed!");
+                return false;
+            }
+            Serial.printf("[Display] Buffers allocated: 2 x %uB (%u lines) in PSRAM (no rot_buf needed)\n",
+                          buf_size * sizeof(lv_color_t), BUF_LINES);
+
+            lv_disp_draw_buf_init(&draw_buf, buf1, buf2, buf_size); // Double buffer
+
+            // Flush worker on Core 0 (same core as audio, lower priority — adhan never stutters)
+            flushQueue = xQueueCreate(1, sizeof(FlushJob));
+            flushDone = xSemaphoreCreateBinary();
+            xTaskCreatePinnedToCore(
+                flushTask,
+                "FlushTask",
+                4096,
+                NULL,
+                3,
+                &flushTaskHandle,
+                0);
+            if (!flushQueue || !flushDone || !flushTaskHandle)
+            {
+                Serial.println("[Display] ERROR: Flush task creation failed!");
+                return false;
+            }
         }
-        memset(buf1, 0, buf_size * sizeof(lv_color_t));
-        Serial.printf("[Display] Buffer allocated: %uB in PSRAM (no rot_buf needed)\n",
-                      buf_size * sizeof(lv_color_t));
+        else
+        {
+            // One persistent full-screen buffer in PSRAM (direct_mode)
+            size_t buf_size = SCR_W * SCR_H;
+            buf1 = (lv_color_t *)heap_caps_aligned_alloc(32, buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+            if (!buf1)
+            {
+                Serial.println("[Display] ERROR: Buffer allocation failed!");
+                return false;
+            }
+            Serial.printf("[Display] Buffer allocated: %uB in PSRAM, direct mode (no rot_buf needed)\n",
+                          buf_size * sizeof(lv_color_t));
 
-        lv_disp_draw_buf_init(&draw_buf, buf1, NULL, buf_size); // Single buffer
+            lv_disp_draw_buf_init(&draw_buf, buf1, NULL, buf_size);
+        }
 
         // Register display driver — logical 480×320 landscape
-        // Manual rotation in flush_cb handles portrait hardware output
+        // Manual rotation in flush task handles portrait hardware output
         lv_disp_drv_init(&disp_drv);
         disp_drv.hor_res = SCR_W; // 480 (logical landscape)
         disp_drv.ver_res = SCR_H; // 320 (logical landscape)
         disp_drv.flush_cb = lvgl_flush_cb;
+        if (Config::LVGL_PARTIAL_FLUSH)
+            disp_drv.wait_cb = lvgl_wait_cb;
+        else
+            disp_drv.direct_mode = 1; // persistent buffer, LVGL only redraws dirty areas
         disp_drv.draw_buf = &draw_buf;
-        disp_drv.direct_mode = 1; // Persistent buffer — LVGL only re-renders dirty widgets
-        lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+        disp = lv_disp_drv_register(&disp_drv);
 
         // Register touch input driver
         lv_indev_drv_init(&indev_drv);
@@ -308,10 +646,23 @@ namespace LvglDisplay
         return true;
     }
 
-    void loop()
+    uint32_t loop()
+    {
+        if (!initialized)
+            return LV_NO_TIMER_READY;
+        if (pendingBuildPage >= 0)
+            finishPendingBuild();
+        else
+            freeIdlePages();
+        governRefreshRate();
+        return lv_timer_handler();
+    }
+
+    void boostRefresh()
     {
+        lastBusyMs = millis();
         if (initialized)
-            lv_timer_handler();
+            setRefreshFast(true);
     }
 
     void showPrayerScreen()
@@ -323,10 +674,9 @@ namespace LvglDisplay
         // Create shared assets (motif tile) before screens
         UiComponents::createSharedAssets();
 
-        // Create all pages once (they stay in memory)
+        // Only home is built before the first frame; clock and settings
+        // are built on first navigation (see PAGE LIFECYCLE)
         UiPageHome::create();
-        UiPageClock::create();
-        UiPageSettings::create();
 
         // Load home screen
         currentPage = 0;
@@ -336,12 +686,11 @@ namespace LvglDisplay
         // Fresh pages need current state — mark all dirty so UiStateReader pushes everything
         g_state.markDirty(DirtyFlag::ALL & ~DirtyFlag::STATUS_SCREEN);
 
-        // Navigation callback - just switch screens, no recreation
+        // Navigation callback - switch screens, building the target on first use
         UiComponents::setNavClickCallback([](int page)
                                           {
             if (page < 0 || page >= getNumPages() || page == currentPage) return;
-            currentPage = page;
-            lv_scr_load(getScreenForPage(page)); });
+            showPage(page); });
     }
 
     const char *formatPrayerDate(int dayOffset)
@@ -375,12 +724,75 @@ namespace LvglDisplay
 
     void displayOff()
     {
+        waitForFlush();
         gfx->displayOff();
+        // Touch reads are ignored while dark; stop the 20 ms poll waking the loop
+        if (indev_drv.read_timer)
+            lv_timer_pause(indev_drv.read_timer);
     }
 
     void displayOn()
     {
+        waitForFlush();
         gfx->displayOn();
+        if (indev_drv.read_timer)
+            lv_timer_resume(indev_drv.read_timer);
+    }
+
+    void setFlipped(bool flipped)
+    {
+        if (flipped == flipLandscape)
+            return;
+        // The worker reads flipLandscape inside pushArea on core 0: let the
+        // part in flight finish in the old orientation first
+        waitForFlush();
+        flipLandscape = flipped;
+        bsp_touch_set_rotation(touchRotation());
+        if (initialized)
+            lv_obj_invalidate(lv_scr_act());
+    }
+
+    bool isFlipped()
+    {
+        return flipLandscape;
+    }
+
+    void followMount()
+    {
+        if (!Config::IMU_AUTO_MOUNT)
+            return;
+        const ImuManager::Mount mount = ImuManager::readMount();
+        if (mount == ImuManager::Mount::UNKNOWN)
+            return;
+        const bool flipped = mount == ImuManager::Mount::FLIPPED;
+        if (flipped != flipLandscape)
+            Serial.printf("[Display] Mount %s (IMU)\n", flipped ? "flipped" : "normal");
+        setFlipped(flipped);
+    }
+
+    void dumpFlushStats()
+    {
+        const uint32_t parts = flushParts;
+        const uint32_t pushUs = flushPushUs;
+        if (!Config::LVGL_PARTIAL_FLUSH)
+        {
+            // Full frames sent from the loop task: nothing overlaps
+            Serial.printf("[Display] Flush (direct mode): %lu frames, transfer %lu us (%lu us/frame)\n",
+                          (unsigned long)parts, (unsigned long)pushUs, (unsigned long)(parts ? pushUs / parts : 0));
+            return;
+        }
+        const uint32_t hiddenUs = pushUs > flushWaitUs ? pushUs - flushWaitUs : 0;
+        Serial.printf("[Display] Flush: %lu parts, transfer %lu us (%lu us/part), LVGL blocked %lu us, %u%% overlapped\n",
+                      (unsigned long)parts, (unsigned long)pushUs, (unsigned long)(parts ? pushUs / parts : 0),
+                      (unsigned long)flushWaitUs, (unsigned)(pushUs ? (uint64_t)hiddenUs * 100 / pushUs : 0));
+    }
+
+    void resetFlushStats()
+    {
+        waitForFlush();
+        flushParts = 0;
+        flushPushUs = 0;
+        flushWaitUs = 0;
     }
 
     bool isGestureActive()
@@ -390,11 +802,11 @@ namespace LvglDisplay
 
     void goToPortalPage()
     {
+        ensurePage(3);
         lv_obj_t *portalScr = UiPageSettings::getPortalScreen();
         if (!portalScr)
             return;
-        currentPage = 3;
-        lv_scr_load(portalScr);
+        showPage(3);
         lv_refr_now(NULL);
     }
 
@@ -407,8 +819,7 @@ namespace LvglDisplay
         if (!settingsScr)
             return false;
 
-        currentPage = 2;
-        lv_scr_load(settingsScr);
+        showPage(2);
         lv_refr_now(NULL);
         return true;
     }
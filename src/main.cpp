@@ -2,6 +2,7 @@
 #include <WiFi.h>
 #include <Wire.h>
 #include <LittleFS.h>
+#include <algorithm>
 #include "config.h"
 #include "tft_config.h"
 #include "network.h"
@@ -26,6 +27,9 @@
 #include "pmu_manager.h"
 #include "power_manager.h"
 #include "imu_manager.h"
+#include "scheduler.h"
+#include "system_clock.h"
+#include "loop_metrics.h"
 
 #if TEST_MODE || TEST_ADHAN_AUDIO
 #include "test_mode.h"
@@ -130,10 +134,123 @@ static void onMutePressed()
     setVolume(newMuted ? 0 : g_state.volume);
 }
 
+// ── Scheduled tasks ──────────────────────────────────────
+
+namespace
+{
+    constexpr unsigned long NTP_RETRY_MS = 60UL * 60 * 1000;
+    constexpr uint32_t NTP_RECONNECT_WAIT_MS = 20000; // WifiManager gives up after 15 s
+    constexpr uint32_t NTP_RECONNECT_POLL_MS = 1000;
+    constexpr uint32_t STATUS_LOG_INTERVAL_MS = 300000;
+
+    // Loop wait caps while something outside the scheduler needs polling
+    constexpr uint32_t SERVER_POLL_MS = 10;   // WebServer / DNS portal clients
+    constexpr uint32_t AUDIO_POLL_MS = 20;    // AudioPlayer::tick fade / volume
+    constexpr uint32_t DIRTY_POLL_MS = 5;     // AppState changed: let LVGL serve it
+
+    uint64_t s_ntpReconnectDeadline = 0; // monotonic ms, 0 = no reconnect pending for NTP
+
+    constexpr size_t SERIAL_COMMAND_MAX = 32;
+    char s_serialCommand[SERIAL_COMMAND_MAX];
+    size_t s_serialCommandLen = 0;
+}
+
+static void onNtpSyncDue()
+{
+    const unsigned long remaining = RtcManager::msUntilSync();
+    if (remaining > 0)
+    {
+        Scheduler::after(Scheduler::Task::NTP_SYNC, remaining);
+        return;
+    }
+
+    if (Network::isConnected())
+    {
+        s_ntpReconnectDeadline = 0;
+        Network::syncTime(); // re-arms NTP_SYNC on success and failure
+        return;
+    }
+
+    if (SettingsManager::isOfflineMode())
+    {
+        RtcManager::postponeSync(NTP_RETRY_MS);
+        return;
+    }
+
+    // WiFi is off but NTP sync is due — reconnect, sync, WiFi auto-disconnects later
+    const uint64_t now = SystemClock::monotonicMs();
+    if (s_ntpReconnectDeadline == 0)
+    {
+        Serial.println("[NTP] Sync due — reconnecting WiFi...");
+        WifiManager::reconnect();
+        s_ntpReconnectDeadline = now + NTP_RECONNECT_WAIT_MS;
+    }
+    else if (now >= s_ntpReconnectDeadline)
+    {
+        Serial.println("[NTP] Reconnect failed — retry in 1h");
+        s_ntpReconnectDeadline = 0;
+        RtcManager::postponeSync(NTP_RETRY_MS);
+        return;
+    }
+    // Poll for the link, but land exactly on the give-up deadline
+    const uint64_t left = s_ntpReconnectDeadline - now;
+    Scheduler::after(Scheduler::Task::NTP_SYNC,
+                     static_cast<uint32_t>(std::min<uint64_t>(left, NTP_RECONNECT_POLL_MS)));
+}
+
+static void onStatusLogDue()
+{
+    Scheduler::after(Scheduler::Task::STATUS_LOG, STATUS_LOG_INTERVAL_MS);
+    Serial.printf("[Status] Heap: %d | Min: %d | WiFi: %s | Wakeups/5min: %lu\n",
+                  ESP.getFreeHeap(), ESP.getMinFreeHeap(),
+                  Network::isConnected() ? "ON" : "OFF",
+                  (unsigned long)Scheduler::takeWakeupCount());
+}
+
+// ── Serial commands ──────────────────────────────────
+// "metrics" prints the loop timing table, "metrics reset" starts a new
+// window. Read between passes, so an idle loop answers within a second.
+
+static void runSerialCommand(const char *command)
+{
+    if (strcmp(command, "metrics") == 0)
+    {
+        LoopMetrics::dump();
+        LvglDisplay::dumpFlushStats();
+    }
+    else if (strcmp(command, "metrics reset") == 0)
+    {
+        LoopMetrics::reset();
+        LvglDisplay::resetFlushStats();
+        Serial.println("[Metrics] Reset");
+    }
+    else if (command[0] != '\0')
+        Serial.printf("[Serial] Unknown command: %s (try: metrics, metrics reset)\n", command);
+}
+
+static void pollSerialCommands()
+{
+    while (Serial.available() > 0)
+    {
+        const char c = static_cast<char>(Serial.read());
+        if (c == '\r' || c == '\n')
+        {
+            s_serialCommand[s_serialCommandLen] = '\0';
+            runSerialCommand(s_serialCommand);
+            s_serialCommandLen = 0;
+        }
+        else if (s_serialCommandLen < SERIAL_COMMAND_MAX - 1)
+        {
+            s_serialCommand[s_serialCommandLen++] = c;
+        }
+    }
+}
+
 // ── Setup ────────────────────────────────────────────────
 
 void setup()
 {
+    Scheduler::init(); // before any module arms a task
     initHardware();
 
 #if FORCE_AP_PORTAL
@@ -150,6 +267,7 @@ void setup()
         Serial.println("[Display] FATAL: LVGL init failed!");
         return;
     }
+    LvglDisplay::followMount(); // before the first page is drawn
     delay(100);
 
 #if TEST_MODE
@@ -171,6 +289,7 @@ void setup()
 
     AppStateHelper::setNextPrayer("YUKLENIYOR", "--:--"); // placeholder until PrayerEngine loads
     DisplayTicker::forceUpdate();                         // populate initial time / date / hijri / ntp in AppState
+    DisplayTicker::init();
 
     if (bootOk)
         PrayerEngine::init();
@@ -187,11 +306,16 @@ void setup()
 
     // Mute state — persisted in NVS
     AppStateHelper::setMuted(SettingsManager::getMuted());
-    // Settings page is created before persisted state is loaded; sync controls once.
+    // Settings page may already exist (built on first visit); sync controls once.
     UiPageSettings::syncToggles();
 
     PowerManager::init();
 
+    Scheduler::on(Scheduler::Task::NTP_SYNC, onNtpSyncDue);
+    Scheduler::after(Scheduler::Task::NTP_SYNC, RtcManager::msUntilSync());
+    Scheduler::on(Scheduler::Task::STATUS_LOG, onStatusLogDue);
+    Scheduler::after(Scheduler::Task::STATUS_LOG, STATUS_LOG_INTERVAL_MS);
+
     Serial.printf("[System] Ready  heap=%lu\n", (unsigned long)ESP.getFreeHeap());
 }
 
@@ -199,37 +323,29 @@ void setup()
 
 void loop()
 {
-    LvglDisplay::loop();
+    using LoopMetrics::Probe;
+    uint32_t maxWaitMs;
+    {
+        LoopMetrics::Scope pass(Probe::PASS);
+        maxWaitMs = LoopMetrics::measure(Probe::DISPLAY, LvglDisplay::loop);
 
-    PortalHandler::tick();
-    WifiManager::tick();
-    PrayerEngine::tick();
-    AudioPlayer::tick();
-    DisplayTicker::tick();
-    PowerManager::tick();
-    RtcManager::correctDriftFromRTC();
+        LoopMetrics::measure(Probe::PORTAL, PortalHandler::tick);
+        LoopMetrics::measure(Probe::WIFI, WifiManager::tick);
+        LoopMetrics::measure(Probe::PRAYER, PrayerEngine::tick);
+        LoopMetrics::measure(Probe::AUDIO, AudioPlayer::tick);
+        LoopMetrics::measure(Probe::SCHEDULER, Scheduler::run);
 
-    if (Network::isConnected())
-    {
-        SettingsServer::handle();
-        if (RtcManager::periodicSyncTick())
-            Network::syncTime();
-    }
-    else if (!SettingsManager::isOfflineMode() && RtcManager::periodicSyncTick())
-    {
-        // WiFi is off but NTP sync is due — reconnect, sync, WiFi auto-disconnects later
-        Serial.println("[NTP] Sync due — reconnecting WiFi...");
-        WifiManager::reconnect();
+        if (Network::isConnected())
+            LoopMetrics::measure(Probe::SERVER, SettingsServer::handle);
     }
+    pollSerialCommands();
 
-    static unsigned long lastLog = 0;
-    if (millis() - lastLog > 300000)
-    {
-        lastLog = millis();
-        Serial.printf("[Status] Heap: %d | Min: %d | WiFi: %s\n",
-                      ESP.getFreeHeap(), ESP.getMinFreeHeap(),
-                      Network::isConnected() ? "ON" : "OFF");
-    }
+    if (SettingsServer::isActive() || Network::isPortalActive())
+        maxWaitMs = std::min(maxWaitMs, SERVER_POLL_MS);
+    if (isPlaying())
+        maxWaitMs = std::min(maxWaitMs, AUDIO_POLL_MS);
+    if (g_state.dirty != DirtyFlag::NONE && PowerManager::isScreenOn())
+        maxWaitMs = std::min(maxWaitMs, DIRTY_POLL_MS);
 
-    delay(5);
+    Scheduler::wait(maxWaitMs);
 }
@@ -5,6 +5,7 @@
 #include "wifi_credentials.h"
 #include "settings_server.h"
 #include "rtc_manager.h"
+#include "scheduler.h"
 #include <WiFi.h>
 #include <esp_wifi.h>
 #include <LittleFS.h>
@@ -20,6 +21,7 @@ static void sntpSyncCallback(struct timeval *tv)
                   t.tm_hour, t.tm_min, t.tm_sec, (long)tv->tv_sec);
     RtcManager::markNtpSync();
     RtcManager::writeSystemClockToRTC(tv->tv_sec);
+    Scheduler::clockChanged(); // runs on the SNTP task; wakes loop()
 }
 
 // WiFi event handler - only log important events
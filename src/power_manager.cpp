@@ -14,6 +14,9 @@
 #include "rtc_manager.h"
 
 #include "prayer_engine.h"
+#include "scheduler.h"
+#include "loop_metrics.h"
+#include "system_clock.h"
 
 #include <Arduino.h>
 #include <WiFi.h>
@@ -64,6 +67,47 @@ static uint32_t getDimTimeout()
     return PowerManager::DIM_TIMEOUT_SAVER_MS;
 }
 
+static uint32_t remainingMs(uint32_t timeoutMs)
+{
+    const uint32_t idleMs = SystemClock::uptimeMs() - lastActivityMs;
+    return idleMs >= timeoutMs ? 0 : timeoutMs - idleMs;
+}
+
+// Next moment the state machine has something to decide. Nothing is armed
+// while a wake lock is held (releasing it re-arms) or the screen is meant
+// to stay on; reportActivity() re-arms from the new activity time.
+static void armNext()
+{
+    using Scheduler::Task;
+    if (PowerManager::hasActiveWakeLocks())
+    {
+        Scheduler::cancel(Task::POWER);
+        return;
+    }
+
+    switch (currentState)
+    {
+    case PowerManager::State::ACTIVE:
+        if (cachedMode == PowerMode::ALWAYS_ON)
+            Scheduler::cancel(Task::POWER);
+        else
+            Scheduler::after(Task::POWER, remainingMs(getDimTimeout()));
+        break;
+    case PowerManager::State::DIM:
+        Scheduler::after(Task::POWER, cachedMode == PowerMode::ALWAYS_ON
+                                          ? 0
+                                          : remainingMs(PowerManager::SCREEN_OFF_TIMEOUT_MS));
+        break;
+    case PowerManager::State::SCREEN_OFF:
+        // Light sleep on the next pass, or re-check once a second while a prayer is imminent
+        if (cachedMode == PowerMode::SCREEN_OFF)
+            Scheduler::after(Task::POWER, s_loggedPrayerImminent || PrayerEngine::isAdhanPlaying() ? 1000 : 0);
+        else
+            Scheduler::cancel(Task::POWER);
+        break;
+    }
+}
+
 static const char *modeStr(PowerMode m)
 {
     switch (m)
@@ -80,22 +124,32 @@ static const char *modeStr(PowerMode m)
 namespace PowerManager
 {
 
+    static void evaluate();
+
+    static void onPowerDue()
+    {
+        evaluate();
+        armNext();
+    }
+
     void init()
     {
         cachedMode = SettingsManager::getPowerMode();
-        lastActivityMs = millis();
+        lastActivityMs = SystemClock::uptimeMs();
         LvglDisplay::setBacklight(ACTIVE_BRIGHTNESS);
         currentState = State::ACTIVE;
+        Scheduler::on(Scheduler::Task::POWER, onPowerDue);
+        armNext();
         Serial.printf("[Power] Init — mode=%s, brightness=%u\n", modeStr(cachedMode), ACTIVE_BRIGHTNESS);
     }
 
-    void tick()
+    static void evaluate()
     {
         if (hasActiveWakeLocks())
             return;
 
         cachedMode = SettingsManager::getPowerMode();
-        const uint32_t idleMs = millis() - lastActivityMs;
+        const uint32_t idleMs = SystemClock::uptimeMs() - lastActivityMs;
 
         switch (currentState)
         {
@@ -165,6 +219,7 @@ namespace PowerManager
                 // Post-wake housekeeping (screen is already visible)
                 ImuManager::clearWakeStatus();
                 ImuManager::disarmAfterWake();
+                LvglDisplay::followMount(); // may have been turned around while asleep
 
                 if (!RtcManager::setSystemClockFromRTC())
                 {
@@ -180,7 +235,9 @@ namespace PowerManager
 
     void reportActivity()
     {
-        lastActivityMs = millis();
+        lastActivityMs = SystemClock::uptimeMs();
+        LvglDisplay::boostRefresh();
+        cachedMode = SettingsManager::getPowerMode();
 
         if (currentState == State::SCREEN_OFF)
         {
@@ -195,6 +252,7 @@ namespace PowerManager
             currentState = State::ACTIVE;
             Serial.println("[Power] Touch while DIM → ACTIVE");
         }
+        armNext();
     }
 
     void enterLightSleep()
@@ -227,6 +285,7 @@ namespace PowerManager
         Serial.flush();
 
         esp_light_sleep_start();
+        LoopMetrics::lightSleepDone(); // the running loop pass did not take this long
 
         // Re-init UART — USB-CDC drops during light sleep
         Serial.begin(115200);
@@ -268,6 +327,7 @@ namespace PowerManager
             Serial.printf("[Power] Wake lock released: %s (slot %u)\n", wakeLocks[id].name, id);
             wakeLocks[id].active = false;
             wakeLocks[id].name = nullptr;
+            armNext();
         }
     }
 
@@ -287,8 +347,13 @@ namespace PowerManager
         LvglDisplay::setBacklight(ACTIVE_BRIGHTNESS);
         UiStateReader::resume();
         UiPageSettings::updatePowerModeUI();
-        lastActivityMs = millis();
+        lastActivityMs = SystemClock::uptimeMs();
         currentState = State::ACTIVE;
+        LvglDisplay::boostRefresh();
+        armNext();
+        // Clock and countdown run once a second again
+        Scheduler::after(Scheduler::Task::CLOCK, 0);
+        Scheduler::after(Scheduler::Task::PRAYER, 0);
         Serial.println("[Power] Screen woken → ACTIVE");
     }
 
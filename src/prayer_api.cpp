@@ -2,7 +2,10 @@
 #include "config.h"
 #include "current_time.h"
 #include "diyanet_parser.h"
+#include "prayer_table.h"
 #include "settings_manager.h"
+#include "system_clock.h"
+#include "time_zone_rules.h"
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
@@ -55,22 +58,15 @@ namespace
         // Show first day details
         if (s_cache.totalDays > 0)
         {
-            struct tm t = {};
-            t.tm_year = 70;
-            t.tm_mon = 0;
-            t.tm_mday = 1;
-            time_t temp = s_cache.fetchedAt;
-            gmtime_r(&temp, &t);
-
-            Serial.printf("[Cache] First day: %04d-%02d-%02d\n",
-                          t.tm_year + 1900, t.tm_mon + 1, t.tm_mday);
+            const CivilDate::Date first = TimeZoneRules::current().localDate(s_cache.fetchedAt);
+            Serial.printf("[Cache] First day: %04d-%02d-%02d\n", first.year, first.month, first.day);
             Serial.printf("[Cache]   Fajr: %s, Dhuhr: %s, Asr: %s\n",
-                          s_cache.days[0][PrayerType::Fajr].value.data(),
-                          s_cache.days[0][PrayerType::Dhuhr].value.data(),
-                          s_cache.days[0][PrayerType::Asr].value.data());
+                          s_cache.days[0][PrayerType::Fajr].format().data(),
+                          s_cache.days[0][PrayerType::Dhuhr].format().data(),
+                          s_cache.days[0][PrayerType::Asr].format().data());
             Serial.printf("[Cache]   Maghrib: %s, Isha: %s\n",
-                          s_cache.days[0][PrayerType::Maghrib].value.data(),
-                          s_cache.days[0][PrayerType::Isha].value.data());
+                          s_cache.days[0][PrayerType::Maghrib].format().data(),
+                          s_cache.days[0][PrayerType::Isha].format().data());
 
             if (s_cache.totalDays > 1)
             {
@@ -101,14 +97,11 @@ namespace
         }
 
 #if DEBUG_CACHE_LOGS
-        struct tm t = {};
-        time_t temp = s_cache.fetchedAt;
-        gmtime_r(&temp, &t);
-
+        const CivilDate::Date first = TimeZoneRules::current().localDate(s_cache.fetchedAt);
         Serial.printf("[Cache] Saved: %d days starting from %04d-%02d-%02d\n",
-                      s_cache.totalDays, t.tm_year + 1900, t.tm_mon + 1, t.tm_mday);
+                      s_cache.totalDays, first.year, first.month, first.day);
         Serial.printf("[Cache] First day Fajr: %s, Last day: day %d\n",
-                      s_cache.days[0][PrayerType::Fajr].value.data(),
+                      s_cache.days[0][PrayerType::Fajr].format().data(),
                       s_cache.totalDays);
 #else
         Serial.printf("[Cache] Saved: %d days\n", s_cache.totalDays);
@@ -120,7 +113,7 @@ namespace
         if (s_cache.ilceId != ilceId || s_cache.totalDays == 0)
             return false;
 
-        const time_t now = time(nullptr);
+        const time_t now = SystemClock::now();
         if (DiyanetParser::isCacheExpired(s_cache.fetchedAt, now, CACHE_VALID_DAYS))
         {
             Serial.println("[Cache] Expired");
@@ -129,6 +122,14 @@ namespace
 
         return true;
     }
+
+    // Local days from the first cached day to `date`. Counted on the calendar,
+    // not as epoch difference / 86400, which truncates across a 23 h DST day.
+    static int cacheDayOffset(const CivilDate::Date &date)
+    {
+        return CivilDate::daysFromCivil(date) -
+               CivilDate::daysFromCivil(TimeZoneRules::current().localDate(s_cache.fetchedAt));
+    }
 }
 
 bool PrayerAPI::fetchMonthlyPrayerTimes(int ilceId)
@@ -200,7 +201,9 @@ bool PrayerAPI::fetchMonthlyPrayerTimes(int ilceId)
     }
 
     // Parse and store
+    const TimeZoneRules::Zone &zone = TimeZoneRules::current();
     memset(&s_cache, 0, sizeof(s_cache));
+    CivilDate::Date firstDay = {};
     s_cache.ilceId = ilceId;
     s_cache.totalDays = 0;
 
@@ -216,17 +219,14 @@ bool PrayerAPI::fetchMonthlyPrayerTimes(int ilceId)
         if (!DiyanetParser::parseDate(dateStr, d, m, y))
             continue;
 
-        struct tm t = {};
-        t.tm_year = y - 1900;
-        t.tm_mon = m - 1;
-        t.tm_mday = d;
-        t.tm_hour = 0;
-        t.tm_min = 0;
-        t.tm_sec = 0;
-        time_t dayTimestamp = mktime(&t);
+        const CivilDate::Date date = {(int16_t)y, (int8_t)m, (int8_t)d};
+        const time_t dayTimestamp = zone.localMidnight(date);
 
         if (s_cache.totalDays == 0)
+        {
             s_cache.fetchedAt = dayTimestamp;
+            firstDay = date;
+        }
 
         DailyPrayers &prayers = s_cache.days[s_cache.totalDays];
 
@@ -247,6 +247,7 @@ bool PrayerAPI::fetchMonthlyPrayerTimes(int ilceId)
     }
 
     saveCache();
+    PrayerTable::importDiyanet(ilceId, firstDay, s_cache.days, s_cache.totalDays);
 
     Serial.printf("[Diyanet] Cached %d days\n", s_cache.totalDays);
     return true;
@@ -268,22 +269,11 @@ bool PrayerAPI::getCachedPrayerTimes(DailyPrayers &prayers, bool forTomorrow)
 
     int dayOffset = 0; // Default: today (first day in cache)
 
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo))
+    CivilDate::Date today;
+    if (TimeZoneRules::localToday(today))
     {
         // RTC available - calculate exact day offset
-        if (forTomorrow)
-        {
-            timeinfo.tm_mday += 1;
-            mktime(&timeinfo);
-        }
-
-        timeinfo.tm_hour = 0;
-        timeinfo.tm_min = 0;
-        timeinfo.tm_sec = 0;
-        time_t targetDate = mktime(&timeinfo);
-
-        dayOffset = DiyanetParser::calculateDayOffset(s_cache.fetchedAt, targetDate);
+        dayOffset = cacheDayOffset(today) + (forTomorrow ? 1 : 0);
     }
     else
     {
@@ -305,6 +295,22 @@ bool PrayerAPI::getCachedPrayerTimes(DailyPrayers &prayers, bool forTomorrow)
     return true;
 }
 
+bool PrayerAPI::getCachedPrayerTimes(const CivilDate::Date &date, DailyPrayers &prayers)
+{
+    if (s_cache.totalDays == 0 && !loadCache())
+        return false;
+
+    if (s_cache.ilceId != SettingsManager::getDiyanetId())
+        return false;
+
+    const int dayOffset = cacheDayOffset(date);
+    if (!DiyanetParser::isDayOffsetValid(dayOffset, s_cache.totalDays))
+        return false;
+
+    prayers = s_cache.days[dayOffset];
+    return true;
+}
+
 PrayerAPI::CacheInfo PrayerAPI::getCacheInfo()
 {
     CacheInfo info = {0, 0, false};
@@ -319,15 +325,10 @@ PrayerAPI::CacheInfo PrayerAPI::getCacheInfo()
     info.ilceId = s_cache.ilceId;
 
     // Calculate days remaining from today
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo))
+    CivilDate::Date today;
+    if (TimeZoneRules::localToday(today))
     {
-        timeinfo.tm_hour = 0;
-        timeinfo.tm_min = 0;
-        timeinfo.tm_sec = 0;
-        time_t today = mktime(&timeinfo);
-
-        int dayOffset = DiyanetParser::calculateDayOffset(s_cache.fetchedAt, today);
+        int dayOffset = cacheDayOffset(today);
         info.daysRemaining = s_cache.totalDays - dayOffset;
 
         if (info.daysRemaining < 0)
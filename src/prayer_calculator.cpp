@@ -2,10 +2,12 @@
 #include "config.h"
 #include "settings_manager.h"
 #include "prayer_types.h"
+#include "time_zone_rules.h"
+#include "solar_float.h"
 #include <Arduino.h>
 #include <time.h>
 #include <algorithm>
-#include <iterator>
+#include <cmath>
 
 extern "C"
 {
@@ -19,216 +21,347 @@ extern "C"
 #include "solar_time.h"
 }
 
+#include "method_registry.h"
+
 namespace
 {
-    struct NetAdjustments
-    {
-        int fajr = 0;
-        int sunrise = 0;
-        int dhuhr = 0;
-        int asr = 0;
-        int maghrib = 0;
-        int isha = 0;
-    };
+    using CivilDate::civilFromDays;
+    using CivilDate::daysFromCivil;
 
-    struct MethodSpec
+#if FLOAT_SOLAR_ENGINE
+    // Hour angles for the post-processing steps from the day's float solar terms
+    struct FloatSolar
     {
-        int id;
-        const char *name;
-        calculation_method calcMethod;
-        bool overrideAngles;
-        double fajrAngle;
-        double ishaAngle;
-        int ishaInterval;
-        bool forceHanafi;
-        bool warnTehranMaghribAngle;
-        NetAdjustments dartNet;
-    };
+        const SolarFloat::SolarTimeF &solar;
 
-    static constexpr MethodSpec kMethodSpecs[] = {
-        // id, name, calcMethod, overrideAngles, fajr, isha, interval, forceHanafi, warnTehran, dartNet
-        {1, "Karachi", KARACHI, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {2, "ISNA", NORTH_AMERICA, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {3, "MWL", MUSLIM_WORLD_LEAGUE, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {4, "Umm al-Qura", UMM_AL_QURA, false, 0, 0, 0, false, false, NetAdjustments{}},
-        // Egyptian: override to Dart (19.5/17.5)
-        {5, "Egyptian", EGYPTIAN, true, 19.5, 17.5, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        // Gulf: Fajr 19.5°, Isha 90 minutes after Maghrib
-        {6, "Gulf", GULF, false, 0, 0, 0, false, false, NetAdjustments{}},
-        // Tehran: not supported fully (maghribAngle missing)
-        {7, "Tehran", OTHER, false, 17.7, 14.0, 0, false, true, NetAdjustments{}},
-        {8, "Dubai", OTHER, false, 18.2, 18.2, 0, false, false, NetAdjustments{0, -3, 3, 3, 3, 0}},
-        {9, "Kuwait", KUWAIT, false, 0, 0, 0, false, false, NetAdjustments{}},
-        {10, "Qatar", QATAR, false, 0, 0, 0, false, false, NetAdjustments{}},
-        {11, "Singapore", OTHER, false, 20.0, 18.0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {12, "France UOIF", OTHER, false, 12.0, 12.0, 0, false, false, NetAdjustments{}},
-        {13, "Turkey Diyanet", OTHER, false, 18.0, 17.0, 0, false, false, NetAdjustments{0, -7, 5, 4, 7, 0}},
-        {14, "Russia", OTHER, false, 16.0, 15.0, 0, true, false, NetAdjustments{}},
-        {15, "Moonsighting", MOON_SIGHTING_COMMITTEE, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 5, 0, 3, 0}},
+        double hourAngle(double angle, bool afterTransit) const
+        {
+            return solar.hourAngle((float)angle, afterTransit);
+        }
+    };
+    using DaySolar = FloatSolar;
+#else
+    using DaySolar = MethodRegistry::LibrarySolar;
+#endif
+    using Pipeline = MethodRegistry::MethodPipeline<DaySolar>;
+
+    // Everything that is the same for every day of a range
+    struct RangeContext
+    {
+        const Pipeline *pipeline; // method steps, resolved once per range
+        calculation_parameters_t params;
+        coordinates_t coordinates; // latitude already clamped for Diyanet
+        double latitude;           // unclamped, for the Diyanet KARAR rules
+        const TimeZoneRules::Zone *zone; // local offsets from precomputed TZ transitions
     };
 
-    static const MethodSpec *findMethodSpec(int method)
+    static RangeContext makeRangeContext(int method, double latitude, double longitude, bool verbose)
     {
-        auto it = std::find_if(std::begin(kMethodSpecs), std::end(kMethodSpecs),
-                               [method](const MethodSpec &spec)
-                               { return spec.id == method; });
-        return (it != std::end(kMethodSpecs)) ? &(*it) : nullptr;
+        RangeContext ctx;
+        ctx.pipeline = MethodRegistry::pipelineFor<DaySolar>(method);
+        if (!ctx.pipeline)
+        {
+            if (verbose)
+            {
+                Serial.printf("[Calc] Unknown method %d, defaulting to MWL\n", method);
+            }
+            ctx.pipeline = MethodRegistry::pipelineFor<DaySolar>(MethodRegistry::DEFAULT_METHOD);
+        }
+        ctx.params = ctx.pipeline->parameters();
+
+        // Diyanet: latitude clamping for the 62°+ rule
+        ctx.latitude = latitude;
+        ctx.coordinates.latitude = ctx.pipeline->coordinateLatitude(latitude);
+        ctx.coordinates.longitude = longitude;
+        ctx.zone = &TimeZoneRules::current();
+        return ctx;
     }
 
-    static const MethodSpec &defaultMethodSpec()
+    // Minutes since local midnight of an epoch in a known UTC offset
+    static PrayerTime localTime(time_t t, long offsetSeconds)
     {
-        // Default to MWL (id=3)
-        return kMethodSpecs[2];
+        long sec = ((long)t + offsetSeconds) % 86400L;
+        if (sec < 0)
+            sec += 86400L;
+        return PrayerTime::fromMinutes((int)(sec / 60));
     }
 
-    static calculation_parameters_t buildParameters(const MethodSpec &spec)
+    static void storeLocalTimes(const prayer_times_t &times, long offsetSeconds, DailyPrayers &prayers)
     {
-        calculation_parameters_t params;
+        prayers[PrayerType::Fajr] = localTime(times.fajr, offsetSeconds);
+        prayers[PrayerType::Sunrise] = localTime(times.sunrise, offsetSeconds);
+        prayers[PrayerType::Dhuhr] = localTime(times.dhuhr, offsetSeconds);
+        prayers[PrayerType::Asr] = localTime(times.asr, offsetSeconds);
+        prayers[PrayerType::Maghrib] = localTime(times.maghrib, offsetSeconds);
+        prayers[PrayerType::Isha] = localTime(times.isha, offsetSeconds);
+    }
 
-        if (spec.calcMethod != OTHER)
-        {
-            params = getParameters(spec.calcMethod);
-        }
-        else if (spec.ishaInterval > 0)
-        {
-            params = new_calculation_parameters4(spec.fajrAngle, spec.ishaInterval, OTHER);
-        }
-        else
+    // Library call for one day, shifted to local time
+    static prayer_times_t libraryTimes(coordinates_t &coordinates, time_t dateEpoch,
+                                       calculation_parameters_t &params, long offset_seconds)
+    {
+        // Adhan C library provides a TZ-hours API. Use it when offset is whole hours.
+        // For half/quarter-hour timezones, fall back to applying the exact seconds offset.
+        if ((offset_seconds % 3600) == 0)
         {
-            params = new_calculation_parameters3(spec.fajrAngle, spec.ishaAngle, OTHER);
+            const int tzHours = (int)(offset_seconds / 3600);
+            return new_prayer_times_with_tz(&coordinates, dateEpoch, &params, tzHours);
         }
 
-        if (spec.overrideAngles)
-        {
-            params.fajrAngle = spec.fajrAngle;
-            params.ishaAngle = spec.ishaAngle;
-        }
+        prayer_times_t times = new_prayer_times2(&coordinates, dateEpoch, &params);
+        times.fajr += offset_seconds;
+        times.sunrise += offset_seconds;
+        times.dhuhr += offset_seconds;
+        times.asr += offset_seconds;
+        times.maghrib += offset_seconds;
+        times.isha += offset_seconds;
+        return times;
+    }
 
-        if (spec.forceHanafi)
-        {
-            params.madhab = madhab_t::HANAFI;
-        }
+    // ── Composition from SolarFloat hours ───────────────────────────
+    // Same composition as the library's prayer_times.c (night portions,
+    // Moonsighting seasonal twilight, adjustments, minute rounding), fed by
+    // SolarFloat instead of the double solar_time module. Used by the float
+    // engine for single days and by every multi-location batch.
 
-        return params;
-    }
+    // UTC hours from the date's 0h; NaN = event does not occur
+    struct SolarHours
+    {
+        double transit;
+        double sunrise;
+        double sunset;
+        double asr;
+        double fajr;
+        double isha; // unused with an Isha interval
+    };
 
-    static int internalDhuhrOffsetMinutes(calculation_method calcMethod)
+    static bool isLeapYear(int year)
     {
-        if (calcMethod == MOON_SIGHTING_COMMITTEE)
-            return 5;
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
 
-        if (calcMethod == UMM_AL_QURA || calcMethod == GULF || calcMethod == QATAR)
-            return 0;
+    static int daysSinceSolstice(int dayOfYear, int year, double latitude)
+    {
+        const int daysInYear = isLeapYear(year) ? 366 : 365;
+        if (latitude >= 0)
+        {
+            int days = dayOfYear + 10;
+            return days >= daysInYear ? days - daysInYear : days;
+        }
+        int days = dayOfYear - (isLeapYear(year) ? 173 : 172);
+        return days < 0 ? days + daysInYear : days;
+    }
 
-        return 1;
+    // Moonsighting Committee twilight, minutes, interpolated between the
+    // four seasonal anchors a (solstice) → b → c → d (opposite solstice)
+    static double seasonalTwilightMinutes(double a, double b, double c, double d, int dyy)
+    {
+        if (dyy < 91)
+            return a + (b - a) / 91.0 * dyy;
+        if (dyy < 137)
+            return b + (c - b) / 46.0 * (dyy - 91);
+        if (dyy < 183)
+            return c + (d - c) / 46.0 * (dyy - 137);
+        if (dyy < 229)
+            return d + (c - d) / 46.0 * (dyy - 183);
+        if (dyy < 275)
+            return c + (b - c) / 46.0 * (dyy - 229);
+        return b + (a - b) / 91.0 * (dyy - 275);
     }
 
-    static int internalMaghribOffsetMinutes(calculation_method calcMethod)
+    static time_t seasonAdjustedMorningTwilight(double latitude, int dayOfYear, int year, time_t sunrise)
     {
-        return (calcMethod == MOON_SIGHTING_COMMITTEE) ? 3 : 0;
+        const double lat = std::fabs(latitude);
+        const double minutes = seasonalTwilightMinutes(75 + 28.65 / 55.0 * lat, 75 + 19.44 / 55.0 * lat,
+                                                       75 + 32.74 / 55.0 * lat, 75 + 48.10 / 55.0 * lat,
+                                                       daysSinceSolstice(dayOfYear, year, latitude));
+        return sunrise - std::lround(minutes * 60);
     }
 
-    static void applyDartNetAdjustments(calculation_parameters_t &params, const MethodSpec &spec)
+    static time_t seasonAdjustedEveningTwilight(double latitude, int dayOfYear, int year, time_t sunset)
     {
-        const auto &net = spec.dartNet;
+        const double lat = std::fabs(latitude);
+        const double minutes = seasonalTwilightMinutes(75 + 25.60 / 55.0 * lat, 75 + 2.050 / 55.0 * lat,
+                                                       75 - 9.210 / 55.0 * lat, 75 + 6.140 / 55.0 * lat,
+                                                       daysSinceSolstice(dayOfYear, year, latitude));
+        return sunset + std::lround(minutes * 60);
+    }
 
-        params.adjustments.fajr = net.fajr;
-        params.adjustments.sunrise = net.sunrise;
-        params.adjustments.asr = net.asr;
-        params.adjustments.isha = net.isha;
+    // Solar hours → epoch through the library's own time-components path
+    static bool solarEpoch(time_t dateEpoch, double hours, time_t &out)
+    {
+        if (!std::isfinite(hours))
+            return false;
+        time_components_t tc = from_double(hours);
+        if (!is_valid_time(tc))
+            return false;
+        out = get_date_components(dateEpoch, &tc);
+        return true;
+    }
 
-        // C library already applies internal offsets for Dhuhr/Maghrib; compensate so net output matches Dart.
-        params.adjustments.dhuhr = net.dhuhr - internalDhuhrOffsetMinutes(spec.calcMethod);
-        params.adjustments.maghrib = net.maghrib - internalMaghribOffsetMinutes(spec.calcMethod);
+    static time_t roundedMinute(time_t t)
+    {
+        const long sec = (long)(t % 60);
+        return t - sec + (sec >= 30 ? 60 : 0);
     }
 
-    // Diyanet high-latitude rules — KARAR 2006 + 2009 revision
-    //
-    // 2009 KARAR rules:
-    // a) For lat >= 45°: Isha = min(astronomical, Maghrib + şer'î_gece/3)
-    //    Şer'î gece = Maghrib → Fajr (astronomical)
-    // b) If şer'î_gece/3 > 80 dk → cap at 80 dk
-    // c) Mar-Sep: Fajr = Sunrise - (isha_offset + 10 dk)
-    // d) lat >= 62° → clamp to 62° (handled separately by clampLatitudeForDiyanet)
-    //
-    // Logic: use astronomical isha unless it exceeds the KARAR limit.
-    static constexpr double DIYANET_HIGH_LAT_THRESHOLD = 45.0;
-    static constexpr double DIYANET_MAX_LAT_CLAMP = 62.0;
-    static constexpr int DIYANET_ISHA_CAP_MINUTES = 80; // 1 hour 20 minutes
-    static constexpr int DIYANET_FAJR_EXTRA_MINUTES = 10;
-
-    static void applyDiyanetHighLatitudeRules(prayer_times_t &times, double latitude, int month)
+    // False when sunrise/sunset/Asr do not occur; the caller then defers to
+    // the library so polar days keep its exact behaviour.
+    static bool composeTimes(const calculation_parameters_t &params, const MethodRegistry::NetAdjustments &net,
+                             double latitude, const SolarHours &solar, const PrayerCalculator::CalcDate &day,
+                             time_t dateEpoch, long offset_seconds, prayer_times_t &times)
     {
-        if (latitude < DIYANET_HIGH_LAT_THRESHOLD)
+        const bool moonsighting = params.method == MOON_SIGHTING_COMMITTEE;
+
+        time_t dhuhr, sunrise, sunset, asr;
+        if (!solarEpoch(dateEpoch, solar.transit, dhuhr) || !solarEpoch(dateEpoch, solar.sunrise, sunrise) ||
+            !solarEpoch(dateEpoch, solar.sunset, sunset) || !solarEpoch(dateEpoch, solar.asr, asr))
         {
-            return; // No adjustments needed below 45°
+            return false;
         }
 
-        const time_t maghrib = times.maghrib;
-        const time_t sunrise = times.sunrise;
-        const time_t fajr_astro = times.fajr;
-        const time_t isha_astro = times.isha;
-
-        // Şer'î gece = Maghrib → Fajr (astronomical)
-        // fajr_astro is next morning, so difference is positive
-        int seriGeceSeconds = (int)difftime(fajr_astro, maghrib);
-        if (seriGeceSeconds <= 0)
+        const double night = (double)(sunrise + 24 * 3600 - sunset);
+        double fajrPortion = 0.5, ishaPortion = 0.5;
+        if (params.highLatitudeRule == SEVENTH_OF_THE_NIGHT)
         {
-            seriGeceSeconds += 24 * 3600; // safety wrap
+            fajrPortion = ishaPortion = 1.0 / 7.0;
         }
-
-        // KARAR: 1/3 of şer'î gece (uncapped, for comparison)
-        int nightThirdSeconds = seriGeceSeconds / 3;
-
-        // Astronomical Isha offset from Maghrib
-        int astroIshaOffset = (int)difftime(isha_astro, maghrib);
-        if (astroIshaOffset <= 0)
+        else if (params.highLatitudeRule == TWILIGHT_ANGLE)
         {
-            astroIshaOffset += 24 * 3600;
+            fajrPortion = params.fajrAngle / 60.0;
+            ishaPortion = params.ishaAngle / 60.0;
         }
+        const int dayOfYear = daysFromCivil(day.year, day.month, day.day) - daysFromCivil(day.year, 1, 1) + 1;
 
-        // Compare astronomical with UNCAPPED 1/3 night:
-        // - Winter: astro < nightThird → keep astronomical
-        // - Summer: astro > nightThird (or astro invalid) → apply KARAR with 80dk cap
-        if (astroIshaOffset <= nightThirdSeconds && astroIshaOffset > 0 && astroIshaOffset < 12 * 3600)
+        time_t fajr;
+        bool fajrValid = solarEpoch(dateEpoch, solar.fajr, fajr);
+        if (moonsighting && latitude >= 55)
         {
-            // Astronomical Isha is earlier than 1/3 of night — keep it (winter)
+            fajr = sunrise - (time_t)(night / 7);
+            fajrValid = true;
+        }
+        const time_t safeFajr = moonsighting
+                                    ? seasonAdjustedMorningTwilight(latitude, dayOfYear, day.year, sunrise)
+                                    : sunrise - (time_t)(fajrPortion * night);
+        if (!fajrValid || fajr < safeFajr)
+            fajr = safeFajr;
+
+        time_t isha;
+        if (params.ishaInterval > 0)
+        {
+            isha = sunset + params.ishaInterval * 60;
         }
         else
         {
-            // Astronomical exceeds 1/3 night or is invalid — apply KARAR
-            // Now apply the 80 dk cap (2009 KARAR rule b)
-            int ishaOffsetSeconds = nightThirdSeconds;
-            const int maxIshaOffset = DIYANET_ISHA_CAP_MINUTES * 60;
-            if (ishaOffsetSeconds > maxIshaOffset)
+            bool ishaValid = solarEpoch(dateEpoch, solar.isha, isha);
+            if (moonsighting && latitude >= 55)
             {
-                ishaOffsetSeconds = maxIshaOffset;
+                isha = sunset + (time_t)(night / 7);
+                ishaValid = true;
             }
+            const time_t safeIsha = moonsighting
+                                        ? seasonAdjustedEveningTwilight(latitude, dayOfYear, day.year, sunset)
+                                        : sunset + (time_t)(ishaPortion * night);
+            if (!ishaValid || isha > safeIsha)
+                isha = safeIsha;
+        }
 
-            times.isha = maghrib + ishaOffsetSeconds;
+        // Library adjustments + its internal Dhuhr/Maghrib offsets = Dart net
+        times.fajr = roundedMinute(fajr + net.fajr * 60) + offset_seconds;
+        times.sunrise = roundedMinute(sunrise + net.sunrise * 60) + offset_seconds;
+        times.dhuhr = roundedMinute(dhuhr + net.dhuhr * 60) + offset_seconds;
+        times.asr = roundedMinute(asr + net.asr * 60) + offset_seconds;
+        times.maghrib = roundedMinute(sunset + net.maghrib * 60) + offset_seconds;
+        times.isha = roundedMinute(isha + net.isha * 60) + offset_seconds;
+        return true;
+    }
 
-            // Rule c) Fajr = Sunrise - (isha_offset + 10 dk) for Mar-Sep
-            if (month >= 3 && month <= 9)
-            {
-                int fajrOffsetSeconds = ishaOffsetSeconds + (DIYANET_FAJR_EXTRA_MINUTES * 60);
-                times.fajr = sunrise - fajrOffsetSeconds;
-            }
-        }
+    template <typename Real>
+    static SolarHours solarHours(const SolarFloat::SolarTime<Real> &solar, const calculation_parameters_t &params)
+    {
+        return {solar.transit,
+                solar.sunrise,
+                solar.sunset,
+                solar.afternoon(params.madhab == madhab_t::HANAFI ? Real(2) : Real(1)),
+                solar.hourAngle(Real(-params.fajrAngle), false),
+                params.ishaInterval > 0 ? NAN : solar.hourAngle(Real(-params.ishaAngle), true)};
     }
 
-    static double clampLatitudeForDiyanet(double latitude)
+    static void calculateDay(const RangeContext &ctx, const PrayerCalculator::CalcDate &day,
+                             DailyPrayers &prayers, bool verbose)
     {
-        // Rule d: For latitudes >= 62°, use 62° for calculation
-        if (latitude >= DIYANET_MAX_LAT_CLAMP)
+        date_components_t date;
+        date.year = day.year;
+        date.month = day.month;
+        date.day = day.day;
+        const time_t dateEpoch = resolve_time(&date);
+
+        // Adhan takes non-const pointers; per-day copies are a few dozen bytes
+        coordinates_t coordinates = ctx.coordinates;
+        calculation_parameters_t params = ctx.params;
+
+        // Offset for the TARGET date (handles DST for future months); taken at
+        // local noon, clear of the early-morning DST switch
+        const long offset_seconds = ctx.zone->localOffsetAt(dateEpoch + 12 * 3600);
+
+        prayer_times_t times;
+#if FLOAT_SOLAR_ENGINE
+        const SolarFloat::SolarTimeF solar(day.year, day.month, day.day, (float)coordinates.latitude,
+                                           (float)coordinates.longitude);
+        if (!composeTimes(ctx.params, ctx.pipeline->spec->dartNet, coordinates.latitude, solarHours(solar, ctx.params),
+                          day, dateEpoch, offset_seconds, times))
         {
-            return DIYANET_MAX_LAT_CLAMP;
+            times = libraryTimes(coordinates, dateEpoch, params, offset_seconds);
         }
-        if (latitude <= -DIYANET_MAX_LAT_CLAMP)
+#else
+        times = libraryTimes(coordinates, dateEpoch, params, offset_seconds);
+#endif
+
+        // Method post-processing: Diyanet KARAR rules (must run AFTER adjustments
+        // are baked in), Tehran's −4.5° Maghrib; steps a method lacks are compiled out
+#if FLOAT_SOLAR_ENGINE
+        const DaySolar daySolar{solar};
+#else
+        const DaySolar daySolar{dateEpoch, &coordinates};
+#endif
+        const MethodRegistry::DayContext post{dateEpoch, offset_seconds, ctx.latitude, date.month};
+        const bool applied = ctx.pipeline->postProcess(times, post, daySolar);
+        if (verbose && ctx.pipeline->spec->has(MethodRegistry::POST_TEHRAN_MAGHRIB))
         {
-            return -DIYANET_MAX_LAT_CLAMP;
+            Serial.println(applied ? "[Calc] Tehran: computed Maghrib using maghribAngle=4.5°"
+                                   : "[Calc] Tehran: hourAngle(-4.5°) invalid, keeping sunset-based Maghrib");
         }
-        return latitude;
+
+        // Store in local time (what the device displays). One offset lookup
+        // per day: the DST switch is in the small hours, before Fajr, so the
+        // noon offset covers all six.
+        storeLocalTimes(times, ctx.zone->localOffsetAt(times.dhuhr), prayers);
     }
+
+    // ── Several locations, one date ─────────────────────────────────
+    // The date's solar terms are shared and the hour angles run in tiles:
+    // in float with the float engine, otherwise in double (the library's
+    // own precision, so the composed times match its per-location calls).
+#if FLOAT_SOLAR_ENGINE
+    using BatchReal = float;
+#else
+    using BatchReal = double;
+#endif
+    constexpr size_t BATCH_TILE = SolarFloat::kBatchTile;
+
+    // Hour angles for the post-processing steps of one batch location
+    struct BatchSolar
+    {
+        const SolarFloat::SolarDay<BatchReal> &day;
+        BatchReal latitude;
+        BatchReal longitude;
+        BatchReal approxTransit;
+
+        double hourAngle(double angle, bool afterTransit) const
+        {
+            return SolarFloat::hourAngleAt(day, latitude, longitude, approxTransit, (BatchReal)angle, afterTransit);
+        }
+    };
 }
 
 const char *PrayerCalculator::getMethodName(int method)
@@ -245,156 +378,132 @@ bool PrayerCalculator::calculateTimes(DailyPrayers &prayers, int method, double
     }
 
     // Get current date + offset
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo))
+    CalcDate today;
+    if (!TimeZoneRules::localToday(today))
     {
-        // `getLocalTime()` can fail transiently even when system time is set.
-        // Fall back to `time()` + `localtime_r()`.
-        time_t now = time(nullptr);
-        localtime_r(&now, &timeinfo);
-
-        if (timeinfo.tm_year + 1900 < 2020)
+        if (verbose)
         {
-            if (verbose)
-            {
-                Serial.println("[Calc] Failed to get local time");
-            }
-            return false;
+            Serial.println("[Calc] Failed to get local time");
         }
+        return false;
     }
 
     // Apply day offset (0 = today, 1 = tomorrow, etc.)
-    if (day != 0)
-    {
-        timeinfo.tm_mday += day;
-        mktime(&timeinfo); // Normalize
-    }
-
-    // Compute effective UTC offset for the TARGET date (handles DST correctly for future months)
-    long offset_seconds = 0;
-    {
-        struct tm local_copy = timeinfo;
-        time_t local_epoch = mktime(&local_copy); // interprets tm as local time for that date
-
-        struct tm utc_tm;
-        gmtime_r(&local_epoch, &utc_tm);    // convert to UTC representation
-        time_t utc_epoch = mktime(&utc_tm); // interprets as local, so difference yields offset
-
-        offset_seconds = (long)(local_epoch - utc_epoch);
-    }
-
-    // Setup Adhan calculation parameters
-    coordinates_t coordinates;
-    coordinates.latitude = latitude;
-    coordinates.longitude = longitude;
-
-    // Check if using Diyanet method - apply latitude clamping for 62°+ rule
-    const bool isDiyanetMethod = (method == PRAYER_METHOD_DIYANET);
-    if (isDiyanetMethod)
-    {
-        coordinates.latitude = clampLatitudeForDiyanet(latitude);
-    }
+    const CalcDate date = civilFromDays(daysFromCivil(today) + day);
 
-    date_components_t date;
-    date.year = timeinfo.tm_year + 1900;
-    date.month = timeinfo.tm_mon + 1;
-    date.day = timeinfo.tm_mday;
+    const RangeContext ctx = makeRangeContext(method, latitude, longitude, verbose);
+    calculateDay(ctx, date, prayers, verbose);
 
-    const auto *spec = findMethodSpec(method);
-    if (!spec)
+    if (verbose)
     {
-        if (verbose)
+        Serial.println("\n=== PRAYER TIMES CALCULATED (Adhan Library) ===");
+        Serial.printf("Date    : %04d-%02d-%02d\n", date.year, date.month, date.day);
+        Serial.printf("Method  : %s\n", getMethodName(method));
+        for (uint8_t i = 0; i < 6; ++i)
         {
-            Serial.printf("[Calc] Unknown method %d, defaulting to MWL\n", method);
+            const auto type = PrayerType(i);
+            Serial.printf("%-8s: %s\n", getPrayerName(type).data(),
+                          prayers[type].format().data());
         }
-        spec = &defaultMethodSpec();
+        Serial.println("============================\n");
     }
 
-    auto params = buildParameters(*spec);
-    applyDartNetAdjustments(params, *spec);
+    return true;
+}
 
-    const time_t dateEpoch = resolve_time(&date);
+int PrayerCalculator::calculateRange(int method, double latitude, double longitude,
+                                     const CalcDate &start, int days, DailyPrayers out[])
+{
+    if (!out || days <= 0 || start.month < 1 || start.month > 12 || start.day < 1 || start.day > 31)
+        return 0;
 
-    // Adhan C library provides a TZ-hours API. Use it when offset is whole hours.
-    // For half/quarter-hour timezones, fall back to applying the exact seconds offset.
-    prayer_times_t times;
-    if ((offset_seconds % 3600) == 0)
+    // Method parameters and coordinates are built once for the whole range
+    const RangeContext ctx = makeRangeContext(method, latitude, longitude, false);
+    int32_t dayNumber = daysFromCivil(start.year, start.month, start.day);
+    for (int i = 0; i < days; i++, dayNumber++)
     {
-        const int tzHours = (int)(offset_seconds / 3600);
-        times = new_prayer_times_with_tz(&coordinates, dateEpoch, &params, tzHours);
-    }
-    else
-    {
-        times = new_prayer_times2(&coordinates, dateEpoch, &params);
-        times.fajr += offset_seconds;
-        times.sunrise += offset_seconds;
-        times.dhuhr += offset_seconds;
-        times.asr += offset_seconds;
-        times.maghrib += offset_seconds;
-        times.isha += offset_seconds;
+        calculateDay(ctx, civilFromDays(dayNumber), out[i], false);
     }
+    return days;
+}
 
-    // Diyanet high-latitude KARAR rules (must run AFTER adjustments are baked in)
-    if (isDiyanetMethod)
+int PrayerCalculator::calculateLocations(int method, const CalcDate &date, const Locations &locations,
+                                         DailyPrayers out[])
+{
+    if (!out || !locations.latitude || !locations.longitude || !locations.utcOffsetSeconds ||
+        locations.count <= 0 || date.month < 1 || date.month > 12 || date.day < 1 || date.day > 31)
+        return 0;
+
+    const auto *pipeline = MethodRegistry::pipelineFor<BatchSolar>(method);
+    if (!pipeline)
+        pipeline = MethodRegistry::pipelineFor<BatchSolar>(MethodRegistry::DEFAULT_METHOD);
+    const calculation_parameters_t params = pipeline->parameters();
+    const MethodRegistry::NetAdjustments &net = pipeline->spec->dartNet;
+
+    // Shared by every location: declination, right ascension, sidereal time
+    const SolarFloat::SolarDay<BatchReal> day(date.year, date.month, date.day);
+    date_components_t components;
+    components.year = date.year;
+    components.month = date.month;
+    components.day = date.day;
+    const time_t dateEpoch = resolve_time(&components);
+
+    using SolarFloat::Uniform;
+    const Uniform<BatchReal> horizon{BatchReal(-50.0 / 60.0)};
+    const Uniform<BatchReal> fajrAngle{BatchReal(-params.fajrAngle)};
+    const Uniform<BatchReal> ishaAngle{BatchReal(-params.ishaAngle)};
+    const BatchReal shadow = params.madhab == madhab_t::HANAFI ? 2 : 1;
+
+    for (int base = 0; base < locations.count; base += (int)BATCH_TILE)
     {
-        applyDiyanetHighLatitudeRules(times, latitude, date.month);
-    }
+        const size_t n = std::min<size_t>(BATCH_TILE, locations.count - base);
 
-    // Tehran method: compute Maghrib as sun at -4.5° below horizon
-    // The Adhan C library has no maghribAngle field, so we manually compute
-    // using hourAngle() from the solar_time module.
-    if (spec->warnTehranMaghribAngle)
-    {
-        solar_time_t solarTime = new_solar_time(dateEpoch, &coordinates);
-        time_components_t tc = from_double(hourAngle(&solarTime, -4.5, true));
-        if (is_valid_time(tc))
+        // One tile of locations, structure-of-arrays
+        BatchReal lat[BATCH_TILE], lon[BATCH_TILE], approx[BATCH_TILE], transit[BATCH_TILE];
+        BatchReal sunrise[BATCH_TILE], sunset[BATCH_TILE], asrAngle[BATCH_TILE], asr[BATCH_TILE];
+        BatchReal fajr[BATCH_TILE], isha[BATCH_TILE];
+        for (size_t k = 0; k < n; k++)
         {
-            time_t tehranMaghrib = get_date_components(dateEpoch, &tc);
-            tehranMaghrib += offset_seconds;             // Apply timezone
-            tehranMaghrib += spec->dartNet.maghrib * 60; // Net adjustment (0 for Tehran)
-            times.maghrib = tehranMaghrib;
-            if (verbose)
-            {
-                Serial.println("[Calc] Tehran: computed Maghrib using maghribAngle=4.5°");
-            }
-        }
-        else if (verbose)
-        {
-            Serial.println("[Calc] Tehran: hourAngle(-4.5°) invalid, keeping sunset-based Maghrib");
+            lat[k] = (BatchReal)pipeline->coordinateLatitude(locations.latitude[base + k]);
+            lon[k] = (BatchReal)locations.longitude[base + k];
         }
-    }
 
-    // Format using local time (this is what you want to display on the device).
-    auto formatTime = [](time_t timestamp) -> std::array<char, 6>
-    {
-        struct tm t_local;
-        localtime_r(&timestamp, &t_local);
-        std::array<char, 6> result;
-        snprintf(result.data(), result.size(), "%02d:%02d", t_local.tm_hour, t_local.tm_min);
-        result[5] = '\0';
-        return result;
-    };
-
-    prayers[PrayerType::Fajr].value = formatTime(times.fajr);
-    prayers[PrayerType::Sunrise].value = formatTime(times.sunrise);
-    prayers[PrayerType::Dhuhr].value = formatTime(times.dhuhr);
-    prayers[PrayerType::Asr].value = formatTime(times.asr);
-    prayers[PrayerType::Maghrib].value = formatTime(times.maghrib);
-    prayers[PrayerType::Isha].value = formatTime(times.isha);
+        SolarFloat::transits(day, lon, approx, transit, n);
+        SolarFloat::hourAngles(day, lat, lon, approx, horizon, false, sunrise, n);
+        SolarFloat::hourAngles(day, lat, lon, approx, horizon, true, sunset, n);
+        SolarFloat::afternoonAngles(day, lat, shadow, asrAngle, n);
+        SolarFloat::hourAngles(day, lat, lon, approx, asrAngle, true, asr, n);
+        SolarFloat::hourAngles(day, lat, lon, approx, fajrAngle, false, fajr, n);
+        if (params.ishaInterval > 0)
+            std::fill(isha, isha + n, BatchReal(NAN));
+        else
+            SolarFloat::hourAngles(day, lat, lon, approx, ishaAngle, true, isha, n);
 
-    if (verbose)
-    {
-        Serial.println("\n=== PRAYER TIMES CALCULATED (Adhan Library) ===");
-        Serial.printf("Date    : %04d-%02d-%02d\n", date.year, date.month, date.day);
-        Serial.printf("Method  : %s\n", getMethodName(method));
-        for (uint8_t i = 0; i < 6; ++i)
+        for (size_t k = 0; k < n; k++)
         {
-            const auto type = PrayerType(i);
-            Serial.printf("%-8s: %s\n", getPrayerName(type).data(),
-                          prayers[type].value.data());
+            const int i = base + (int)k;
+            const long offset = locations.utcOffsetSeconds[i];
+            const SolarHours hours = {transit[k], sunrise[k], sunset[k], asr[k], fajr[k], isha[k]};
+
+            prayer_times_t times;
+            if (!composeTimes(params, net, lat[k], hours, date, dateEpoch, offset, times))
+            {
+                coordinates_t coordinates;
+                coordinates.latitude = lat[k];
+                coordinates.longitude = lon[k];
+                calculation_parameters_t libraryParams = params;
+                times = libraryTimes(coordinates, dateEpoch, libraryParams, offset);
+            }
+
+            const MethodRegistry::DayContext post{dateEpoch, offset, (double)locations.latitude[i], date.month};
+            pipeline->postProcess(times, post, BatchSolar{day, lat[k], lon[k], approx[k]});
+            storeLocalTimes(times, offset, out[i]);
         }
-        Serial.println("============================\n");
     }
+    return locations.count;
+}
 
-    return true;
+PrayerCalculator::CalcDate PrayerCalculator::addDays(const CalcDate &date, int days)
+{
+    return civilFromDays(daysFromCivil(date.year, date.month, date.day) + days);
 }
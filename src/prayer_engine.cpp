@@ -2,72 +2,69 @@
 #include "config.h"
 #include "prayer_types.h"
 #include "daily_prayers.h"
-#include "current_time.h"
 #include "network.h"
 #include "prayer_api.h"
 #include "prayer_calculator.h"
+#include "prayer_table.h"
+#include "prayer_timeline.h"
+#include "qibla.h"
 #include "settings_manager.h"
+#include "time_zone_rules.h"
 #include "audio_player.h"
 #include "power_manager.h"
+#include "scheduler.h"
+#include "system_clock.h"
 #include "app_state.h"
 #include <Arduino.h>
-#include <climits>
 #include <cmath>
-#include <optional>
 
 namespace PrayerEngine
 {
     static constexpr uint8_t INVALID_WAKE_LOCK = 0xFF;
     static constexpr int CLOCK_JUMP_THRESHOLD_SEC = 3;
     static constexpr int JUMP_CATCHUP_WINDOW_SEC = Config::PRAYER_WAKE_EARLY_SEC;
-    static constexpr int SECONDS_PER_DAY = 86400;
-    static constexpr int HALF_DAY_SECONDS = SECONDS_PER_DAY / 2;
     static constexpr int PROGRESS_MAX_PERCENT = 100;
+    static constexpr uint32_t PREPARE_DELAY_MS = 60UL * 1000;       // after a rollover or rebuild
+    static constexpr uint32_t PREPARE_RETRY_MS = 10UL * 60 * 1000;  // source unavailable / adhan playing
 
-    static DailyPrayers s_prayers;
-    static std::optional<PrayerType> s_nextPrayer;
-    static int s_nextPrayerSeconds = -1;
-    static int s_slotStartSeconds = -1; // start of current prayer slot (seconds from midnight)
+    static PrayerTimeline::Timeline s_timeline;
+    static PrayerTimeline::Event s_next = {}; // at == 0: nothing ahead
     static bool s_prayersFetched = false;
-    static bool s_showingTomorrow = false;
-    static int s_lastDay = -1;
+    static DailyPrayers s_prepared; // day after tomorrow, ready for the rollover
+    static int32_t s_preparedDay = -1;
 
     static bool s_adhanPlaying = false;
     static uint8_t s_adhanWakeLockId = INVALID_WAKE_LOCK;
-    static int s_prevNowSeconds = -1;
-    static int s_prevSecondsUntil = INT_MAX;
-
-    static int computeSecondsUntil(int nowSeconds)
-    {
-        if (s_nextPrayerSeconds < 0)
-            return -1;
-
-        return s_showingTomorrow
-                   ? (SECONDS_PER_DAY - nowSeconds) + s_nextPrayerSeconds
-                   : s_nextPrayerSeconds - nowSeconds;
-    }
-
-    static bool loadPrayerTimes(int method, int dayOffset = 0)
+    static time_t s_prerollAt = 0; // prayer instant the adhan file is pre-rolled for
+    static time_t s_lastAdhanAt = 0; // last prayer instant handled: never twice, even if the clock goes back
+    static uint8_t s_adhanVolume = 0; // start volume applied by holdScreenForAdhan
+    static AdhanTiming s_timing = {};
+    static time_t s_prevEpoch = 0;     // previous evaluation, wall clock …
+    static unsigned long s_prevMillis = 0; // … and monotonic
+
+    // Times for local day `day` (days since 1970-01-01). `full` may fetch
+    // from the API and (re)build the yearly table; otherwise only what is
+    // stored is read, falling back to a single-day calculation.
+    static bool loadDay(int method, int32_t day, DailyPrayers &out, bool full)
     {
-        const bool wantDiyanet = (method == PRAYER_METHOD_DIYANET);
-        const bool fetchTomorrow = (dayOffset > 0);
-        s_showingTomorrow = fetchTomorrow;
+        const CivilDate::Date date = CivilDate::civilFromDays(day);
 
-        if (wantDiyanet)
+        if (method == PRAYER_METHOD_DIYANET)
         {
-            if (PrayerAPI::getCachedPrayerTimes(s_prayers, fetchTomorrow))
+            if (PrayerTable::lookupDiyanet(SettingsManager::getDiyanetId(), date, out))
+                return true;
+
+            if (PrayerAPI::getCachedPrayerTimes(date, out))
                 return true;
 
-            if (Network::isConnected())
+            if (full && Network::isConnected())
             {
                 Serial.println("[Prayer] Cache miss, fetching from API...");
-                if (PrayerAPI::fetchMonthlyPrayerTimes())
-                {
-                    if (PrayerAPI::getCachedPrayerTimes(s_prayers, fetchTomorrow))
-                        return true;
-                }
+                if (PrayerAPI::fetchMonthlyPrayerTimes() && PrayerAPI::getCachedPrayerTimes(date, out))
+                    return true;
             }
-            Serial.println("[Fallback] Diyanet unavailable, using Adhan calculation");
+            if (full)
+                Serial.println("[Fallback] Diyanet unavailable, using Adhan calculation");
         }
 
         double lat = SettingsManager::getLatitude();
@@ -79,89 +76,178 @@ namespace PrayerEngine
             return false;
         }
 
-        return PrayerCalculator::calculateTimes(s_prayers, method, lat, lng, dayOffset);
+        // Yearly table: a 12-byte read; (re)built from this date on a miss
+        if (PrayerTable::lookupCalculated(method, lat, lng, date, out))
+            return true;
+        if (full && PrayerTable::buildCalculated(method, lat, lng, date) &&
+            PrayerTable::lookupCalculated(method, lat, lng, date, out))
+            return true;
+
+        return PrayerCalculator::calculateRange(method, lat, lng, date, 1, &out) == 1;
     }
 
-    static void displayNextPrayer()
+    // Yesterday, today and tomorrow from scratch; the day after is prepared later
+    static bool buildTimeline(bool full)
     {
-        if (!s_prayersFetched)
-            return;
+        CivilDate::Date date;
+        if (!TimeZoneRules::localToday(date))
+            return false;
 
-        if (s_showingTomorrow)
-            s_nextPrayer = PrayerType::Fajr;
-        else
-            s_nextPrayer = s_prayers.findNext(CurrentTime::now()._minutes);
+        const int32_t today = CivilDate::daysFromCivil(date);
+        const int method = SettingsManager::getPrayerMethod();
+        DailyPrayers days[PrayerTimeline::DAYS];
+        if (!loadDay(method, today, days[1], full) || !loadDay(method, today + 1, days[2], full))
+            return false;
+        // Only yesterday's Isha is used (start of the slot before Fajr)
+        if (!loadDay(method, today - 1, days[0], false))
+            days[0] = DailyPrayers{};
+
+        s_timeline.reset(TimeZoneRules::current(), today, days);
+        s_preparedDay = -1;
+        Scheduler::after(Scheduler::Task::PRAYER_DAY, PREPARE_DELAY_MS);
+        return true;
+    }
 
-        if (!s_nextPrayer)
+    // City name and Qibla for the current location (Qibla only recomputes on change)
+    static void publishLocation()
+    {
+        AppStateHelper::setLocation(SettingsManager::getShortCityName());
+        Qibla::update(SettingsManager::getLatitude(), SettingsManager::getLongitude());
+    }
+
+    // Pick the next event at `now` and push it with its day's times to the UI
+    static void showNext(time_t now)
+    {
+        PrayerTimeline::Event next;
+        if (!s_timeline.next(now, next))
         {
-            s_nextPrayerSeconds = -1;
+            s_next = {};
             AppStateHelper::setNextPrayer("İMSAK", "Yarın");
             return;
         }
+        s_next = next;
 
-        const PrayerType prayer = *s_nextPrayer;
-        const auto &prayerTime = s_prayers[prayer];
-        s_nextPrayerSeconds = prayerTime.toSeconds();
+        const DailyPrayers &day = s_timeline.prayers(next.day);
+        const auto &prayerTime = day[next.prayer];
 
         Serial.printf("[Prayer] Next: %s at %s%s\n",
-                      getPrayerName(prayer).data(),
-                      prayerTime.value.data(),
-                      s_showingTomorrow ? " (tomorrow)" : "");
-
-        const char *nextPrayerLabel = (prayer == PrayerType::Fajr)
-                          ? "İMSAK"
-                                          : getPrayerName(prayer, true).data();
-        AppStateHelper::setNextPrayer(nextPrayerLabel, prayerTime.value.data());
+                      getPrayerName(next.prayer).data(),
+                      prayerTime.format().data(),
+                      next.day == 2 ? " (tomorrow)" : "");
+
+        const char *nextPrayerLabel = (next.prayer == PrayerType::Fajr)
+                                          ? "İMSAK"
+                                          : getPrayerName(next.prayer, true).data();
+        AppStateHelper::setNextPrayer(nextPrayerLabel, prayerTime.format().data());
         AppStateHelper::setPrayerTimes(
-            s_prayers[PrayerType::Fajr].value.data(),
-            s_prayers[PrayerType::Sunrise].value.data(),
-            s_prayers[PrayerType::Dhuhr].value.data(),
-            s_prayers[PrayerType::Asr].value.data(),
-            s_prayers[PrayerType::Maghrib].value.data(),
-            s_prayers[PrayerType::Isha].value.data(),
-            s_showingTomorrow ? static_cast<int>(PrayerType::Fajr) : static_cast<int>(prayer));
-
-        // Track start of current slot for progress calculation
-        if (s_showingTomorrow)
+            day[PrayerType::Fajr].format().data(),
+            day[PrayerType::Sunrise].format().data(),
+            day[PrayerType::Dhuhr].format().data(),
+            day[PrayerType::Asr].format().data(),
+            day[PrayerType::Maghrib].format().data(),
+            day[PrayerType::Isha].format().data(),
+            static_cast<int>(next.prayer));
+    }
+
+    static void finishAdhan(bool ok)
+    {
+        s_adhanPlaying = false;
+        if (s_adhanWakeLockId != INVALID_WAKE_LOCK)
         {
-            s_slotStartSeconds = -1;
-            return;
+            PowerManager::releaseWakeLock(s_adhanWakeLockId);
+            s_adhanWakeLockId = INVALID_WAKE_LOCK;
         }
+        Serial.printf("[Adhan] %s\n", ok ? "Finished OK" : "PLAYBACK FAILED");
+    }
+
+    // Microseconds since the prayer instant `at` (wall clock)
+    static int32_t usSince(time_t at)
+    {
+        return static_cast<int32_t>(SystemClock::nowUs() - static_cast<int64_t>(at) * 1000000);
+    }
 
-        const int nextIdx = static_cast<int>(prayer);
-        s_slotStartSeconds = (nextIdx > 0)
-                                 ? s_prayers[static_cast<PrayerType>(nextIdx - 1)].toSeconds()
-                                 : 0; // before Fajr — slot started at midnight
+    static uint8_t startVolume()
+    {
+        return g_state.muted ? 0 : g_state.volume;
     }
 
-    static void advanceNextPrayerAfterTrigger()
+    static void applyStartVolume()
     {
-        const auto freshNow = CurrentTime::now();
-        auto next = s_prayers.findNext(freshNow._minutes);
-        if (!next)
-        {
-            int method = SettingsManager::getPrayerMethod();
-            s_prayersFetched = loadPrayerTimes(method, 1);
-        }
-        displayNextPrayer();
-        s_prevSecondsUntil = INT_MAX;
+        s_adhanVolume = startVolume();
+        setVolume(s_adhanVolume);
+        setTargetVolume(s_adhanVolume);
     }
 
-    static void finishAdhan(bool ok)
+    static void holdScreenForAdhan(const char *file)
     {
-        s_adhanPlaying = false;
-        if (s_adhanWakeLockId != INVALID_WAKE_LOCK)
+        if (s_adhanWakeLockId == INVALID_WAKE_LOCK)
+            s_adhanWakeLockId = PowerManager::acquireWakeLock("adhan");
+        PowerManager::wakeScreen();
+
+        Serial.printf("[Adhan] Volume: %d%%%s, File: %s\n",
+                      startVolume(), g_state.muted ? " (muted)" : "", file);
+        applyStartVolume();
+    }
+
+    // A few seconds ahead: wake the screen, power the codec and open the
+    // file, so the prayer instant only has to release playback
+    static void prerollAdhan(const PrayerTimeline::Event &event)
+    {
+        if (s_adhanPlaying || s_prerollAt == event.at || s_lastAdhanAt == event.at)
+            return;
+        s_prerollAt = event.at; // once per event, also when it fails
+
+        const auto adhanFile = getAdhanFile(event.prayer);
+        if (adhanFile.empty() || !SettingsManager::getAdhanEnabled(event.prayer))
+            return;
+
+        Serial.printf("[Adhan] Pre-roll for %s\n", getPrayerName(event.prayer).data());
+        holdScreenForAdhan(adhanFile.data());
+        prepareAudioFile(adhanFile.data()); // on failure startAdhan() takes the full path
+    }
+
+    // The prayer the pre-roll was for did not come (clock moved, settings changed)
+    static void cancelPreroll()
+    {
+        if (s_prerollAt == 0)
+            return;
+        s_prerollAt = 0;
+        cancelPreparedAudio();
+        if (!s_adhanPlaying && s_adhanWakeLockId != INVALID_WAKE_LOCK)
         {
             PowerManager::releaseWakeLock(s_adhanWakeLockId);
             s_adhanWakeLockId = INVALID_WAKE_LOCK;
         }
-        Serial.printf("[Adhan] %s\n", ok ? "Finished OK" : "PLAYBACK FAILED");
     }
 
-    static void startAdhan(PrayerType currentPrayer)
+    static void startAdhan(PrayerType currentPrayer, time_t at)
     {
-        if (!s_prayersFetched || s_adhanPlaying)
+        if (!s_prayersFetched || s_adhanPlaying || s_lastAdhanAt == at)
+            return;
+        s_lastAdhanAt = at;
+
+        // Release a pre-rolled file first; logging and the screen can wait.
+        // The adhan may have been disabled or muted since the pre-roll.
+        bool prerolled = false;
+        if (s_prerollAt == at && SettingsManager::getAdhanEnabled(currentPrayer))
+        {
+            if (startVolume() != s_adhanVolume)
+                applyStartVolume();
+            prerolled = startPreparedAudio();
+        }
+        else
+        {
+            cancelPreroll();
+        }
+        s_prerollAt = 0;
+        if (prerolled)
+        {
+            s_adhanPlaying = true;
+            s_timing = {false, true, usSince(at), 0, s_timing.worstUs};
+            Serial.printf("\n\n🕌 === PRAYER TIME: %s === 🕌\n\n",
+                          getPrayerName(currentPrayer).data());
             return;
+        }
 
         Serial.printf("\n\n🕌 === PRAYER TIME: %s === 🕌\n\n",
                       getPrayerName(currentPrayer).data());
@@ -173,16 +259,10 @@ namespace PrayerEngine
 
         if (shouldPlay)
         {
-            s_adhanWakeLockId = PowerManager::acquireWakeLock("adhan");
-            PowerManager::wakeScreen();
-
-            const uint8_t startVolume = g_state.muted ? 0 : g_state.volume;
-            Serial.printf("[Adhan] Volume: %d%%%s, File: %s\n",
-                          startVolume, g_state.muted ? " (muted)" : "", adhanFile.data());
-            setVolume(startVolume);
-            setTargetVolume(startVolume);
+            holdScreenForAdhan(adhanFile.data());
 
             s_adhanPlaying = true;
+            s_timing = {false, false, usSince(at), 0, s_timing.worstUs};
             if (!playAudioFile(adhanFile.data()))
                 finishAdhan(false);
         }
@@ -193,28 +273,52 @@ namespace PrayerEngine
         }
     }
 
+    // Once the audio task queued the first frame: total start jitter
+    static void reportAdhanTiming()
+    {
+        uint32_t firstFrameUs;
+        if (s_timing.valid || !takeStartLatency(firstFrameUs))
+            return;
+        s_timing.firstFrameUs = firstFrameUs;
+        s_timing.valid = true;
+        const int32_t totalUs = s_timing.triggerUs + static_cast<int32_t>(firstFrameUs);
+        if (totalUs > s_timing.worstUs)
+            s_timing.worstUs = totalUs;
+        Serial.printf("[Adhan] Start jitter %+.1f ms (trigger %+.1f ms, first frame %.1f ms, %s)\n",
+                      totalUs / 1000.0f, s_timing.triggerUs / 1000.0f, firstFrameUs / 1000.0f,
+                      s_timing.prerolled ? "pre-rolled" : "cold start");
+    }
+
+    static void onPrayerDue();
+    static void onPrepareDue();
+
+    // (Re)start the prayer task on the next loop pass; recalculate() can be
+    // the first entry point when boot had no clock
+    static void restartTask()
+    {
+        Scheduler::on(Scheduler::Task::PRAYER, onPrayerDue);
+        Scheduler::on(Scheduler::Task::PRAYER_DAY, onPrepareDue);
+        Scheduler::after(Scheduler::Task::PRAYER, 0);
+    }
+
     bool init()
     {
+
         struct tm timeinfo;
-        if (!getLocalTime(&timeinfo))
+        if (!SystemClock::localTime(timeinfo))
         {
             Serial.println("[Prayer] No clock — cannot calculate times");
             AppStateHelper::setNextPrayer("BEKLE", "--:--");
             return false;
         }
 
-        int method = SettingsManager::getPrayerMethod();
-        s_prayersFetched = loadPrayerTimes(method, 0);
-
-        if (s_prayersFetched && !s_prayers.findNext(CurrentTime::now()._minutes))
-            s_prayersFetched = loadPrayerTimes(method, 1);
+        s_prayersFetched = buildTimeline(true);
 
         if (s_prayersFetched)
         {
-            AppStateHelper::setLocation(SettingsManager::getShortCityName());
-            displayNextPrayer();
-            // Seed crossing guard so a past prayer does not trigger on first tick
-            s_prevSecondsUntil = computeSecondsUntil(CurrentTime::now()._seconds);
+            publishLocation();
+            showNext(SystemClock::now());
+            restartTask();
             return true;
         }
 
@@ -223,16 +327,16 @@ namespace PrayerEngine
         return false;
     }
 
+    // Adhan playback and settings changes: flag checks, no clock reads
     void tick()
     {
         if (!s_prayersFetched)
             return;
 
-        const auto now = CurrentTime::now();
-
         if (s_adhanPlaying)
         {
             setTargetVolume(g_state.muted ? 0 : g_state.volume);
+            reportAdhanTiming();
             if (isAudioFinished())
                 finishAdhan(true);
         }
@@ -241,120 +345,180 @@ namespace PrayerEngine
         {
             SettingsManager::clearRecalculationFlag();
             recalculate();
-            return;
         }
+    }
 
-        // Day transition
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo))
+    // Local midnight after `now`
+    static time_t nextMidnight(time_t now)
+    {
+        const TimeZoneRules::Zone &zone = TimeZoneRules::current();
+        return zone.localMidnight(PrayerCalculator::addDays(zone.localDate(now), 1));
+    }
+
+    // Every second while the countdown is visible or the adhan is near; with
+    // the screen off, only the prayer instant itself or the midnight rollover
+    static void armNext()
+    {
+        const time_t now = SystemClock::now();
+        const long secondsUntil = s_next.at != 0 ? (long)(s_next.at - now) : -1;
+        if (PowerManager::isScreenOn() || s_adhanPlaying ||
+            (secondsUntil >= 0 && secondsUntil <= JUMP_CATCHUP_WINDOW_SEC))
         {
-            if (s_lastDay != -1 && s_lastDay != timeinfo.tm_mday)
-            {
-                Serial.println("[Prayer] New day — reloading");
-                int method = SettingsManager::getPrayerMethod();
-                s_prayersFetched = loadPrayerTimes(method, 0);
-                displayNextPrayer();
-                s_prevSecondsUntil = INT_MAX;
-            }
-            s_lastDay = timeinfo.tm_mday;
+            Scheduler::at(Scheduler::Task::PRAYER, now + 1);
+            return;
         }
+        // Wake for the pre-roll, not the instant itself: from there the window
+        // above ticks every second up to the adhan. Still ahead — the pre-roll
+        // is shorter than that window.
+        time_t next = nextMidnight(now);
+        const time_t preroll = s_next.at - Config::ADHAN_PREROLL_SEC;
+        if (s_next.at > now && preroll < next)
+            next = preroll;
+        Scheduler::at(Scheduler::Task::PRAYER, next);
+    }
 
-        // Cache refresh — also push to UI so display stays current
-        if (s_nextPrayerSeconds == -1)
+    // Day after tomorrow, off the prayer instants and the midnight path, so
+    // the rollover only appends it. May fetch or rebuild the table.
+    static void onPrepareDue()
+    {
+        if (!s_prayersFetched || !s_timeline.valid())
+            return;
+        if (s_adhanPlaying)
         {
-            displayNextPrayer();
-            s_prevSecondsUntil = INT_MAX;
+            Scheduler::after(Scheduler::Task::PRAYER_DAY, PREPARE_RETRY_MS);
+            return;
         }
 
-        if (s_prevNowSeconds >= 0)
+        const int32_t day = s_timeline.today() + 2;
+        if (s_preparedDay == day)
+            return;
+        if (!loadDay(SettingsManager::getPrayerMethod(), day, s_prepared, true))
         {
-            int delta = now._seconds - s_prevNowSeconds;
-            if (delta < -HALF_DAY_SECONDS)
-                delta += SECONDS_PER_DAY;
-            else if (delta > HALF_DAY_SECONDS)
-                delta -= SECONDS_PER_DAY;
+            Serial.println("[Prayer] Could not prepare the day after tomorrow — retrying");
+            Scheduler::after(Scheduler::Task::PRAYER_DAY, PREPARE_RETRY_MS);
+            return;
+        }
+        s_preparedDay = day;
+    }
 
-            if (delta < -CLOCK_JUMP_THRESHOLD_SEC || delta > CLOCK_JUMP_THRESHOLD_SEC)
+    // Local date changed: one day forward appends the prepared day, any
+    // other change (clock set across days) rebuilds from stored data
+    static void rollover(int32_t today)
+    {
+        if (today == s_timeline.today() + 1)
+        {
+            DailyPrayers dayAfter;
+            const bool ready = s_preparedDay == today + 1;
+            if (ready)
+                dayAfter = s_prepared;
+            if (ready || loadDay(SettingsManager::getPrayerMethod(), today + 1, dayAfter, false))
             {
-                const int jumpSecondsUntil = computeSecondsUntil(now._seconds);
-                const bool jumpCatchup = !s_adhanPlaying &&
-                                         s_nextPrayer.has_value() &&
-                                         s_prevSecondsUntil > 0 &&
-                                         s_prevSecondsUntil <= JUMP_CATCHUP_WINDOW_SEC &&
-                                         jumpSecondsUntil <= 0 &&
-                                         jumpSecondsUntil >= -JUMP_CATCHUP_WINDOW_SEC;
-
-                Serial.printf("[Prayer] Clock jump detected (%+d s) — revalidating\n", delta);
-
-                if (jumpCatchup)
-                {
-                    const PrayerType triggeredPrayer = *s_nextPrayer;
-                    advanceNextPrayerAfterTrigger();
-                    startAdhan(triggeredPrayer);
-                    s_prevNowSeconds = now._seconds;
-                    return;
-                }
-
-                displayNextPrayer();
-                s_prevSecondsUntil = INT_MAX;
+                s_timeline.push(TimeZoneRules::current(), dayAfter);
+                Serial.printf("[Prayer] New day — timeline advanced%s\n", ready ? "" : " (day after not prepared)");
+                Scheduler::after(Scheduler::Task::PRAYER_DAY, PREPARE_DELAY_MS);
+                return;
             }
         }
-        s_prevNowSeconds = now._seconds;
 
-        // Adhan check
-        if (s_nextPrayerSeconds > 0)
+        Serial.println("[Prayer] Date changed — rebuilding timeline");
+        s_prayersFetched = buildTimeline(false);
+        if (!s_prayersFetched)
         {
-            const int secondsUntil = computeSecondsUntil(now._seconds);
+            s_timeline.clear();
+            s_next = {};
+        }
+    }
 
-            if (!s_adhanPlaying && s_nextPrayer.has_value() && s_prevSecondsUntil > 0 && secondsUntil <= 0)
-            {
-                AppStateHelper::setCountdown(0);
+    static void evaluate()
+    {
+        // Wall-clock time that passed differently from monotonic time was a
+        // clock step (NTP, RTC, manual) — evaluations can be hours apart
+        const time_t epoch = SystemClock::now();
+        const unsigned long ms = SystemClock::uptimeMs();
+        const time_t prevEpoch = s_prevEpoch;
+        bool jumped = false;
+        if (prevEpoch != 0)
+        {
+            const long delta = (long)(epoch - prevEpoch) - (long)((ms - s_prevMillis + 500) / 1000);
+            jumped = delta < -CLOCK_JUMP_THRESHOLD_SEC || delta > CLOCK_JUMP_THRESHOLD_SEC;
+            if (jumped)
+                Serial.printf("[Prayer] Clock jump detected (%+ld s) — revalidating\n", delta);
+        }
+        s_prevEpoch = epoch;
+        s_prevMillis = ms;
 
-                // Remember triggered prayer, then advance BEFORE adhan
-                // so hero/iftar update during playback
-                PrayerType triggeredPrayer = *s_nextPrayer;
+        const int32_t today = CivilDate::daysFromCivil(TimeZoneRules::current().localDate(epoch));
+        if (today != s_timeline.today())
+            rollover(today);
+        if (!s_prayersFetched)
+            return;
 
-                advanceNextPrayerAfterTrigger();
-                startAdhan(triggeredPrayer);
+        PrayerTimeline::Event next;
+        if (!s_timeline.next(epoch, next) || next.at != s_next.at)
+        {
+            // A prayer time passed, or the clock moved. After a jump only a
+            // prayer that was within the catch-up window on both sides counts.
+            const bool passed = s_next.at != 0 && epoch >= s_next.at;
+            const bool onTime = passed && (!jumped || (prevEpoch >= s_next.at - JUMP_CATCHUP_WINDOW_SEC &&
+                                                       epoch <= s_next.at + JUMP_CATCHUP_WINDOW_SEC));
+            const PrayerType triggeredPrayer = s_next.prayer;
+
+            // Advance BEFORE adhan so hero/iftar update during playback
+            if (passed)
+                AppStateHelper::setCountdown(0);
+            const time_t triggeredAt = s_next.at;
+            showNext(epoch);
+            if (onTime)
+            {
+                startAdhan(triggeredPrayer, triggeredAt);
                 return;
             }
+            cancelPreroll();
+        }
 
-            s_prevSecondsUntil = secondsUntil;
+        if (s_next.at == 0)
+            return;
 
-            AppStateHelper::setCountdown(secondsUntil > 0 ? static_cast<uint32_t>(secondsUntil) : 0);
+        const time_t secondsUntil = s_next.at - epoch;
+        AppStateHelper::setCountdown(secondsUntil > 0 ? static_cast<uint32_t>(secondsUntil) : 0);
+        if (secondsUntil > 0 && secondsUntil <= Config::ADHAN_PREROLL_SEC)
+            prerollAdhan(s_next);
 
-            if (s_slotStartSeconds < 0)
-                return;
+        PrayerTimeline::Event slotStart;
+        if (!s_timeline.previous(slotStart))
+            return;
 
-            const int slotDuration = s_nextPrayerSeconds - s_slotStartSeconds;
-            if (slotDuration <= 0)
-                return;
+        const time_t slotDuration = s_next.at - slotStart.at;
+        if (slotDuration <= 0)
+            return;
 
-            int pct = ((now._seconds - s_slotStartSeconds) * 100) / slotDuration;
-            if (pct < 0)
-                pct = 0;
-            if (pct > PROGRESS_MAX_PERCENT)
-                pct = PROGRESS_MAX_PERCENT;
-            AppStateHelper::setProgress(static_cast<uint8_t>(pct));
-        }
+        long pct = (long)((epoch - slotStart.at) * 100 / slotDuration);
+        if (pct < 0)
+            pct = 0;
+        if (pct > PROGRESS_MAX_PERCENT)
+            pct = PROGRESS_MAX_PERCENT;
+        AppStateHelper::setProgress(static_cast<uint8_t>(pct));
     }
 
-    void recalculate()
+    static void onPrayerDue()
     {
-        int method = SettingsManager::getPrayerMethod();
-        s_prayersFetched = loadPrayerTimes(method, 0);
+        if (s_prayersFetched)
+            evaluate();
+        armNext();
+    }
 
-        if (s_prayersFetched && !s_prayers.findNext(CurrentTime::now()._minutes))
-            s_prayersFetched = loadPrayerTimes(method, 1);
+    void recalculate()
+    {
+        cancelPreroll();
+        s_prayersFetched = buildTimeline(true);
 
         if (s_prayersFetched)
         {
-            s_nextPrayer = std::nullopt;
-            s_nextPrayerSeconds = -1;
-            s_prevSecondsUntil = INT_MAX;
-            AppStateHelper::setLocation(SettingsManager::getShortCityName());
-            displayNextPrayer();
+            s_next = {};
+            publishLocation();
+            showNext(SystemClock::now());
         }
+        restartTask();
     }
 
     bool isReady()
@@ -364,7 +528,7 @@ namespace PrayerEngine
 
     int getSecondsUntilNextPrayer()
     {
-        return computeSecondsUntil(CurrentTime::now()._seconds);
+        return s_next.at != 0 ? static_cast<int>(s_next.at - SystemClock::now()) : -1;
     }
 
     bool isAdhanPlaying()
@@ -372,4 +536,9 @@ namespace PrayerEngine
         return s_adhanPlaying;
     }
 
+    AdhanTiming getLastAdhanTiming()
+    {
+        return s_timing;
+    }
+
 } // namespace PrayerEngine
@@ -0,0 +1,53 @@
+#include "prayer_ephemeris.h"
+#include "prayer_calculator.h"
+#include "time_zone_rules.h"
+#include <Arduino.h>
+#include <algorithm>
+
+namespace
+{
+    constexpr uint16_t CHUNK_DAYS = 31;
+
+    // Offset the calculator displays `date` in (it samples around local noon)
+    static int offsetMinutesFor(const CivilDate::Date &date)
+    {
+        const TimeZoneRules::Zone &zone = TimeZoneRules::current();
+        return zone.localOffsetAt(zone.localMidnight(date) + 12 * 3600) / 60;
+    }
+}
+
+size_t PrayerEphemeris::generate(int method, double latitude, double longitude, const CivilDate::Date &start,
+                                 uint16_t days, uint8_t *out, size_t capacity, uint8_t blockDays)
+{
+    static Encoder encoder; // one block of samples, too big for the loop task stack
+    if (!encoder.begin(out, capacity, start, days, blockDays))
+        return 0;
+
+    const uint32_t t0 = millis();
+    static DailyPrayers chunk[CHUNK_DAYS];
+    for (uint16_t first = 0; first < days; first += CHUNK_DAYS)
+    {
+        const uint16_t count = std::min<uint16_t>(CHUNK_DAYS, days - first);
+        const CivilDate::Date chunkStart = PrayerCalculator::addDays(start, first);
+        if (PrayerCalculator::calculateRange(method, latitude, longitude, chunkStart, count, chunk) != count)
+            return 0;
+        for (uint16_t i = 0; i < count; i++)
+        {
+            if (!encoder.addDay(chunk[i], offsetMinutesFor(PrayerCalculator::addDays(chunkStart, i))))
+            {
+                Serial.println("[Ephemeris] Output buffer too small");
+                return 0;
+            }
+        }
+    }
+
+    const size_t bytes = encoder.finish();
+    Serial.printf("[Ephemeris] %u days (%s) in %u bytes, %lu ms\n", days, PrayerCalculator::getMethodName(method),
+                  (unsigned)bytes, (unsigned long)(millis() - t0));
+    return bytes;
+}
+
+bool PrayerEphemeris::lookup(const uint8_t *blob, size_t len, const CivilDate::Date &date, DailyPrayers &out)
+{
+    return isValid(blob, len) && evaluateDay(blob, date, offsetMinutesFor(date), out);
+}
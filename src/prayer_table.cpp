@@ -0,0 +1,203 @@
+#include "prayer_table.h"
+#include "prayer_calculator.h"
+#include "settings_manager.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <algorithm>
+
+namespace
+{
+    using namespace PrayerTableFormat;
+
+    constexpr const char *TMP_PATH = "/prayers.tmp";
+    constexpr uint16_t WRITE_CHUNK_DAYS = 31;
+
+    struct Slot
+    {
+        const char *path;
+        Header header;
+        bool checked; // header read and CRC verified this boot
+        bool valid;
+    };
+
+    // Indexed by Source
+    static Slot s_slots[] = {
+        {"/prayers_calc.tbl", {}, false, false},
+        {"/prayers_diyanet.tbl", {}, false, false},
+    };
+
+    // Last build that failed to write (e.g. FS full) — don't retry every lookup
+    static Header s_failedBuild = {};
+
+    static Slot &slotFor(Source source)
+    {
+        return s_slots[static_cast<uint8_t>(source)];
+    }
+
+    // Read the header and stream the file once through the CRC
+    static void verify(Slot &slot)
+    {
+        slot.checked = true;
+        slot.valid = false;
+
+        File file = LittleFS.open(slot.path, "r");
+        if (!file)
+            return;
+
+        Header h;
+        if (file.read(reinterpret_cast<uint8_t *>(&h), sizeof(h)) != sizeof(h) || !isValidHeader(h) ||
+            file.size() != fileSize(h.dayCount))
+        {
+            file.close();
+            Serial.printf("[Table] %s: bad header, ignoring\n", slot.path);
+            return;
+        }
+
+        const uint32_t stored = h.crc;
+        h.crc = 0;
+        uint32_t crc = crc32(&h, sizeof(h));
+        uint8_t buf[256];
+        size_t n;
+        while ((n = file.read(buf, sizeof(buf))) > 0)
+            crc = crc32(buf, n, crc);
+        file.close();
+
+        if (crc != stored)
+        {
+            Serial.printf("[Table] %s: CRC mismatch, ignoring\n", slot.path);
+            return;
+        }
+
+        h.crc = stored;
+        slot.header = h;
+        slot.valid = true;
+        Serial.printf("[Table] %s: %u days from %04d-%02d-%02d\n", slot.path, h.dayCount,
+                      h.startYear, h.startMonth, h.startDay);
+    }
+
+    static bool lookup(const Header &key, const CivilDate::Date &date, DailyPrayers &out)
+    {
+        Slot &slot = slotFor(key.source);
+        if (!slot.checked)
+            verify(slot);
+        if (!slot.valid || !sameKey(slot.header, key))
+            return false;
+
+        const int index = dayIndex(slot.header, date);
+        if (index < 0)
+            return false;
+
+        File file = LittleFS.open(slot.path, "r");
+        if (!file)
+            return false;
+        uint16_t record[PRAYERS];
+        const bool ok = file.seek(recordOffset(index)) &&
+                        file.read(reinterpret_cast<uint8_t *>(record), sizeof(record)) == sizeof(record);
+        file.close();
+        return ok && unpackDay(record, out);
+    }
+
+    // Write `header` + records from fill(first, count, chunk) to a temp file,
+    // then rename over the slot's file so a power cut never leaves a torn table.
+    template <typename Fill>
+    static bool writeTable(Header header, Fill fill)
+    {
+        Slot &slot = slotFor(header.source);
+        File file = LittleFS.open(TMP_PATH, "w");
+        if (!file)
+        {
+            Serial.println("[Table] Cannot create temp file");
+            return false;
+        }
+
+        header.crc = 0;
+        uint32_t crc = crc32(&header, sizeof(header));
+        bool ok = file.write(reinterpret_cast<const uint8_t *>(&header), sizeof(header)) == sizeof(header);
+
+        static DailyPrayers chunk[WRITE_CHUNK_DAYS];
+        for (uint16_t first = 0; ok && first < header.dayCount; first += WRITE_CHUNK_DAYS)
+        {
+            const uint16_t count = std::min<uint16_t>(WRITE_CHUNK_DAYS, header.dayCount - first);
+            ok = fill(first, count, chunk);
+            for (uint16_t i = 0; ok && i < count; i++)
+            {
+                uint16_t record[PRAYERS];
+                packDay(chunk[i], record);
+                crc = crc32(record, sizeof(record), crc);
+                ok = file.write(reinterpret_cast<const uint8_t *>(record), sizeof(record)) == sizeof(record);
+            }
+        }
+
+        header.crc = crc;
+        ok = ok && file.seek(0) &&
+             file.write(reinterpret_cast<const uint8_t *>(&header), sizeof(header)) == sizeof(header);
+        file.close();
+
+        if (!ok || !LittleFS.rename(TMP_PATH, slot.path))
+        {
+            LittleFS.remove(TMP_PATH);
+            slot.checked = false; // old file (if any) is untouched — re-verify on next lookup
+            Serial.printf("[Table] ERROR: writing %s failed\n", slot.path);
+            return false;
+        }
+
+        slot.header = header;
+        slot.checked = true;
+        slot.valid = true;
+        return true;
+    }
+}
+
+bool PrayerTable::lookupCalculated(int method, double latitude, double longitude,
+                                   const CivilDate::Date &date, DailyPrayers &out)
+{
+    const Header key = makeHeader(Source::Calculated, method, latitude, longitude, 0,
+                                  SettingsManager::getTimezone(), date, 0);
+    return lookup(key, date, out);
+}
+
+bool PrayerTable::lookupDiyanet(int32_t diyanetId, const CivilDate::Date &date, DailyPrayers &out)
+{
+    const Header key = makeHeader(Source::Diyanet, PRAYER_METHOD_DIYANET, 0, 0, diyanetId, "", date, 0);
+    return lookup(key, date, out);
+}
+
+bool PrayerTable::buildCalculated(int method, double latitude, double longitude, const CivilDate::Date &start,
+                                  uint16_t days)
+{
+    days = std::min(days, MAX_DAYS);
+    const Header header = makeHeader(Source::Calculated, method, latitude, longitude, 0,
+                                     SettingsManager::getTimezone(), start, days);
+    if (s_failedBuild.magic && sameKey(s_failedBuild, header))
+        return false;
+
+    const uint32_t t0 = millis();
+    const bool ok = writeTable(header, [&](uint16_t first, uint16_t count, DailyPrayers *chunk)
+                               { return PrayerCalculator::calculateRange(method, latitude, longitude,
+                                                                         PrayerCalculator::addDays(start, first),
+                                                                         count, chunk) == count; });
+    s_failedBuild = ok ? Header{} : header;
+    if (ok)
+    {
+        Serial.printf("[Table] Built %u days (%s) in %lu ms\n", days, PrayerCalculator::getMethodName(method),
+                      (unsigned long)(millis() - t0));
+    }
+    return ok;
+}
+
+bool PrayerTable::importDiyanet(int32_t diyanetId, const CivilDate::Date &start, const DailyPrayers days[],
+                                uint16_t count)
+{
+    if (!days || count == 0)
+        return false;
+
+    const Header header = makeHeader(Source::Diyanet, PRAYER_METHOD_DIYANET, 0, 0, diyanetId, "", start,
+                                     std::min(count, MAX_DAYS));
+    const bool ok = writeTable(header, [&](uint16_t first, uint16_t n, DailyPrayers *chunk)
+                               {
+                                   std::copy(days + first, days + first + n, chunk);
+                                   return true; });
+    if (ok)
+        Serial.printf("[Table] Imported %u Diyanet days for ilceId=%ld\n", header.dayCount, (long)diyanetId);
+    return ok;
+}
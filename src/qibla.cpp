@@ -0,0 +1,26 @@
+#include "qibla.h"
+#include "app_state.h"
+#include <Arduino.h>
+#include <cmath>
+
+namespace
+{
+    // Location the published values belong to
+    static double s_latitude = NAN;
+    static double s_longitude = NAN;
+}
+
+void Qibla::update(double latitude, double longitude)
+{
+    if (std::isnan(latitude) || std::isnan(longitude))
+        return;
+    if (latitude == s_latitude && longitude == s_longitude)
+        return;
+    s_latitude = latitude;
+    s_longitude = longitude;
+
+    const Result qibla = compute(latitude, longitude);
+    const auto distance = formatDistance(qibla.distanceKm);
+    AppStateHelper::setQibla(roundedDegrees(qibla.bearing), distance.data(), direction(qibla.bearing));
+    Serial.printf("[Qibla] %.1f° (%s), %s\n", qibla.bearing, direction(qibla.bearing), distance.data());
+}
@@ -0,0 +1,46 @@
+#include "religious_calendar.h"
+#include "settings_manager.h"
+#include "time_zone_rules.h"
+#include <Arduino.h>
+
+namespace
+{
+    static ReligiousCalendar::Table s_table;
+    static bool s_built = false;
+
+    // Table for Gregorian `year`, rebuilt only on a year change or after invalidate()
+    static bool ensureYear(int year)
+    {
+        if (s_built && s_table.year() == year)
+            return true;
+
+        const ReligiousCalendar::Adjustment *adjustments = nullptr;
+        const int count = SettingsManager::getHijriAdjustments(adjustments);
+        const uint32_t t0 = micros();
+        s_built = s_table.build(year, adjustments, count);
+        if (s_built)
+            Serial.printf("[Calendar] %d: %d months, %d events, %d adjustments in %lu us\n", year,
+                          s_table.monthCount(), s_table.entryCount(), count, (unsigned long)(micros() - t0));
+        else
+            Serial.printf("[Calendar] Cannot build %d\n", year);
+        return s_built;
+    }
+}
+
+bool ReligiousCalendar::describe(int32_t day, DayInfo &info)
+{
+    return ensureYear(CivilDate::civilFromDays(day).year) && s_table.describe(day, info);
+}
+
+const ReligiousCalendar::Table *ReligiousCalendar::current()
+{
+    CivilDate::Date today;
+    if (!TimeZoneRules::localToday(today) || !ensureYear(today.year))
+        return nullptr;
+    return &s_table;
+}
+
+void ReligiousCalendar::invalidate()
+{
+    s_built = false;
+}
@@ -1,5 +1,6 @@
 #include "rtc_manager.h"
 #include "tft_config.h"
+#include "scheduler.h"
 #include <SensorPCF85063.hpp>
 #include <Arduino.h>
 #include <sys/time.h>
@@ -13,7 +14,6 @@ namespace
     bool s_available = false;
     bool s_validTime = false;
     unsigned long s_lastSyncMs = 0;
-    unsigned long s_lastDriftCheckMs = 0;
     unsigned long s_lastNtpSyncMs = 0;
 
     constexpr uint16_t MIN_VALID_YEAR = 2024;
@@ -50,11 +50,22 @@ namespace RtcManager
         s_lastNtpSyncMs = millis();
     }
 
+    static void correctDriftFromRTC();
+
+    static void onDriftCheckDue()
+    {
+        Scheduler::after(Scheduler::Task::RTC_DRIFT, RTC_DRIFT_CHECK_INTERVAL);
+        correctDriftFromRTC();
+    }
+
     bool init()
     {
         if (s_available)
             return true;
 
+        Scheduler::on(Scheduler::Task::RTC_DRIFT, onDriftCheckDue);
+        Scheduler::after(Scheduler::Task::RTC_DRIFT, RTC_DRIFT_CHECK_INTERVAL);
+
         if (!s_i2cMutex)
             s_i2cMutex = xSemaphoreCreateMutex();
 
@@ -116,6 +127,7 @@ namespace RtcManager
 
         struct timeval tv = {.tv_sec = epoch, .tv_usec = 0};
         settimeofday(&tv, nullptr);
+        Scheduler::clockChanged();
 
         Serial.printf("[RTC] System clock set from RTC: %04u-%02u-%02u %02u:%02u:%02u UTC\n",
                       dt.getYear(), dt.getMonth(), dt.getDay(),
@@ -162,39 +174,36 @@ namespace RtcManager
         return s_available && s_validTime;
     }
 
-    bool periodicSyncTick()
+    unsigned long msUntilSync()
     {
         unsigned long interval = (s_available && s_validTime)
                                      ? NTP_SYNC_INTERVAL_RTC
                                      : NTP_SYNC_INTERVAL_NO_RTC;
 
-        if (millis() - s_lastSyncMs < interval)
-            return false;
-
+        const unsigned long elapsed = millis() - s_lastSyncMs;
         // Don't advance timer here — syncTime() calls resetSyncTimer() on success
-        return true;
+        return elapsed >= interval ? 0 : interval - elapsed;
     }
 
     void resetSyncTimer()
     {
         s_lastSyncMs = millis();
-        s_lastDriftCheckMs = millis();
+        Scheduler::after(Scheduler::Task::NTP_SYNC, msUntilSync());
+        Scheduler::after(Scheduler::Task::RTC_DRIFT, RTC_DRIFT_CHECK_INTERVAL);
     }
 
     void postponeSync(unsigned long ms)
     {
         s_lastSyncMs = millis() - (s_validTime ? NTP_SYNC_INTERVAL_RTC : NTP_SYNC_INTERVAL_NO_RTC) + ms;
+        Scheduler::after(Scheduler::Task::NTP_SYNC, msUntilSync());
     }
 
-    void correctDriftFromRTC()
+    static void correctDriftFromRTC()
     {
         if (!s_available || !s_validTime)
             return;
 
         unsigned long now = millis();
-        if (now - s_lastDriftCheckMs < RTC_DRIFT_CHECK_INTERVAL)
-            return;
-        s_lastDriftCheckMs = now;
 
         if (xSemaphoreTake(s_i2cMutex, pdMS_TO_TICKS(100)) != pdTRUE)
             return;
@@ -226,6 +235,7 @@ namespace RtcManager
         {
             struct timeval tv = {.tv_sec = rtcEpoch, .tv_usec = 0};
             settimeofday(&tv, nullptr);
+            Scheduler::clockChanged();
         };
 
         if (drift < -1)
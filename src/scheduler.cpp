@@ -0,0 +1,130 @@
+#include "scheduler.h"
+#include "system_clock.h"
+#include <Arduino.h>
+#include <atomic>
+
+namespace
+{
+    constexpr uint32_t MAX_WAIT_MS = 1000; // un-scheduled pollers still get a pass every second
+
+    static Scheduler::DeadlineQueue<Scheduler::TASK_COUNT> s_queue;
+    static Scheduler::Handler s_handlers[Scheduler::TASK_COUNT] = {};
+    static uint8_t s_wallClock = 0; // bit per task armed with at()
+    static TaskHandle_t s_loopTask = nullptr;
+    static std::atomic<bool> s_clockChanged{false};
+    static uint32_t s_wakeups = 0;
+
+    // Monotonic, keeps counting through light sleep, never wraps
+    static uint64_t nowMs()
+    {
+        return SystemClock::monotonicMs();
+    }
+
+    static uint8_t bit(Scheduler::Task task)
+    {
+        return static_cast<uint8_t>(1u << static_cast<uint8_t>(task));
+    }
+
+    static_assert(Scheduler::TASK_COUNT <= 8, "s_wallClock is one byte");
+}
+
+void Scheduler::init()
+{
+    s_loopTask = xTaskGetCurrentTaskHandle();
+}
+
+void Scheduler::on(Task task, Handler handler)
+{
+    s_handlers[static_cast<uint8_t>(task)] = handler;
+}
+
+void Scheduler::at(Task task, time_t epoch)
+{
+    // Rounded up to whole ms: never early
+    const int64_t untilUs = static_cast<int64_t>(epoch) * 1000000 - SystemClock::nowUs();
+    const int64_t untilMs = untilUs > 0 ? (untilUs + 999) / 1000 : 0;
+    s_queue.schedule(static_cast<uint8_t>(task), nowMs() + untilMs);
+    s_wallClock |= bit(task);
+}
+
+void Scheduler::after(Task task, uint32_t ms)
+{
+    s_queue.schedule(static_cast<uint8_t>(task), nowMs() + ms);
+    s_wallClock &= ~bit(task);
+}
+
+void Scheduler::cancel(Task task)
+{
+    s_queue.cancel(static_cast<uint8_t>(task));
+    s_wallClock &= ~bit(task);
+}
+
+void Scheduler::clockChanged()
+{
+    s_clockChanged = true;
+    notify();
+}
+
+void Scheduler::notify()
+{
+    if (s_loopTask)
+        xTaskNotifyGive(s_loopTask);
+}
+
+void Scheduler::run()
+{
+    const uint64_t now = nowMs();
+    if (s_clockChanged.exchange(false))
+    {
+        // Wall-clock deadlines were computed against the old time
+        for (uint8_t id = 0; id < TASK_COUNT; id++)
+        {
+            if ((s_wallClock & (1u << id)) && s_queue.pending(id))
+                s_queue.schedule(id, now);
+        }
+    }
+
+    // Only what was due on entry: a handler re-arming itself with after(0)
+    // runs on the next pass, not in a loop here
+    uint8_t id;
+    while ((id = s_queue.popDue(now)) != s_queue.NONE)
+    {
+        s_wallClock &= ~(1u << id);
+        if (s_handlers[id])
+            s_handlers[id]();
+    }
+}
+
+uint32_t Scheduler::msUntilNext(uint32_t maxMs)
+{
+    if (s_queue.empty())
+        return maxMs;
+    const uint64_t now = nowMs();
+    const uint64_t next = s_queue.earliest();
+    const uint64_t untilNext = next > now ? next - now : 0;
+    return untilNext < maxMs ? static_cast<uint32_t>(untilNext) : maxMs;
+}
+
+void Scheduler::wait(uint32_t maxMs)
+{
+    const uint32_t waitMs = msUntilNext(maxMs < MAX_WAIT_MS ? maxMs : MAX_WAIT_MS);
+
+    if (waitMs > 0)
+    {
+        // Round up to whole ticks so a deadline is not woken for a tick early
+        const TickType_t ticks = (waitMs + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        ulTaskNotifyTake(pdTRUE, ticks);
+    }
+    else
+    {
+        ulTaskNotifyTake(pdTRUE, 0); // drop a stale notification, stay responsive
+    }
+    s_wakeups++;
+}
+
+uint32_t Scheduler::takeWakeupCount()
+{
+    const uint32_t count = s_wakeups;
+    s_wakeups = 0;
+    return count;
+}
@@ -1,9 +1,11 @@
 #include "settings_manager.h"
 #include "config.h"
 #include "audio_player.h"
+#include "religious_calendar.h"
 #include <Preferences.h>
 #include <Arduino.h>
 #include <etl/string.h>
+#include <algorithm>
 
 namespace SettingsManager
 {
@@ -46,6 +48,8 @@ namespace SettingsManager
     constexpr const char *KEY_POWER_MODE = "power_mode";
     constexpr const char *KEY_TIMEZONE = "timezone";
     constexpr const char *KEY_MUTED = "muted";
+    constexpr const char *KEY_SAVED_LOCATIONS = "worldLocs";
+    constexpr const char *KEY_HIJRI_ADJUSTMENTS = "hijriAdj";
 
     constexpr const char *DEFAULT_TIMEZONE = "UTC0";
     static constexpr size_t MAX_TZ_LEN = 48;
@@ -71,6 +75,15 @@ namespace SettingsManager
     static uint8_t cachedPowerMode = static_cast<uint8_t>(PowerMode::ALWAYS_ON);
     static int8_t cachedMuted = -1; // -1 = not loaded
     static etl::string<MAX_TZ_LEN> cachedTimezone;
+    static_assert(sizeof(SavedLocation::timezone) == MAX_TZ_LEN, "saved location TZ length");
+
+    // Saved locations, stored as one NVS blob
+    static SavedLocation cachedSavedLocations[MAX_SAVED_LOCATIONS];
+    static int cachedSavedLocationCount = -1; // -1 = not loaded
+
+    // Hijri month adjustments, stored as one NVS blob
+    static ReligiousCalendar::Adjustment cachedHijriAdjustments[ReligiousCalendar::MAX_ADJUSTMENTS];
+    static int cachedHijriAdjustmentCount = -1; // -1 = not loaded
 
     // Available calculation methods
     static const MethodInfo methods[] = {
@@ -628,4 +641,100 @@ namespace SettingsManager
         Serial.printf("[Settings] Timezone: %s\n", posixTz);
         return true;
     }
+
+    int getSavedLocations(const SavedLocation *&locations)
+    {
+        locations = cachedSavedLocations;
+        if (cachedSavedLocationCount < 0)
+        {
+            PreferencesGuard guard(true);
+            if (!guard)
+                return 0;
+
+            const size_t len = preferences.getBytesLength(KEY_SAVED_LOCATIONS);
+            if (len > 0 && len % sizeof(SavedLocation) == 0 && len <= sizeof(cachedSavedLocations) &&
+                preferences.getBytes(KEY_SAVED_LOCATIONS, cachedSavedLocations, len) == len)
+            {
+                cachedSavedLocationCount = (int)(len / sizeof(SavedLocation));
+            }
+            else
+            {
+                cachedSavedLocationCount = 0;
+            }
+        }
+        return cachedSavedLocationCount;
+    }
+
+    bool setSavedLocations(const SavedLocation *locations, int count)
+    {
+        if (count < 0 || count > MAX_SAVED_LOCATIONS || (count > 0 && !locations))
+            return false;
+
+        PreferencesGuard guard(false);
+        if (!guard)
+            return false;
+
+        if (count == 0)
+        {
+            preferences.remove(KEY_SAVED_LOCATIONS);
+        }
+        else if (preferences.putBytes(KEY_SAVED_LOCATIONS, locations, count * sizeof(SavedLocation)) == 0)
+        {
+            return false;
+        }
+
+        std::copy(locations, locations + count, cachedSavedLocations);
+        cachedSavedLocationCount = count;
+        Serial.printf("[Settings] Saved locations: %d\n", count);
+        return true;
+    }
+
+    int getHijriAdjustments(const ReligiousCalendar::Adjustment *&adjustments)
+    {
+        adjustments = cachedHijriAdjustments;
+        if (cachedHijriAdjustmentCount < 0)
+        {
+            PreferencesGuard guard(true);
+            if (!guard)
+                return 0;
+
+            using ReligiousCalendar::Adjustment;
+            const size_t len = preferences.getBytesLength(KEY_HIJRI_ADJUSTMENTS);
+            if (len > 0 && len % sizeof(Adjustment) == 0 && len <= sizeof(cachedHijriAdjustments) &&
+                preferences.getBytes(KEY_HIJRI_ADJUSTMENTS, cachedHijriAdjustments, len) == len)
+            {
+                cachedHijriAdjustmentCount = (int)(len / sizeof(Adjustment));
+            }
+            else
+            {
+                cachedHijriAdjustmentCount = 0;
+            }
+        }
+        return cachedHijriAdjustmentCount;
+    }
+
+    bool setHijriAdjustments(const ReligiousCalendar::Adjustment *adjustments, int count)
+    {
+        if (count < 0 || count > ReligiousCalendar::MAX_ADJUSTMENTS || (count > 0 && !adjustments))
+            return false;
+
+        PreferencesGuard guard(false);
+        if (!guard)
+            return false;
+
+        if (count == 0)
+        {
+            preferences.remove(KEY_HIJRI_ADJUSTMENTS);
+        }
+        else if (preferences.putBytes(KEY_HIJRI_ADJUSTMENTS, adjustments,
+                                      count * sizeof(ReligiousCalendar::Adjustment)) == 0)
+        {
+            return false;
+        }
+
+        std::copy(adjustments, adjustments + count, cachedHijriAdjustments);
+        cachedHijriAdjustmentCount = count;
+        Serial.printf("[Settings] Hijri adjustments: %d\n", count);
+        return true;
+    }
 }
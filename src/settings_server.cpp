@@ -8,6 +8,12 @@
 #include "volume_control.h"
 #include "time_utils.h"
 #include "wifi_credentials.h"
+#include "prayer_calculator.h"
+#include "time_zone_rules.h"
+#include "religious_calendar.h"
+#include "display_ticker.h"
+#include "prayer_engine.h"
+#include "loop_metrics.h"
 #include <WiFi.h>
 #include <WebServer.h>
 #include <esp_wifi.h>
@@ -40,6 +46,12 @@ namespace SettingsServer
     static void handleRestart();
     static void handleGetWifi();
     static void handleSaveWifi();
+    static void handleGetWorld();
+    static void handlePostWorld();
+    static void handleGetCalendar();
+    static void handlePostCalendar();
+    static void handleGetMetrics();
+    static void handleResetMetrics();
     static void handleGetLog();
     static void handleClearLog();
     static void handleNotFound();
@@ -91,6 +103,12 @@ namespace SettingsServer
         server->on("/api/restart", HTTP_POST, handleRestart);
         server->on("/api/wifi", HTTP_GET, handleGetWifi);
         server->on("/api/wifi", HTTP_POST, handleSaveWifi);
+        server->on("/api/world", HTTP_GET, handleGetWorld);
+        server->on("/api/world", HTTP_POST, handlePostWorld);
+        server->on("/api/calendar", HTTP_GET, handleGetCalendar);
+        server->on("/api/calendar", HTTP_POST, handlePostCalendar);
+        server->on("/api/metrics", HTTP_GET, handleGetMetrics);
+        server->on("/api/metrics", HTTP_POST, handleResetMetrics);
         server->onNotFound(handleNotFound);
 
         HttpHelpers::registerBrowserResourceHandlers(server.get());
@@ -355,6 +373,193 @@ namespace SettingsServer
         http.end();
     }
 
+    // Today's times at every saved location, one batch calculation
+    static void handleGetWorld()
+    {
+        using SettingsManager::MAX_SAVED_LOCATIONS;
+        const SettingsManager::SavedLocation *saved = nullptr;
+        const int count = SettingsManager::getSavedLocations(saved);
+        const int method = SettingsManager::getPrayerMethod();
+
+        JsonDocument doc;
+        doc["method"] = method;
+        doc["methodName"] = SettingsManager::getMethodName(method);
+        JsonArray list = doc["locations"].to<JsonArray>();
+
+        CivilDate::Date today;
+        const bool haveDate = count > 0 && TimeZoneRules::localToday(today);
+        DailyPrayers times[MAX_SAVED_LOCATIONS];
+        if (haveDate)
+        {
+            float latitude[MAX_SAVED_LOCATIONS];
+            float longitude[MAX_SAVED_LOCATIONS];
+            int32_t offset[MAX_SAVED_LOCATIONS];
+            TimeZoneRules::Zone zone;
+            for (int i = 0; i < count; i++)
+            {
+                zone.parse(saved[i].timezone); // UTC if unparsable
+                latitude[i] = saved[i].latitude;
+                longitude[i] = saved[i].longitude;
+                offset[i] = zone.localOffsetAt(zone.localMidnight(today) + 12 * 3600);
+            }
+
+            const uint32_t t0 = micros();
+            PrayerCalculator::calculateLocations(method, today, {latitude, longitude, offset, count}, times);
+            Serial.printf("[Settings] World times: %d locations in %lu us\n", count, (unsigned long)(micros() - t0));
+
+            char date[11];
+            snprintf(date, sizeof(date), "%04d-%02d-%02d", today.year, today.month, today.day);
+            doc["date"] = date;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            JsonObject location = list.add<JsonObject>();
+            location["name"] = saved[i].name;
+            location["latitude"] = saved[i].latitude;
+            location["longitude"] = saved[i].longitude;
+            location["timezone"] = saved[i].timezone;
+            if (!haveDate)
+                continue;
+            JsonObject prayerTimes = location["times"].to<JsonObject>();
+            for (uint8_t p = 0; p < 6; p++)
+            {
+                const auto type = PrayerType(p);
+                prayerTimes[getJsonKey(type).data()] = String(times[i][type].format().data());
+            }
+        }
+
+        String response;
+        serializeJson(doc, response);
+        sendJson(HttpHelpers::HTTP_OK, response);
+    }
+
+    // Replaces the saved location list: {"locations":[{name, latitude, longitude, timezone}]}
+    static void handlePostWorld()
+    {
+        if (!server->hasArg("plain"))
+            return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "No body");
+
+        JsonDocument doc;
+        if (deserializeJson(doc, server->arg("plain")))
+            return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "Invalid JSON");
+
+        JsonArray list = doc["locations"];
+        if (list.isNull() || (int)list.size() > SettingsManager::MAX_SAVED_LOCATIONS)
+            return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "Invalid location list");
+
+        SettingsManager::SavedLocation locations[SettingsManager::MAX_SAVED_LOCATIONS] = {};
+        int count = 0;
+        TimeZoneRules::Zone zone;
+        for (JsonObject item : list)
+        {
+            const char *name = item["name"] | "";
+            const char *timezone = item["timezone"] | "";
+            const double latitude = item["latitude"] | NAN;
+            const double longitude = item["longitude"] | NAN;
+            if (name[0] == '\0' || !(latitude >= -90 && latitude <= 90) || !(longitude >= -180 && longitude <= 180) ||
+                strlen(timezone) >= sizeof(locations[0].timezone) || !zone.parse(timezone))
+                return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "Invalid location");
+
+            auto &location = locations[count++];
+            strlcpy(location.name, name, sizeof(location.name));
+            strlcpy(location.timezone, timezone, sizeof(location.timezone));
+            location.latitude = (float)latitude;
+            location.longitude = (float)longitude;
+        }
+
+        if (!SettingsManager::setSavedLocations(locations, count))
+            return sendJsonError(HttpHelpers::HTTP_INTERNAL_ERROR, "Save failed");
+        sendJson(HttpHelpers::HTTP_OK, "{\"success\":true}");
+    }
+
+    static void formatDay(int32_t day, char (&out)[11])
+    {
+        const CivilDate::Date date = CivilDate::civilFromDays(day);
+        snprintf(out, sizeof(out), "%04d-%02d-%02d", date.year, date.month, date.day);
+    }
+
+    // This year's Hijri months and notable days, plus the stored adjustments
+    static void handleGetCalendar()
+    {
+        JsonDocument doc;
+        const ReligiousCalendar::Adjustment *adjustments = nullptr;
+        const int adjustmentCount = SettingsManager::getHijriAdjustments(adjustments);
+        JsonArray adjustmentList = doc["adjustments"].to<JsonArray>();
+        for (int i = 0; i < adjustmentCount; i++)
+        {
+            JsonObject item = adjustmentList.add<JsonObject>();
+            item["year"] = adjustments[i].year;
+            item["month"] = adjustments[i].month;
+            item["days"] = adjustments[i].days;
+        }
+
+        const ReligiousCalendar::Table *table = ReligiousCalendar::current();
+        if (table)
+        {
+            char date[11];
+            doc["year"] = table->year();
+            JsonArray months = doc["months"].to<JsonArray>();
+            for (int i = 0; i < table->monthCount(); i++)
+            {
+                const ReligiousCalendar::MonthStart &month = table->months()[i];
+                JsonObject item = months.add<JsonObject>();
+                item["year"] = month.year;
+                item["month"] = month.month;
+                formatDay(month.day, date);
+                item["start"] = date;
+                item["length"] = month.length;
+            }
+            JsonArray events = doc["events"].to<JsonArray>();
+            for (int i = 0; i < table->entryCount(); i++)
+            {
+                const ReligiousCalendar::Entry &entry = table->entries()[i];
+                JsonObject item = events.add<JsonObject>();
+                formatDay(entry.day, date);
+                item["date"] = date;
+                item["name"] = ReligiousCalendar::eventName(entry.event);
+                item["day"] = entry.ordinal;
+            }
+        }
+
+        String response;
+        serializeJson(doc, response);
+        sendJson(HttpHelpers::HTTP_OK, response);
+    }
+
+    // Replaces the adjustment list: {"adjustments":[{year, month, days}]}, days -1 or +1
+    static void handlePostCalendar()
+    {
+        if (!server->hasArg("plain"))
+            return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "No body");
+
+        JsonDocument doc;
+        if (deserializeJson(doc, server->arg("plain")))
+            return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "Invalid JSON");
+
+        JsonArray list = doc["adjustments"];
+        if (list.isNull() || (int)list.size() > ReligiousCalendar::MAX_ADJUSTMENTS)
+            return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "Invalid adjustment list");
+
+        ReligiousCalendar::Adjustment adjustments[ReligiousCalendar::MAX_ADJUSTMENTS] = {};
+        int count = 0;
+        for (JsonObject item : list)
+        {
+            const int year = item["year"] | 0;
+            const int month = item["month"] | 0;
+            const int days = item["days"] | 0;
+            if (year < 1400 || year > 1600 || month < 1 || month > 12 || (days != -1 && days != 1))
+                return sendJsonError(HttpHelpers::HTTP_BAD_REQUEST, "Invalid adjustment");
+            adjustments[count++] = {(int16_t)year, (uint8_t)month, (int8_t)days};
+        }
+
+        if (!SettingsManager::setHijriAdjustments(adjustments, count))
+            return sendJsonError(HttpHelpers::HTTP_INTERNAL_ERROR, "Save failed");
+        ReligiousCalendar::invalidate();
+        DisplayTicker::forceUpdate(); // Hijri date and events on screen right away
+        sendJson(HttpHelpers::HTTP_OK, "{\"success\":true}");
+    }
+
     static void handleGetStatus()
     {
         JsonDocument doc;
@@ -415,11 +620,55 @@ namespace SettingsServer
             prayer["usingFallback"] = false;
         }
 
+        // Prayer instant → first adhan frame, last start
+        const PrayerEngine::AdhanTiming timing = PrayerEngine::getLastAdhanTiming();
+        if (timing.valid)
+        {
+            JsonObject adhan = prayer["adhanStart"].to<JsonObject>();
+            adhan["prerolled"] = timing.prerolled;
+            adhan["triggerUs"] = timing.triggerUs;
+            adhan["firstFrameUs"] = timing.firstFrameUs;
+            adhan["totalUs"] = timing.triggerUs + static_cast<int32_t>(timing.firstFrameUs);
+            adhan["worstUs"] = timing.worstUs;
+        }
+
         String response;
         serializeJson(doc, response);
         sendJson(HttpHelpers::HTTP_OK, response);
     }
 
+    // Loop timing per module, microseconds (see LoopMetrics)
+    static void handleGetMetrics()
+    {
+        JsonDocument doc;
+        doc["windowMs"] = LoopMetrics::windowMs();
+
+        JsonObject probes = doc["probes"].to<JsonObject>();
+        for (uint8_t i = 0; i < LoopMetrics::PROBE_COUNT; i++)
+        {
+            const auto probe = static_cast<LoopMetrics::Probe>(i);
+            const LoopMetrics::Histogram &h = LoopMetrics::histogram(probe);
+            JsonObject entry = probes[LoopMetrics::name(probe)].to<JsonObject>();
+            entry["count"] = h.count();
+            entry["minUs"] = h.min();
+            entry["p50Us"] = h.percentile(50);
+            entry["p99Us"] = h.percentile(99);
+            entry["maxUs"] = h.max();
+            entry["meanUs"] = h.mean();
+            entry["totalMs"] = static_cast<uint32_t>(h.total() / 1000);
+        }
+
+        String response;
+        serializeJson(doc, response);
+        sendJson(HttpHelpers::HTTP_OK, response);
+    }
+
+    static void handleResetMetrics()
+    {
+        LoopMetrics::reset();
+        sendJson(HttpHelpers::HTTP_OK, "{\"success\":true}");
+    }
+
     static void handleRefresh()
     {
         int method = SettingsManager::getPrayerMethod();
@@ -0,0 +1,26 @@
+#include "system_clock.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+time_t SystemClock::now()
+{
+    return time(nullptr);
+}
+
+int64_t SystemClock::nowUs()
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return static_cast<int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+uint64_t SystemClock::monotonicUs()
+{
+    return static_cast<uint64_t>(esp_timer_get_time());
+}
+
+bool SystemClock::localTime(struct tm &out, uint32_t waitMs)
+{
+    return getLocalTime(&out, waitMs);
+}
@@ -27,56 +27,62 @@ namespace TestMode
         struct tm now_tm;
         localtime_r(&now, &now_tm);
 
-        struct tm start = now_tm;
-        start.tm_mday = 1;
-        start.tm_hour = 12;
-        start.tm_min = 0;
-        start.tm_sec = 0;
-        time_t start_time = mktime(&start);
-
-        const int year = start.tm_year + 1900;
-        const int month = start.tm_mon + 1;
+        const int year = now_tm.tm_year + 1900;
+        const int month = now_tm.tm_mon + 1;
         const int days_this_month = daysInMonth(year, month);
+        const PrayerCalculator::CalcDate start = {(int16_t)year, (int8_t)month, 1};
 
         Serial.printf("  30-DAY PRAYER TIME TEST - Method %d (%04d-%02d)\n", method, year, month);
         Serial.printf("  Location: %.4f, %.4f\n", lat, lon);
         Serial.println("═══════════════════════════════════════════════\n");
+
+        DailyPrayers month_prayers[31];
+        const uint32_t t0 = micros();
+        const int computed = PrayerCalculator::calculateRange(method, lat, lon, start, days_this_month, month_prayers);
+        const uint32_t elapsed_us = micros() - t0;
+
         Serial.println("Date       | Fajr  | Dhuhr | Asr   | Maghrib | Isha");
         Serial.println("-----------|-------|-------|-------|---------|-------");
 
-        int baseOffset = (start_time - now) / 86400;
-
-        for (int day = 0; day < days_this_month; day++)
+        for (int day = 0; day < computed; day++)
         {
-            DailyPrayers prayers;
-            int actualOffset = baseOffset + day;
-
-            if (PrayerCalculator::calculateTimes(prayers, method, lat, lon, actualOffset))
-            {
-                struct tm displayDate = start;
-                displayDate.tm_mday += day;
-                mktime(&displayDate);
-
-                Serial.printf("%04d-%02d-%02d | %s | %s | %s | %s   | %s\n",
-                              displayDate.tm_year + 1900,
-                              displayDate.tm_mon + 1,
-                              displayDate.tm_mday,
-                              prayers[PrayerType::Fajr].value.data(),
-                              prayers[PrayerType::Dhuhr].value.data(),
-                              prayers[PrayerType::Asr].value.data(),
-                              prayers[PrayerType::Maghrib].value.data(),
-                              prayers[PrayerType::Isha].value.data());
-            }
-            else
-            {
-                Serial.printf("Day %d: FAILED\n", day + 1);
-            }
+            const DailyPrayers &prayers = month_prayers[day];
+            Serial.printf("%04d-%02d-%02d | %s | %s | %s | %s   | %s\n",
+                          year, month, day + 1,
+                          prayers[PrayerType::Fajr].format().data(),
+                          prayers[PrayerType::Dhuhr].format().data(),
+                          prayers[PrayerType::Asr].format().data(),
+                          prayers[PrayerType::Maghrib].format().data(),
+                          prayers[PrayerType::Isha].format().data());
+        }
+        if (computed != days_this_month)
+        {
+            Serial.printf("FAILED: %d of %d days computed\n", computed, days_this_month);
         }
 
         Serial.println("-----------|-------|-------|-------|---------|-------");
+        Serial.printf("Computed %d days in %lu us (%lu us/day)\n", computed,
+                      (unsigned long)elapsed_us, (unsigned long)(computed ? elapsed_us / computed : 0));
         Serial.println("\n✅ Test Complete - Copy this output for comparison\n");
     }
 
+    void benchmarkYear(int method, double lat, double lon)
+    {
+        time_t now = time(nullptr);
+        struct tm now_tm;
+        localtime_r(&now, &now_tm);
+        const PrayerCalculator::CalcDate start = {(int16_t)(now_tm.tm_year + 1900), 1, 1};
+
+        static DailyPrayers year_prayers[366]; // ~4 KB, kept off the loop task stack
+        const uint32_t t0 = micros();
+        const int computed = PrayerCalculator::calculateRange(method, lat, lon, start, 366, year_prayers);
+        const uint32_t elapsed_us = micros() - t0;
+
+        Serial.printf("[Test] Year %d, method %d: %d days in %lu ms (%lu us/day)\n",
+                      start.year, method, computed, (unsigned long)(elapsed_us / 1000),
+                      (unsigned long)(computed ? elapsed_us / computed : 0));
+    }
+
     void compareAllMethods(double lat, double lon)
     {
         Serial.println("\n═══════════════════════════════════════════════");
@@ -120,8 +126,8 @@ namespace TestMode
                 Serial.printf("  %2d   | %-37s | %s | %s\n",
                               method,
                               methodNames[method],
-                              prayers[PrayerType::Fajr].value.data(),
-                              prayers[PrayerType::Isha].value.data());
+                              prayers[PrayerType::Fajr].format().data(),
+                              prayers[PrayerType::Isha].format().data());
             }
         }
 
@@ -161,6 +167,7 @@ namespace TestMode
         // Run 30-day test with configured method
         Serial.printf("[Test] Running: 30-day prayer times (Method %d)\n", Config::PRAYER_METHOD);
         print30DaysAdhanLibrary(Config::PRAYER_METHOD, Config::TEST_LATITUDE, Config::TEST_LONGITUDE);
+        benchmarkYear(Config::PRAYER_METHOD, Config::TEST_LATITUDE, Config::TEST_LONGITUDE);
 
         Serial.println("\n╔═══════════════════════════════════════════════╗");
         Serial.println("║          🎉 ALL TESTS COMPLETED 🎉           ║");
@@ -1,6 +1,7 @@
 #include "time_utils.h"
 #include "settings_manager.h"
 #include "rtc_manager.h"
+#include "scheduler.h"
 #include <Arduino.h>
 #include <sys/time.h>
 #include <cmath>
@@ -92,6 +93,7 @@ namespace TimeUtils
 
         struct timeval tv = {localTime - tzOffset, 0};
         settimeofday(&tv, nullptr);
+        Scheduler::clockChanged();
 
         applyTimezone(req.timezoneOffset);
 
@@ -0,0 +1,49 @@
+#include "time_zone_rules.h"
+#include "settings_manager.h"
+#include "system_clock.h"
+#include <Arduino.h>
+#include <cstring>
+
+namespace
+{
+    constexpr size_t MAX_TZ_LEN = 48;             // SettingsManager MAX_TZ_LEN
+    constexpr time_t MIN_VALID_EPOCH = 1577836800; // 2020-01-01, same floor as boot's hasClock()
+
+    static TimeZoneRules::Zone s_zone;
+    static char s_parsedTz[MAX_TZ_LEN] = {};
+    static bool s_parsed = false;
+    static time_t s_nextPrepare = 0; // re-center the transition table on the new year
+}
+
+const TimeZoneRules::Zone &TimeZoneRules::current()
+{
+    const char *tz = SettingsManager::getTimezone();
+    if (!s_parsed || std::strncmp(tz, s_parsedTz, MAX_TZ_LEN) != 0)
+    {
+        if (!s_zone.parse(tz))
+            Serial.printf("[TZ] Cannot parse \"%s\", using UTC\n", tz);
+        std::strncpy(s_parsedTz, tz, MAX_TZ_LEN - 1);
+        s_parsed = true;
+        s_nextPrepare = 0;
+    }
+
+    const time_t now = SystemClock::now();
+    if (now >= MIN_VALID_EPOCH && now >= s_nextPrepare)
+    {
+        const CivilDate::Date today = s_zone.localDate(now);
+        s_zone.prepare(today.year);
+        s_nextPrepare = s_zone.localMidnight({(int16_t)(today.year + 1), 1, 1});
+        Serial.printf("[TZ] %s: rules for %d-%d%s\n", s_parsedTz, today.year - 1, today.year + 1,
+                      s_zone.hasDst() ? "" : " (no DST)");
+    }
+    return s_zone;
+}
+
+bool TimeZoneRules::localToday(CivilDate::Date &date)
+{
+    const time_t now = SystemClock::now();
+    if (now < MIN_VALID_EPOCH)
+        return false;
+    date = current().localDate(now);
+    return true;
+}
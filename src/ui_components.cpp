@@ -42,7 +42,7 @@ namespace UiComponents
         lv_obj_set_size(bar, 480, 48);
         lv_obj_set_pos(bar, 0, 0);
         noScrollNoBorder(bar);
-        lv_obj_set_style_bg_color(bar, COLOR_BG, 0);
+        UiTheme::setBgColor(bar, UiTheme::Role::BG);
         lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
         lv_obj_set_style_pad_left(bar, 16, 0);
         lv_obj_set_style_pad_right(bar, 16, 0);
@@ -61,13 +61,13 @@ namespace UiComponents
         // Leading icon — use built-in LVGL symbols for guaranteed glyph coverage.
         lv_obj_t *pin = lv_label_create(left);
         lv_obj_set_style_text_font(pin, &lv_font_montserrat_14, 0);
-        lv_obj_set_style_text_color(pin, COLOR_DIM, 0);
+        UiTheme::setTextColor(pin, UiTheme::Role::DIM);
         lv_obj_set_style_text_opa(pin, UiTheme::ICON_OPA_DEFAULT, 0);
         lv_label_set_text(pin, icon == StatusBarIcon::SETTINGS ? LV_SYMBOL_SETTINGS : LV_SYMBOL_GPS);
 
         h.lbl_city = lv_label_create(left);
         lv_obj_set_style_text_font(h.lbl_city, FONT_BODY_14, 0);
-        lv_obj_set_style_text_color(h.lbl_city, COLOR_TEXT, 0);
+        UiTheme::setTextColor(h.lbl_city, UiTheme::Role::TEXT);
         lv_obj_set_style_text_letter_space(h.lbl_city, 2, 0);
         lv_label_set_text(h.lbl_city, "");
 
@@ -90,13 +90,13 @@ namespace UiComponents
         lv_obj_set_style_radius(h.mute_btn, 12, 0);
 
         // Raised button: gradient top-to-bottom = convex surface
-        lv_obj_set_style_bg_color(h.mute_btn, COLOR_BTN_HI, 0);
+        UiTheme::setBgColor(h.mute_btn, UiTheme::Role::BTN_HI);
         lv_obj_set_style_bg_opa(h.mute_btn, LV_OPA_COVER, 0);
-        lv_obj_set_style_bg_grad_color(h.mute_btn, COLOR_BTN_LO, 0);
+        UiTheme::setBgGradColor(h.mute_btn, UiTheme::Role::BTN_LO);
         lv_obj_set_style_bg_grad_dir(h.mute_btn, LV_GRAD_DIR_VER, 0);
 
         lv_obj_set_style_border_width(h.mute_btn, 1, 0);
-        lv_obj_set_style_border_color(h.mute_btn, COLOR_BORDER, 0);
+        UiTheme::setBorderColor(h.mute_btn, UiTheme::Role::BORDER);
         lv_obj_set_style_border_opa(h.mute_btn, 130, 0);
 
         // Drop shadow below = elevated feel
@@ -106,8 +106,8 @@ namespace UiComponents
         lv_obj_set_style_shadow_ofs_y(h.mute_btn, 3, 0);
 
         // Pressed: flatten + push down
-        lv_obj_set_style_bg_color(h.mute_btn, COLOR_BTN_LO, LV_STATE_PRESSED);
-        lv_obj_set_style_bg_grad_color(h.mute_btn, COLOR_BTN_LO, LV_STATE_PRESSED);
+        UiTheme::setBgColor(h.mute_btn, UiTheme::Role::BTN_LO, LV_STATE_PRESSED);
+        UiTheme::setBgGradColor(h.mute_btn, UiTheme::Role::BTN_LO, LV_STATE_PRESSED);
         lv_obj_set_style_shadow_width(h.mute_btn, 3, LV_STATE_PRESSED);
         lv_obj_set_style_shadow_opa(h.mute_btn, 30, LV_STATE_PRESSED);
         lv_obj_set_style_shadow_ofs_y(h.mute_btn, 1, LV_STATE_PRESSED);
@@ -127,7 +127,7 @@ namespace UiComponents
         lv_obj_set_size(h.lbl_mute_icon, UiTheme::ICON_SIZE_STATUS, UiTheme::ICON_SIZE_STATUS);
         lv_obj_clear_flag(h.lbl_mute_icon, LV_OBJ_FLAG_CLICKABLE);
         lv_obj_set_style_opa(h.lbl_mute_icon, UiTheme::ICON_OPA_DEFAULT, 0);
-        UiIcons::drawSpeakerIcon(h.lbl_mute_icon, false, COLOR_DIM, true);
+        UiIcons::drawSpeakerIcon(h.lbl_mute_icon, false, UiTheme::Role::DIM, true);
         lv_obj_center(h.lbl_mute_icon);
 
         h.lbl_mute_text = nullptr;
@@ -145,7 +145,7 @@ namespace UiComponents
         lv_obj_remove_style_all(line);
         lv_obj_set_size(line, 480, 1);
         lv_obj_set_pos(line, 0, 47);
-        lv_obj_set_style_bg_color(line, COLOR_GOLD, 0);
+        UiTheme::setBgColor(line, UiTheme::Role::GOLD);
         lv_obj_set_style_bg_opa(line, 170, 0);
         lv_obj_set_style_border_width(line, 0, 0);
         lv_obj_clear_flag(line, LV_OBJ_FLAG_SCROLLABLE);
@@ -186,7 +186,7 @@ namespace UiComponents
         lv_obj_t *line = lv_obj_create(bar);
         lv_obj_set_size(line, SCREEN_W, 1);
         lv_obj_set_pos(line, 0, 0);
-        lv_obj_set_style_bg_color(line, COLOR_DIM, 0);
+        UiTheme::setBgColor(line, UiTheme::Role::DIM);
         lv_obj_set_style_bg_opa(line, LV_OPA_50, 0);
         lv_obj_set_style_border_width(line, 0, 0);
 
@@ -195,7 +195,7 @@ namespace UiComponents
         for (int i = 0; i < 3; i++)
         {
             bool active = (i == activePage);
-            lv_color_t col = active ? COLOR_GOLD : COLOR_DIM;
+            UiTheme::Role col = active ? UiTheme::Role::GOLD : UiTheme::Role::DIM;
 
             lv_obj_t *btn = lv_btn_create(bar);
             lv_obj_remove_style_all(btn);
@@ -250,12 +250,12 @@ namespace UiComponents
             bool active = (i == activePage);
             lv_obj_set_size(dot, active ? 16 : 5, 5);
             lv_obj_set_style_radius(dot, 3, 0);
-            lv_obj_set_style_bg_color(dot, COLOR_GOLD, 0);
+            UiTheme::setBgColor(dot, UiTheme::Role::GOLD);
             lv_obj_set_style_bg_opa(dot, active ? 230 : 82, 0);
             lv_obj_set_style_border_width(dot, 0, 0);
             if (active)
             {
-                lv_obj_set_style_shadow_color(dot, COLOR_GOLD, 0);
+                UiTheme::setShadowColor(dot, UiTheme::Role::GOLD);
                 lv_obj_set_style_shadow_spread(dot, 3, 0);
                 lv_obj_set_style_shadow_opa(dot, 115, 0);
             }
@@ -282,17 +282,17 @@ namespace UiComponents
 
         // Restore raised-button baseline (gradient was set at creation but
         // previous state changes may have overwritten bg_color/grad).
-        lv_obj_set_style_bg_color(h.mute_btn, COLOR_BTN_HI, 0);
+        UiTheme::setBgColor(h.mute_btn, UiTheme::Role::BTN_HI);
         lv_obj_set_style_bg_opa(h.mute_btn, LV_OPA_COVER, 0);
-        lv_obj_set_style_bg_grad_color(h.mute_btn, COLOR_BTN_LO, 0);
-        lv_obj_set_style_border_color(h.mute_btn, COLOR_BORDER, 0);
+        UiTheme::setBgGradColor(h.mute_btn, UiTheme::Role::BTN_LO);
+        UiTheme::setBorderColor(h.mute_btn, UiTheme::Role::BORDER);
         lv_obj_set_style_border_opa(h.mute_btn, 130, 0);
         lv_obj_set_style_shadow_color(h.mute_btn, lv_color_black(), 0);
         lv_obj_set_style_shadow_opa(h.mute_btn, 70, 0);
 
         // Only the icon changes between states
         lv_obj_set_style_opa(h.lbl_mute_icon, UiTheme::ICON_OPA_ACTIVE, 0);
-        UiIcons::drawSpeakerIcon(h.lbl_mute_icon, muted, muted ? COLOR_DIM : COLOR_TEXT, true);
+        UiIcons::drawSpeakerIcon(h.lbl_mute_icon, muted, muted ? UiTheme::Role::DIM : UiTheme::Role::TEXT, true);
     }
 
     // ── Motif tile generation ────────────────────────────────────────
@@ -383,8 +383,8 @@ namespace UiComponents
         lv_obj_remove_style_all(glow);
         lv_obj_set_size(glow, 480, 160);
         lv_obj_set_pos(glow, 0, 0);
-        lv_obj_set_style_bg_color(glow, COLOR_GOLD, 0);
-        lv_obj_set_style_bg_grad_color(glow, COLOR_BG, 0);
+        UiTheme::setBgColor(glow, UiTheme::Role::GOLD);
+        UiTheme::setBgGradColor(glow, UiTheme::Role::BG);
         lv_obj_set_style_bg_grad_dir(glow, LV_GRAD_DIR_VER, 0);
         lv_obj_set_style_bg_opa(glow, 50, 0); // visible gold warmth (~20% blend)
         lv_obj_set_style_border_width(glow, 0, 0);
@@ -0,0 +1,179 @@
+/**
+ * @file ui_digit_atlas.cpp
+ * @brief Pre-rasterized digit sprites for the big mono readouts
+ */
+
+#include "ui_digit_atlas.h"
+#include <cstring>
+
+namespace UiDigitAtlas
+{
+    static int8_t slotFor(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c == ':')
+            return 10;
+        if (c == '-')
+            return 11;
+        return -1;
+    }
+
+    // Same placement as lv_draw_letter(): glyph box relative to the line top
+    static void blendGlyph(lv_color_t *px, lv_coord_t w, lv_coord_t h, const lv_font_t *font,
+                           const lv_font_glyph_dsc_t &g, const uint8_t *bmp, lv_color_t fg, lv_color_t bg)
+    {
+        const lv_coord_t x0 = (w - g.adv_w) / 2 + g.ofs_x;
+        const lv_coord_t y0 = (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+        const uint8_t bpp = g.bpp;
+        const uint8_t mask = (1 << bpp) - 1;
+
+        // Uncompressed fmt_txt bitmaps are one continuous bit stream (rows unpadded)
+        for (lv_coord_t by = 0; by < g.box_h; by++)
+        {
+            const lv_coord_t y = y0 + by;
+            for (lv_coord_t bx = 0; bx < g.box_w; bx++)
+            {
+                const lv_coord_t x = x0 + bx;
+                const uint32_t bit = (uint32_t)(by * g.box_w + bx) * bpp;
+                const uint8_t v = (bmp[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+                if (!v || x < 0 || x >= w || y < 0 || y >= h)
+                    continue;
+                px[y * w + x] = lv_color_mix(fg, bg, (lv_opa_t)(v * 255 / mask));
+            }
+        }
+    }
+
+    static uint8_t builtCount(const Atlas &atlas)
+    {
+        uint8_t n = 0;
+        for (const auto &dsc : atlas.glyph)
+        {
+            if (dsc.data)
+                n++;
+        }
+        return n;
+    }
+
+    bool build(Atlas &atlas, const lv_font_t *font, lv_color_t fg, lv_color_t bg, const char *chars)
+    {
+        lv_font_glyph_dsc_t g;
+        lv_coord_t w = 0;
+        uint8_t count = 0;
+        for (const char *c = chars; *c; c++)
+        {
+            if (slotFor(*c) < 0 || !lv_font_get_glyph_dsc(font, &g, *c, 0))
+                continue;
+            if (g.adv_w > w)
+                w = g.adv_w;
+            count++;
+        }
+        const lv_coord_t h = lv_font_get_line_height(font);
+        if (!count || !w || !h)
+            return false;
+
+        // Re-colouring the same set (theme switch) re-blends into the old block
+        const size_t sprite_px = (size_t)w * h;
+        if (atlas.buf && atlas.cellW == w && atlas.cellH == h && builtCount(atlas) == count)
+        {
+            for (auto &dsc : atlas.glyph)
+            {
+                if (dsc.data)
+                    lv_img_cache_invalidate_src(&dsc);
+                dsc = {};
+            }
+        }
+        else
+        {
+            release(atlas);
+            atlas.buf = (lv_color_t *)lv_mem_alloc(count * sprite_px * sizeof(lv_color_t));
+            if (!atlas.buf)
+                return false;
+        }
+        atlas.cellW = w;
+        atlas.cellH = h;
+
+        lv_color_t *px = atlas.buf;
+        for (const char *c = chars; *c; c++)
+        {
+            const int8_t slot = slotFor(*c);
+            if (slot < 0 || atlas.glyph[slot].data || !lv_font_get_glyph_dsc(font, &g, *c, 0))
+                continue;
+
+            for (size_t i = 0; i < sprite_px; i++)
+                px[i] = bg;
+            const uint8_t *bmp = lv_font_get_glyph_bitmap(font, *c);
+            if (bmp && g.bpp)
+                blendGlyph(px, w, h, font, g, bmp, fg, bg);
+
+            lv_img_dsc_t &dsc = atlas.glyph[slot];
+            dsc.header.always_zero = 0;
+            dsc.header.w = w;
+            dsc.header.h = h;
+            dsc.header.cf = LV_IMG_CF_TRUE_COLOR; // opaque — drawn as a row copy
+            dsc.data_size = sprite_px * sizeof(lv_color_t);
+            dsc.data = (const uint8_t *)px;
+            px += sprite_px;
+        }
+        return true;
+    }
+
+    void release(Atlas &atlas)
+    {
+        for (auto &dsc : atlas.glyph)
+        {
+            if (dsc.data)
+                lv_img_cache_invalidate_src(&dsc);
+            dsc = {};
+        }
+        if (atlas.buf)
+            lv_mem_free(atlas.buf);
+        atlas.buf = nullptr;
+        atlas.cellW = atlas.cellH = 0;
+    }
+
+    const lv_img_dsc_t *get(const Atlas &atlas, char c)
+    {
+        const int8_t slot = slotFor(c);
+        if (slot < 0 || !atlas.glyph[slot].data)
+            return nullptr;
+        return &atlas.glyph[slot];
+    }
+
+    DigitRow createRow(lv_obj_t *parent, const Atlas &atlas, uint8_t cells, lv_coord_t gap)
+    {
+        DigitRow row = {};
+        if (cells > MAX_CELLS)
+            cells = MAX_CELLS;
+
+        row.cont = lv_obj_create(parent);
+        lv_obj_remove_style_all(row.cont);
+        lv_obj_set_size(row.cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+        lv_obj_clear_flag(row.cont, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_flex_flow(row.cont, LV_FLEX_FLOW_ROW);
+        lv_obj_set_style_pad_column(row.cont, gap, 0);
+
+        for (uint8_t i = 0; i < cells; i++)
+        {
+            lv_obj_t *cell = lv_img_create(row.cont);
+            lv_obj_set_size(cell, atlas.cellW, atlas.cellH);
+            lv_obj_clear_flag(cell, LV_OBJ_FLAG_CLICKABLE);
+            row.cells[i] = cell;
+        }
+        row.count = cells;
+        return row;
+    }
+
+    void setText(DigitRow &row, const Atlas &atlas, const char *text)
+    {
+        if (!row.cont || !text)
+            return;
+        for (uint8_t i = 0; i < row.count && text[i]; i++)
+        {
+            const lv_img_dsc_t *src = get(atlas, text[i]);
+            if (src && lv_img_get_src(row.cells[i]) != src)
+                lv_img_set_src(row.cells[i], src);
+        }
+    }
+
+} // namespace UiDigitAtlas
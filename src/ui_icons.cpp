@@ -43,17 +43,17 @@ namespace UiIcons
     // DRAWING HELPERS
     // ═══════════════════════════════════════════════════════════════
 
-    lv_obj_t *drawLine(lv_obj_t *parent, lv_point_t *pts, uint16_t cnt, lv_color_t col)
+    lv_obj_t *drawLine(lv_obj_t *parent, lv_point_t *pts, uint16_t cnt, UiTheme::Role col)
     {
         lv_obj_t *ln = lv_line_create(parent);
         lv_line_set_points(ln, pts, cnt);
-        lv_obj_set_style_line_color(ln, col, 0);
+        UiTheme::setLineColor(ln, col);
         lv_obj_set_style_line_width(ln, 2, 0);
         lv_obj_set_style_line_rounded(ln, true, 0);
         return ln;
     }
 
-    void drawHomeIcon(lv_obj_t *cont, lv_color_t col)
+    void drawHomeIcon(lv_obj_t *cont, UiTheme::Role col)
     {
         drawLine(cont, home_roof, 3, col);
         drawLine(cont, home_roof2, 3, col);
@@ -61,7 +61,7 @@ namespace UiIcons
         drawLine(cont, home_door, 4, col);
     }
 
-    void drawMosqueIcon(lv_obj_t *cont, lv_color_t col)
+    void drawMosqueIcon(lv_obj_t *cont, UiTheme::Role col)
     {
         lv_obj_clean(cont);
 
@@ -69,7 +69,7 @@ namespace UiIcons
         lv_obj_t *minaret_l = lv_obj_create(cont);
         lv_obj_set_size(minaret_l, 4, 20);
         lv_obj_set_pos(minaret_l, 4, 10);
-        lv_obj_set_style_bg_color(minaret_l, col, 0);
+        UiTheme::setBgColor(minaret_l, col);
         lv_obj_set_style_bg_opa(minaret_l, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(minaret_l, 0, 0);
         lv_obj_set_style_radius(minaret_l, 1, 0);
@@ -78,7 +78,7 @@ namespace UiIcons
         lv_obj_t *minaret_r = lv_obj_create(cont);
         lv_obj_set_size(minaret_r, 4, 20);
         lv_obj_set_pos(minaret_r, 24, 10);
-        lv_obj_set_style_bg_color(minaret_r, col, 0);
+        UiTheme::setBgColor(minaret_r, col);
         lv_obj_set_style_bg_opa(minaret_r, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(minaret_r, 0, 0);
         lv_obj_set_style_radius(minaret_r, 1, 0);
@@ -92,7 +92,7 @@ namespace UiIcons
         lv_arc_set_value(dome, 100);
         lv_obj_remove_style(dome, NULL, LV_PART_KNOB);
         lv_obj_set_style_arc_width(dome, 3, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_color(dome, col, LV_PART_INDICATOR);
+        UiTheme::setArcColor(dome, col, LV_PART_INDICATOR);
         lv_obj_set_style_arc_opa(dome, LV_OPA_TRANSP, LV_PART_MAIN);
         lv_obj_clear_flag(dome, LV_OBJ_FLAG_CLICKABLE);
 
@@ -105,7 +105,7 @@ namespace UiIcons
         lv_arc_set_value(crescent, 100);
         lv_obj_remove_style(crescent, NULL, LV_PART_KNOB);
         lv_obj_set_style_arc_width(crescent, 2, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_color(crescent, col, LV_PART_INDICATOR);
+        UiTheme::setArcColor(crescent, col, LV_PART_INDICATOR);
         lv_obj_set_style_arc_opa(crescent, LV_OPA_TRANSP, LV_PART_MAIN);
         lv_obj_clear_flag(crescent, LV_OBJ_FLAG_CLICKABLE);
 
@@ -113,20 +113,20 @@ namespace UiIcons
         lv_obj_t *base = lv_obj_create(cont);
         lv_obj_set_size(base, 28, 3);
         lv_obj_set_pos(base, 2, 28);
-        lv_obj_set_style_bg_color(base, col, 0);
+        UiTheme::setBgColor(base, col);
         lv_obj_set_style_bg_opa(base, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(base, 0, 0);
         lv_obj_set_style_radius(base, 1, 0);
     }
 
-    void drawMenuIcon(lv_obj_t *cont, lv_color_t col)
+    void drawMenuIcon(lv_obj_t *cont, UiTheme::Role col)
     {
         drawLine(cont, menu_line1, 2, col);
         drawLine(cont, menu_line2, 2, col);
         drawLine(cont, menu_line3, 2, col);
     }
 
-    void drawSpeakerIcon(lv_obj_t *cont, bool isMuted, lv_color_t col, bool available)
+    void drawSpeakerIcon(lv_obj_t *cont, bool isMuted, UiTheme::Role col, bool available)
     {
         lv_obj_clean(cont);
         drawLine(cont, speaker_body, 7, col);
@@ -152,7 +152,7 @@ namespace UiIcons
         lv_arc_set_value(wave1, 100);
         lv_obj_remove_style(wave1, NULL, LV_PART_KNOB);
         lv_obj_set_style_arc_width(wave1, 2, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_color(wave1, col, LV_PART_INDICATOR);
+        UiTheme::setArcColor(wave1, col, LV_PART_INDICATOR);
         lv_obj_set_style_arc_opa(wave1, LV_OPA_TRANSP, LV_PART_MAIN);
         lv_obj_clear_flag(wave1, LV_OBJ_FLAG_CLICKABLE);
 
@@ -164,12 +164,12 @@ namespace UiIcons
         lv_arc_set_value(wave2, 100);
         lv_obj_remove_style(wave2, NULL, LV_PART_KNOB);
         lv_obj_set_style_arc_width(wave2, 2, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_color(wave2, col, LV_PART_INDICATOR);
+        UiTheme::setArcColor(wave2, col, LV_PART_INDICATOR);
         lv_obj_set_style_arc_opa(wave2, LV_OPA_TRANSP, LV_PART_MAIN);
         lv_obj_clear_flag(wave2, LV_OBJ_FLAG_CLICKABLE);
     }
 
-    void drawBrightnessIcon(lv_obj_t *cont, lv_color_t col)
+    void drawBrightnessIcon(lv_obj_t *cont, UiTheme::Role col)
     {
         lv_obj_clean(cont);
 
@@ -177,7 +177,7 @@ namespace UiIcons
         lv_obj_set_size(sun_core, 10, 10);
         lv_obj_set_pos(sun_core, 9, 9);
         lv_obj_set_style_radius(sun_core, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_bg_color(sun_core, col, 0);
+        UiTheme::setBgColor(sun_core, col);
         lv_obj_set_style_bg_opa(sun_core, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(sun_core, 0, 0);
         lv_obj_clear_flag(sun_core, LV_OBJ_FLAG_CLICKABLE);
@@ -192,7 +192,7 @@ namespace UiIcons
         drawLine(cont, sun_ray_br, 2, col);
     }
 
-    void drawWiFiIcon(lv_obj_t *cont, lv_color_t col, bool connected)
+    void drawWiFiIcon(lv_obj_t *cont, UiTheme::Role col, bool connected)
     {
         lv_obj_clean(cont);
 
@@ -205,7 +205,7 @@ namespace UiIcons
         lv_arc_set_value(arc1, 100);
         lv_obj_remove_style(arc1, NULL, LV_PART_KNOB);
         lv_obj_set_style_arc_width(arc1, 2, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_color(arc1, col, LV_PART_INDICATOR);
+        UiTheme::setArcColor(arc1, col, LV_PART_INDICATOR);
         lv_obj_set_style_arc_opa(arc1, LV_OPA_TRANSP, LV_PART_MAIN);
         lv_obj_clear_flag(arc1, LV_OBJ_FLAG_CLICKABLE);
 
@@ -218,7 +218,7 @@ namespace UiIcons
         lv_arc_set_value(arc2, 100);
         lv_obj_remove_style(arc2, NULL, LV_PART_KNOB);
         lv_obj_set_style_arc_width(arc2, 2, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_color(arc2, col, LV_PART_INDICATOR);
+        UiTheme::setArcColor(arc2, col, LV_PART_INDICATOR);
         lv_obj_set_style_arc_opa(arc2, LV_OPA_TRANSP, LV_PART_MAIN);
         lv_obj_clear_flag(arc2, LV_OBJ_FLAG_CLICKABLE);
 
@@ -231,7 +231,7 @@ namespace UiIcons
         lv_arc_set_value(arc3, 100);
         lv_obj_remove_style(arc3, NULL, LV_PART_KNOB);
         lv_obj_set_style_arc_width(arc3, 2, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_color(arc3, col, LV_PART_INDICATOR);
+        UiTheme::setArcColor(arc3, col, LV_PART_INDICATOR);
         lv_obj_set_style_arc_opa(arc3, LV_OPA_TRANSP, LV_PART_MAIN);
         lv_obj_clear_flag(arc3, LV_OBJ_FLAG_CLICKABLE);
 
@@ -240,7 +240,7 @@ namespace UiIcons
         lv_obj_set_size(dot, 4, 4);
         lv_obj_set_pos(dot, 14, 15);
         lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_bg_color(dot, col, 0);
+        UiTheme::setBgColor(dot, col);
         lv_obj_set_style_bg_opa(dot, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(dot, 0, 0);
 
@@ -252,7 +252,7 @@ namespace UiIcons
         }
     }
 
-    void drawSyncIcon(lv_obj_t *cont, lv_color_t col, bool synced)
+    void drawSyncIcon(lv_obj_t *cont, UiTheme::Role col, bool synced)
     {
         lv_obj_clean(cont);
         drawLine(cont, check_mark, 3, col);
@@ -17,6 +17,7 @@
 #include "ui_page_clock.h"
 #include "ui_theme.h"
 #include "ui_components.h"
+#include "ui_digit_atlas.h"
 #include "locale_tr.h"
 #include <lvgl.h>
 #include <cstdio>
@@ -30,9 +31,15 @@ namespace UiPageClock
     static lv_obj_t *scr = nullptr;
     static UiComponents::StatusBarHandles sb_handles = {};
     // Clock
-    static lv_obj_t *lbl_h = nullptr;
-    static lv_obj_t *lbl_colon = nullptr;
-    static lv_obj_t *lbl_m = nullptr;
+    // Clock digits are atlas sprites (redrawn every minute, colon every second)
+    static UiDigitAtlas::DigitRow row_h = {};
+    static lv_obj_t *img_colon = nullptr;
+    static UiDigitAtlas::DigitRow row_m = {};
+    static UiDigitAtlas::Atlas digit_atlas = {};
+    static UiDigitAtlas::Atlas colon_atlas = {};     // bright colon
+    static UiDigitAtlas::Atlas colon_dim_atlas = {}; // pulse low phase
+    static constexpr lv_opa_t COLON_DIM_OPA = 26;
+    static constexpr lv_coord_t CLOCK_LETTER_SPACE = 2;
     // Dates
     static lv_obj_t *lbl_date = nullptr;
     static lv_obj_t *lbl_hijri = nullptr;
@@ -48,6 +55,22 @@ namespace UiPageClock
         colonVisible = true;
     }
 
+    // Sprites pre-blended over the plain screen background. A rebuild
+    // re-blends in place, the cells keep their sources.
+    static void buildAtlases()
+    {
+        UiDigitAtlas::build(digit_atlas, FONT_CLOCK_72, COLOR_TEXT, COLOR_BG, "0123456789-");
+        UiDigitAtlas::build(colon_atlas, FONT_CLOCK_72, COLOR_GOLD, COLOR_BG, ":");
+        UiDigitAtlas::build(colon_dim_atlas, FONT_CLOCK_72,
+                            lv_color_mix(COLOR_GOLD, COLOR_BG, COLON_DIM_OPA), COLOR_BG, ":");
+    }
+
+    static void onThemeChanged()
+    {
+        if (scr) // page may be torn down — it rebuilds in the new palette
+            buildAtlases();
+    }
+
     // ── Helpers ─────────────────────────────────────────────────────
     // ── Status bar (h=22) ──────────────────────────────────────────
     // ── Separator gradient ─────────────────────────────────────────
@@ -81,22 +104,19 @@ namespace UiPageClock
         lv_obj_set_flex_align(clock_row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
         lv_obj_set_style_pad_column(clock_row, 0, 0);
 
-        lbl_h = lv_label_create(clock_row);
-        lv_obj_set_style_text_font(lbl_h, FONT_CLOCK_72, 0);
-        lv_obj_set_style_text_color(lbl_h, COLOR_TEXT, 0);
-        lv_obj_set_style_text_letter_space(lbl_h, 2, 0);
-        lv_label_set_text(lbl_h, "--");
+        buildAtlases();
+
+        row_h = UiDigitAtlas::createRow(clock_row, digit_atlas, 2, CLOCK_LETTER_SPACE);
 
-        lbl_colon = lv_label_create(clock_row);
-        lv_obj_set_style_text_font(lbl_colon, FONT_CLOCK_72, 0);
-        lv_obj_set_style_text_color(lbl_colon, COLOR_GOLD, 0);
-        lv_label_set_text(lbl_colon, ":");
+        img_colon = lv_img_create(clock_row);
+        lv_obj_set_size(img_colon, colon_atlas.cellW, colon_atlas.cellH);
+        lv_obj_clear_flag(img_colon, LV_OBJ_FLAG_CLICKABLE);
+        if (const lv_img_dsc_t *colon = UiDigitAtlas::get(colon_atlas, ':'))
+            lv_img_set_src(img_colon, colon);
 
-        lbl_m = lv_label_create(clock_row);
-        lv_obj_set_style_text_font(lbl_m, FONT_CLOCK_72, 0);
-        lv_obj_set_style_text_color(lbl_m, COLOR_TEXT, 0);
-        lv_obj_set_style_text_letter_space(lbl_m, 2, 0);
-        lv_label_set_text(lbl_m, "--");
+        row_m = UiDigitAtlas::createRow(clock_row, digit_atlas, 2, CLOCK_LETTER_SPACE);
+        UiDigitAtlas::setText(row_h, digit_atlas, "--");
+        UiDigitAtlas::setText(row_m, digit_atlas, "--");
 
         // Decorative divider: line + ✦ + line
         lv_obj_t *divider = lv_obj_create(cont);
@@ -113,34 +133,34 @@ namespace UiPageClock
         lv_obj_t *dl = lv_obj_create(divider);
         lv_obj_remove_style_all(dl);
         lv_obj_set_size(dl, 52, 1);
-        lv_obj_set_style_bg_color(dl, COLOR_GOLD, 0);
+        UiTheme::setBgColor(dl, UiTheme::Role::GOLD);
         lv_obj_set_style_bg_opa(dl, 145, 0);
         lv_obj_set_style_border_width(dl, 0, 0);
 
         lv_obj_t *star = lv_label_create(divider);
         lv_obj_set_style_text_font(star, FONT_HEADING_10, 0);
-        lv_obj_set_style_text_color(star, COLOR_GOLD, 0);
+        UiTheme::setTextColor(star, UiTheme::Role::GOLD);
         lv_obj_set_style_text_opa(star, 170, 0);
         lv_label_set_text(star, "\xC2\xB7"); // · middle dot U+00B7 (in font range)
 
         lv_obj_t *dr = lv_obj_create(divider);
         lv_obj_remove_style_all(dr);
         lv_obj_set_size(dr, 52, 1);
-        lv_obj_set_style_bg_color(dr, COLOR_GOLD, 0);
+        UiTheme::setBgColor(dr, UiTheme::Role::GOLD);
         lv_obj_set_style_bg_opa(dr, 145, 0);
         lv_obj_set_style_border_width(dr, 0, 0);
 
         // Gregorian date
         lbl_date = lv_label_create(cont);
         lv_obj_set_style_text_font(lbl_date, FONT_HIJRI_18, 0);
-        lv_obj_set_style_text_color(lbl_date, COLOR_TEXT, 0);
+        UiTheme::setTextColor(lbl_date, UiTheme::Role::TEXT);
         lv_obj_set_style_text_opa(lbl_date, 225, 0);
         lv_label_set_text(lbl_date, "");
 
         // Hijri date
         lbl_hijri = lv_label_create(cont);
         lv_obj_set_style_text_font(lbl_hijri, FONT_PRAYER_24, 0);
-        lv_obj_set_style_text_color(lbl_hijri, COLOR_GOLD_LIGHT, 0);
+        UiTheme::setTextColor(lbl_hijri, UiTheme::Role::GOLD_LIGHT);
         lv_obj_set_style_text_opa(lbl_hijri, 220, 0);
         lv_obj_set_style_pad_top(lbl_hijri, 2, 0);
         lv_label_set_text(lbl_hijri, "");
@@ -152,19 +172,11 @@ namespace UiPageClock
     lv_obj_t *create()
     {
         UiTheme::initStyles();
-
-        if (scr)
-        {
-            lv_obj_del(scr);
-            scr = nullptr;
-            sb_handles = {};
-            lbl_h = lbl_colon = lbl_m = nullptr;
-            lbl_date = lbl_hijri = nullptr;
-        }
+        destroy();
 
         scr = lv_obj_create(nullptr);
         lv_obj_remove_style_all(scr);
-        lv_obj_set_style_bg_color(scr, COLOR_BG, 0);
+        UiTheme::setBgColor(scr, UiTheme::Role::BG);
         lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(scr, 0, 0);
         lv_obj_clear_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
@@ -175,32 +187,47 @@ namespace UiPageClock
         UiComponents::createSeparator(scr);
         buildContent(scr);
         UiComponents::createNavDots(scr, 1);
+        UiTheme::addThemeListener(onThemeChanged);
 
         startColonAnim();
         return scr;
     }
 
+    void destroy()
+    {
+        if (!scr)
+            return;
+        lv_obj_del(scr);
+        scr = nullptr;
+        sb_handles = {};
+        row_h = row_m = {};
+        img_colon = nullptr;
+        lbl_date = lbl_hijri = nullptr;
+
+        // Sprites are the bulk of the page — no screen, no atlases
+        UiDigitAtlas::release(digit_atlas);
+        UiDigitAtlas::release(colon_atlas);
+        UiDigitAtlas::release(colon_dim_atlas);
+    }
+
     lv_obj_t *getScreen() { return scr; }
 
     void setTime(int hour, int minute, int second)
     {
-        if (lbl_h)
-        {
-            char buf[3];
-            snprintf(buf, sizeof(buf), "%02d", hour);
-            lv_label_set_text(lbl_h, buf);
-        }
-        if (lbl_colon)
+        char buf[3];
+        snprintf(buf, sizeof(buf), "%02d", hour);
+        UiDigitAtlas::setText(row_h, digit_atlas, buf);
+
+        if (img_colon)
         {
             colonVisible = !colonVisible;
-            lv_obj_set_style_text_opa(lbl_colon, colonVisible ? LV_OPA_COVER : 26, 0);
-        }
-        if (lbl_m)
-        {
-            char buf[3];
-            snprintf(buf, sizeof(buf), "%02d", minute);
-            lv_label_set_text(lbl_m, buf);
+            const lv_img_dsc_t *colon = UiDigitAtlas::get(colonVisible ? colon_atlas : colon_dim_atlas, ':');
+            if (colon)
+                lv_img_set_src(img_colon, colon);
         }
+
+        snprintf(buf, sizeof(buf), "%02d", minute);
+        UiDigitAtlas::setText(row_m, digit_atlas, buf);
     }
 
     void setGregorianDate(const char *date)
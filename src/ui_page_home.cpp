@@ -13,6 +13,7 @@
 
 #include "ui_page_home.h"
 #include "ui_components.h"
+#include "ui_digit_atlas.h"
 #include "ui_theme.h"
 #include "locale_tr.h"
 #include "app_state.h"
@@ -29,7 +30,7 @@ namespace UiPageHome
     static UiComponents::StatusBarHandles sb_handles = {};
     static lv_obj_t *lbl_next_label = nullptr;
     static lv_obj_t *lbl_prayer_nm = nullptr;
-    static lv_obj_t *lbl_countdown = nullptr;
+    static UiDigitAtlas::DigitRow countdown_row = {};
     static lv_obj_t *iftar_pill = nullptr;
     static lv_obj_t *lbl_iftar_val = nullptr;
 
@@ -46,6 +47,23 @@ namespace UiPageHome
     static lv_obj_t *strip_glow_bar = nullptr; // lives inside active column
     static int8_t cur_active_idx = -1;
 
+    // Countdown sprites: gold-light normally, amber in the last 10 minutes.
+    // Pre-blended over the screen background the row sits on.
+    static constexpr lv_coord_t COUNTDOWN_LETTER_SPACE = 4;
+    static constexpr uint32_t COUNTDOWN_URGENT_S = 600;
+    static UiDigitAtlas::Atlas countdown_atlas = {};
+    static UiDigitAtlas::Atlas countdown_urgent_atlas = {};
+
+    // Theme switch: re-blend the sprites in place (same buffers, same
+    // descriptors), so the row redraws with the new palette.
+    static void onThemeChanged()
+    {
+        if (countdown_atlas.buf)
+            UiDigitAtlas::build(countdown_atlas, FONT_MONO_60, COLOR_GOLD_LIGHT, COLOR_BG);
+        if (countdown_urgent_atlas.buf)
+            UiDigitAtlas::build(countdown_urgent_atlas, FONT_MONO_60, COLOR_AMBER, COLOR_BG);
+    }
+
     // Nav dot pills — MOVED TO UiComponents::createNavDots()
 
     // ── Helpers ────────────────────────────────────────────────────
@@ -70,7 +88,7 @@ namespace UiPageHome
         // 1. "{PrayerName} vaktine" label (~24px)
         lbl_next_label = lv_label_create(hero);
         lv_obj_set_style_text_font(lbl_next_label, FONT_PRAYER_24, 0);
-        lv_obj_set_style_text_color(lbl_next_label, COLOR_TEXT, 0);
+        UiTheme::setTextColor(lbl_next_label, UiTheme::Role::TEXT);
         lv_obj_set_style_text_opa(lbl_next_label, 245, 0);
         lv_obj_set_style_text_letter_space(lbl_next_label, 1, 0);
         lv_label_set_recolor(lbl_next_label, true);
@@ -79,15 +97,10 @@ namespace UiPageHome
         // 2. Prayer name (hidden — merged into vakite label above)
         lbl_prayer_nm = nullptr;
 
-        // 3. Countdown (60px font)
-        lbl_countdown = lv_label_create(hero);
-        lv_obj_set_style_text_font(lbl_countdown, FONT_MONO_60, 0);
-        lv_obj_set_style_text_color(lbl_countdown, COLOR_GOLD_LIGHT, 0);
-        lv_obj_set_style_text_letter_space(lbl_countdown, 4, 0);
-        lv_obj_set_style_shadow_color(lbl_countdown, COLOR_GOLD, 0);
-        lv_obj_set_style_shadow_spread(lbl_countdown, 10, 0);
-        lv_obj_set_style_shadow_opa(lbl_countdown, 58, 0);
-        lv_label_set_text(lbl_countdown, "00:00:00");
+        // 3. Countdown (60px font, atlas sprites instead of a label)
+        UiDigitAtlas::build(countdown_atlas, FONT_MONO_60, COLOR_GOLD_LIGHT, COLOR_BG);
+        countdown_row = UiDigitAtlas::createRow(hero, countdown_atlas, 8, COUNTDOWN_LETTER_SPACE);
+        UiDigitAtlas::setText(countdown_row, countdown_atlas, "00:00:00");
 
         // 4. Iftar pill — HTML-like compact card with left accent line
         iftar_pill = lv_obj_create(parent);
@@ -95,9 +108,9 @@ namespace UiPageHome
         lv_obj_set_size(iftar_pill, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
         lv_obj_align(iftar_pill, LV_ALIGN_TOP_MID, 0, 178);
         lv_obj_set_style_radius(iftar_pill, 4, 0);
-        lv_obj_set_style_bg_color(iftar_pill, COLOR_BG2, 0);
+        UiTheme::setBgColor(iftar_pill, UiTheme::Role::BG2);
         lv_obj_set_style_bg_opa(iftar_pill, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(iftar_pill, COLOR_DIM, 0);
+        UiTheme::setBorderColor(iftar_pill, UiTheme::Role::DIM);
         lv_obj_set_style_border_opa(iftar_pill, 130, 0);
         lv_obj_set_style_border_width(iftar_pill, 3, 0);
         lv_obj_set_style_border_side(iftar_pill, LV_BORDER_SIDE_LEFT, 0);
@@ -116,14 +129,14 @@ namespace UiPageHome
         lv_obj_remove_style_all(idot);
         lv_obj_set_size(idot, 7, 7);
         lv_obj_set_style_radius(idot, 3, 0);
-        lv_obj_set_style_bg_color(idot, COLOR_DIM, 0);
+        UiTheme::setBgColor(idot, UiTheme::Role::DIM);
         lv_obj_set_style_bg_opa(idot, 166, 0);
         lv_obj_set_style_border_width(idot, 0, 0);
 
         // Full text label: "İftara Kaldı 02:31" or "Sahura Kaldı 05:12"
         lbl_iftar_val = lv_label_create(iftar_pill);
         lv_obj_set_style_text_font(lbl_iftar_val, FONT_BODY_12, 0);
-        lv_obj_set_style_text_color(lbl_iftar_val, COLOR_TEXT, 0);
+        UiTheme::setTextColor(lbl_iftar_val, UiTheme::Role::TEXT);
         lv_obj_set_style_text_letter_space(lbl_iftar_val, 1, 0);
         lv_label_set_text(lbl_iftar_val, "");
     }
@@ -135,7 +148,7 @@ namespace UiPageHome
         lv_obj_remove_style_all(strip);
         lv_obj_set_size(strip, 480, 64);
         lv_obj_set_pos(strip, 0, 238);
-        lv_obj_set_style_bg_color(strip, COLOR_STRIP_BG, 0);
+        UiTheme::setBgColor(strip, UiTheme::Role::STRIP_BG);
         lv_obj_set_style_bg_opa(strip, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(strip, 0, 0);
         lv_obj_clear_flag(strip, LV_OBJ_FLAG_SCROLLABLE);
@@ -145,7 +158,7 @@ namespace UiPageHome
         lv_obj_remove_style_all(top_line);
         lv_obj_set_size(top_line, 480, 1);
         lv_obj_set_pos(top_line, 0, 0);
-        lv_obj_set_style_bg_color(top_line, COLOR_GOLD, 0);
+        UiTheme::setBgColor(top_line, UiTheme::Role::GOLD);
         lv_obj_set_style_bg_opa(top_line, 166, 0);
         lv_obj_set_style_border_width(top_line, 0, 0);
         lv_obj_clear_flag(top_line, LV_OBJ_FLAG_SCROLLABLE);
@@ -173,7 +186,7 @@ namespace UiPageHome
                 lv_obj_remove_style_all(div);
                 lv_obj_set_size(div, 1, 63);
                 lv_obj_set_pos(div, i * 80, 1);
-                lv_obj_set_style_bg_color(div, COLOR_BORDER, 0);
+                UiTheme::setBgColor(div, UiTheme::Role::BORDER);
                 lv_obj_set_style_bg_opa(div, LV_OPA_COVER, 0);
                 lv_obj_set_style_border_width(div, 0, 0);
                 lv_obj_clear_flag(div, LV_OBJ_FLAG_SCROLLABLE);
@@ -184,7 +197,7 @@ namespace UiPageHome
             lv_obj_remove_style_all(dot);
             lv_obj_set_size(dot, 0, 0);
             lv_obj_set_style_radius(dot, 1, 0);
-            lv_obj_set_style_bg_color(dot, COLOR_DIM, 0);
+            UiTheme::setBgColor(dot, UiTheme::Role::DIM);
             lv_obj_set_style_bg_opa(dot, LV_OPA_TRANSP, 0);
             lv_obj_set_style_border_width(dot, 0, 0);
             strip_dot[i] = dot;
@@ -192,7 +205,7 @@ namespace UiPageHome
             // name
             lv_obj_t *nm = lv_label_create(col);
             lv_obj_set_style_text_font(nm, FONT_HEADING_12, 0);
-            lv_obj_set_style_text_color(nm, COLOR_TEXT, 0);
+            UiTheme::setTextColor(nm, UiTheme::Role::TEXT);
             lv_obj_set_style_text_opa(nm, LV_OPA_COVER, 0);
             lv_obj_set_style_text_letter_space(nm, 0, 0);
             lv_label_set_text(nm, STRIP_NAMES[i]);
@@ -201,7 +214,7 @@ namespace UiPageHome
             // time
             lv_obj_t *t = lv_label_create(col);
             lv_obj_set_style_text_font(t, FONT_MONO_14, 0);
-            lv_obj_set_style_text_color(t, COLOR_TEXT, 0);
+            UiTheme::setTextColor(t, UiTheme::Role::TEXT);
             lv_obj_set_style_text_opa(t, LV_OPA_COVER, 0);
             lv_obj_set_style_text_letter_space(t, 0, 0);
             lv_label_set_text(t, "--:--");
@@ -220,7 +233,7 @@ namespace UiPageHome
         scr = lv_obj_create(nullptr);
         lv_obj_remove_style_all(scr);
         lv_obj_set_size(scr, 480, 320);
-        lv_obj_set_style_bg_color(scr, COLOR_BG, 0);
+        UiTheme::setBgColor(scr, UiTheme::Role::BG);
         lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
         lv_obj_clear_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
         lv_obj_set_style_border_width(scr, 0, 0);
@@ -232,6 +245,7 @@ namespace UiPageHome
         buildHero(scr);
         buildPrayerStrip(scr);
         UiComponents::createNavDots(scr, 0);
+        UiTheme::addThemeListener(onThemeChanged);
 
         return scr;
     }
@@ -244,16 +258,24 @@ namespace UiPageHome
 
     void setCountdown(uint32_t s)
     {
-        if (!lbl_countdown)
+        if (!countdown_row.cont)
             return;
         char buf[12];
         snprintf(buf, sizeof(buf), "%02lu:%02lu:%02lu",
                  (unsigned long)(s / 3600),
                  (unsigned long)((s % 3600) / 60),
                  (unsigned long)(s % 60));
-        lv_label_set_text(lbl_countdown, buf);
-        lv_color_t col = (s < 600) ? COLOR_AMBER : COLOR_GOLD_LIGHT;
-        lv_obj_set_style_text_color(lbl_countdown, col, 0);
+
+        const UiDigitAtlas::Atlas *atlas = &countdown_atlas;
+        if (s < COUNTDOWN_URGENT_S)
+        {
+            // Built on first use — most days never need the amber set
+            if (!countdown_urgent_atlas.buf)
+                UiDigitAtlas::build(countdown_urgent_atlas, FONT_MONO_60, COLOR_AMBER, COLOR_BG);
+            if (countdown_urgent_atlas.buf)
+                atlas = &countdown_urgent_atlas;
+        }
+        UiDigitAtlas::setText(countdown_row, *atlas, buf);
     }
 
     void setNextPrayerName(const char *name)
@@ -298,11 +320,11 @@ namespace UiPageHome
         {
             lv_obj_set_style_bg_opa(strip_col[old], LV_OPA_TRANSP, 0);
             lv_obj_set_style_bg_grad_dir(strip_col[old], LV_GRAD_DIR_NONE, 0);
-            lv_obj_set_style_text_color(strip_name[old], COLOR_DIM, 0);
+            UiTheme::setTextColor(strip_name[old], UiTheme::Role::DIM);
             lv_obj_set_style_text_opa(strip_name[old], 220, 0);
-            lv_obj_set_style_text_color(strip_time_lbl[old], COLOR_DIM, 0);
+            UiTheme::setTextColor(strip_time_lbl[old], UiTheme::Role::DIM);
             lv_obj_set_style_text_opa(strip_time_lbl[old], 220, 0);
-            lv_obj_set_style_bg_color(strip_dot[old], COLOR_DIM, 0);
+            UiTheme::setBgColor(strip_dot[old], UiTheme::Role::DIM);
             lv_obj_set_style_bg_opa(strip_dot[old], 130, 0);
             lv_obj_set_style_shadow_opa(strip_dot[old], 0, 0);
         }
@@ -317,11 +339,11 @@ namespace UiPageHome
                 lv_obj_set_style_opa(strip_col[i], 205, 0);
                 lv_obj_set_style_bg_opa(strip_col[i], LV_OPA_TRANSP, 0);
                 lv_obj_set_style_bg_grad_dir(strip_col[i], LV_GRAD_DIR_NONE, 0);
-                lv_obj_set_style_text_color(strip_name[i], COLOR_TEXT, 0);
+                UiTheme::setTextColor(strip_name[i], UiTheme::Role::TEXT);
                 lv_obj_set_style_text_opa(strip_name[i], 235, 0);
-                lv_obj_set_style_text_color(strip_time_lbl[i], COLOR_TEXT, 0);
+                UiTheme::setTextColor(strip_time_lbl[i], UiTheme::Role::TEXT);
                 lv_obj_set_style_text_opa(strip_time_lbl[i], 235, 0);
-                lv_obj_set_style_bg_color(strip_dot[i], COLOR_GREEN, 0);
+                UiTheme::setBgColor(strip_dot[i], UiTheme::Role::GREEN);
                 lv_obj_set_style_bg_opa(strip_dot[i], 220, 0);
                 lv_obj_set_style_shadow_opa(strip_dot[i], 0, 0);
             }
@@ -329,16 +351,16 @@ namespace UiPageHome
             {
                 lv_obj_set_style_opa(strip_col[i], LV_OPA_COVER, 0);
                 // Active tile: darker block like HTML reference (#252840)
-                lv_obj_set_style_bg_color(strip_col[i], COLOR_BG2, 0);
+                UiTheme::setBgColor(strip_col[i], UiTheme::Role::BG2);
                 lv_obj_set_style_bg_grad_dir(strip_col[i], LV_GRAD_DIR_NONE, 0);
                 lv_obj_set_style_bg_opa(strip_col[i], LV_OPA_COVER, 0);
-                lv_obj_set_style_text_color(strip_name[i], COLOR_GOLD_LIGHT, 0);
+                UiTheme::setTextColor(strip_name[i], UiTheme::Role::GOLD_LIGHT);
                 lv_obj_set_style_text_opa(strip_name[i], LV_OPA_COVER, 0);
-                lv_obj_set_style_text_color(strip_time_lbl[i], COLOR_GOLD, 0);
+                UiTheme::setTextColor(strip_time_lbl[i], UiTheme::Role::GOLD);
                 lv_obj_set_style_text_opa(strip_time_lbl[i], LV_OPA_COVER, 0);
-                lv_obj_set_style_bg_color(strip_dot[i], COLOR_GOLD, 0);
+                UiTheme::setBgColor(strip_dot[i], UiTheme::Role::GOLD);
                 lv_obj_set_style_bg_opa(strip_dot[i], LV_OPA_COVER, 0);
-                lv_obj_set_style_shadow_color(strip_dot[i], COLOR_GOLD, 0);
+                UiTheme::setShadowColor(strip_dot[i], UiTheme::Role::GOLD);
                 lv_obj_set_style_shadow_spread(strip_dot[i], 4, 0);
                 lv_obj_set_style_shadow_opa(strip_dot[i], 200, 0);
 
@@ -349,11 +371,11 @@ namespace UiPageHome
                 lv_obj_remove_style_all(strip_glow_bar);
                 lv_obj_set_size(strip_glow_bar, 80, 2);
                 lv_obj_align(strip_glow_bar, LV_ALIGN_BOTTOM_LEFT, 0, 0);
-                lv_obj_set_style_bg_color(strip_glow_bar, COLOR_GOLD_LIGHT, 0);
-                lv_obj_set_style_bg_grad_color(strip_glow_bar, COLOR_GOLD, 0);
+                UiTheme::setBgColor(strip_glow_bar, UiTheme::Role::GOLD_LIGHT);
+                UiTheme::setBgGradColor(strip_glow_bar, UiTheme::Role::GOLD);
                 lv_obj_set_style_bg_grad_dir(strip_glow_bar, LV_GRAD_DIR_HOR, 0);
                 lv_obj_set_style_bg_opa(strip_glow_bar, LV_OPA_COVER, 0);
-                lv_obj_set_style_shadow_color(strip_glow_bar, COLOR_GOLD, 0);
+                UiTheme::setShadowColor(strip_glow_bar, UiTheme::Role::GOLD);
                 lv_obj_set_style_shadow_spread(strip_glow_bar, 4, 0);
                 lv_obj_set_style_shadow_opa(strip_glow_bar, 180, 0);
                 lv_obj_set_style_radius(strip_glow_bar, 0, 0);
@@ -366,11 +388,11 @@ namespace UiPageHome
                 lv_obj_set_style_opa(strip_col[i], LV_OPA_COVER, 0);
                 lv_obj_set_style_bg_opa(strip_col[i], LV_OPA_TRANSP, 0);
                 lv_obj_set_style_bg_grad_dir(strip_col[i], LV_GRAD_DIR_NONE, 0);
-                lv_obj_set_style_text_color(strip_name[i], COLOR_TEXT, 0);
+                UiTheme::setTextColor(strip_name[i], UiTheme::Role::TEXT);
                 lv_obj_set_style_text_opa(strip_name[i], 230, 0);
-                lv_obj_set_style_text_color(strip_time_lbl[i], COLOR_TEXT, 0);
+                UiTheme::setTextColor(strip_time_lbl[i], UiTheme::Role::TEXT);
                 lv_obj_set_style_text_opa(strip_time_lbl[i], 230, 0);
-                lv_obj_set_style_bg_color(strip_dot[i], COLOR_DIM, 0);
+                UiTheme::setBgColor(strip_dot[i], UiTheme::Role::DIM);
                 lv_obj_set_style_bg_opa(strip_dot[i], 120, 0);
                 lv_obj_set_style_shadow_opa(strip_dot[i], 0, 0);
             }
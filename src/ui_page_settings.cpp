@@ -19,6 +19,7 @@
 #include "network.h"
 #include "wifi_portal.h"
 #include "lvgl_display.h"
+#include "power_manager.h"
 #include <WiFi.h>
 #include <lvgl.h>
 #include <extra/libs/qrcode/lv_qrcode.h>
@@ -119,6 +120,8 @@ namespace UiPageSettings
     // ═══════════════════════════════════════════════════════════════
     static void updateSliderVisual(lv_obj_t *fill, lv_obj_t *thumb, int pct)
     {
+        if (!fill) // page not built — value is kept and applied on create()
+            return;
         if (pct < 0)
             pct = 0;
         if (pct > 100)
@@ -161,7 +164,7 @@ namespace UiPageSettings
         const int16_t target_x = on ? (TOG_W - TOG_KNOB - TOG_INSET) : TOG_INSET;
 
         // Colors & opacity snap instantly (no semi-transparent mid-frames)
-        lv_obj_set_style_bg_color(tog, COLOR_GOLD, 0);
+        UiTheme::setBgColor(tog, UiTheme::Role::GOLD);
         lv_obj_set_style_bg_opa(tog, on ? LV_OPA_COVER : 26, 0);
 
 
@@ -206,7 +209,7 @@ namespace UiPageSettings
         lv_obj_t *lbl = lv_label_create(parent);
         lv_label_set_text(lbl, LocaleTR::toUpperTR(text));
         lv_obj_set_style_text_font(lbl, FONT_HEADING_12, 0);
-        lv_obj_set_style_text_color(lbl, COLOR_TEXT, 0);
+        UiTheme::setTextColor(lbl, UiTheme::Role::TEXT);
         lv_obj_set_style_text_opa(lbl, 245, 0);
         lv_obj_set_style_text_letter_space(lbl, 2, 0);
         lv_obj_set_style_pad_left(lbl, ROW_PAD_X, 0);
@@ -219,10 +222,10 @@ namespace UiPageSettings
         lv_obj_t *row = lv_obj_create(parent);
         lv_obj_remove_style_all(row);
         lv_obj_set_size(row, lv_pct(100), ROW_H);
-        lv_obj_set_style_bg_color(row, COLOR_BG2, 0);
+        UiTheme::setBgColor(row, UiTheme::Role::BG2);
         lv_obj_set_style_bg_opa(row, ROW_BG_OPA, 0);
         lv_obj_set_style_border_width(row, 1, 0);
-        lv_obj_set_style_border_color(row, COLOR_BORDER, 0);
+        UiTheme::setBorderColor(row, UiTheme::Role::BORDER);
         lv_obj_set_style_border_opa(row, ROW_BORDER_OPA, 0);
         lv_obj_set_style_radius(row, ROW_RADIUS, 0);
         lv_obj_set_style_pad_left(row, ROW_PAD_X, 0);
@@ -253,7 +256,7 @@ namespace UiPageSettings
         lv_obj_set_width(nm, lv_pct(100));
         lv_label_set_long_mode(nm, LV_LABEL_LONG_DOT);
         lv_obj_set_style_text_font(nm, FONT_BODY_12, 0);
-        lv_obj_set_style_text_color(nm, COLOR_DIM, 0);
+        UiTheme::setTextColor(nm, UiTheme::Role::DIM);
         lv_obj_set_style_text_opa(nm, LV_OPA_COVER, 0);
         lv_obj_set_style_text_letter_space(nm, 1, 0);
 
@@ -264,7 +267,7 @@ namespace UiPageSettings
             lv_obj_set_width(ds, lv_pct(100));
             lv_label_set_long_mode(ds, LV_LABEL_LONG_DOT);
             lv_obj_set_style_text_font(ds, FONT_HEADING_10, 0);
-            lv_obj_set_style_text_color(ds, COLOR_TEXT, 0);
+            UiTheme::setTextColor(ds, UiTheme::Role::TEXT);
             lv_obj_set_style_text_opa(ds, 210, 0);
         }
     }
@@ -283,10 +286,10 @@ namespace UiPageSettings
         lv_obj_t *card = lv_obj_create(parent);
         lv_obj_remove_style_all(card);
         lv_obj_set_size(card, SLIDER_CARD_W, lv_pct(100));
-        lv_obj_set_style_bg_color(card, COLOR_BG2, 0);
+        UiTheme::setBgColor(card, UiTheme::Role::BG2);
         lv_obj_set_style_bg_opa(card, 8, 0);
         lv_obj_set_style_border_width(card, 1, 0);
-        lv_obj_set_style_border_color(card, COLOR_BORDER, 0);
+        UiTheme::setBorderColor(card, UiTheme::Role::BORDER);
         lv_obj_set_style_border_opa(card, 56, 0);
         lv_obj_set_style_radius(card, 10, 0);
         lv_obj_set_style_pad_top(card, 12, 0);
@@ -301,14 +304,14 @@ namespace UiPageSettings
         lv_obj_t *lbl = lv_label_create(card);
         lv_label_set_text(lbl, LocaleTR::toUpperTR(title));
         lv_obj_set_style_text_font(lbl, FONT_HEADING_12, 0);
-        lv_obj_set_style_text_color(lbl, COLOR_TEXT, 0);
+        UiTheme::setTextColor(lbl, UiTheme::Role::TEXT);
         lv_obj_set_style_text_opa(lbl, 245, 0);
         lv_obj_set_style_text_letter_space(lbl, 2, 0);
 
         lv_obj_t *track = lv_obj_create(card);
         lv_obj_remove_style_all(track);
         lv_obj_set_size(track, SLIDER_TRACK_W, SLIDER_TRACK_H);
-        lv_obj_set_style_bg_color(track, COLOR_BORDER, 0);
+        UiTheme::setBgColor(track, UiTheme::Role::BORDER);
         lv_obj_set_style_bg_opa(track, LV_OPA_COVER, 0);
         lv_obj_set_style_radius(track, 12, 0);
         lv_obj_clear_flag(track, LV_OBJ_FLAG_SCROLLABLE);
@@ -324,7 +327,7 @@ namespace UiPageSettings
         lv_obj_remove_style_all(fill);
         lv_obj_set_size(fill, SLIDER_TRACK_W, 1);
         lv_obj_set_pos(fill, 0, SLIDER_TRACK_H - 1);
-        lv_obj_set_style_bg_color(fill, COLOR_GOLD, 0);
+        UiTheme::setBgColor(fill, UiTheme::Role::GOLD);
         lv_obj_set_style_bg_opa(fill, LV_OPA_COVER, 0);
         lv_obj_set_style_radius(fill, 12, 0);
         lv_obj_clear_flag(fill, LV_OBJ_FLAG_CLICKABLE);
@@ -340,11 +343,11 @@ namespace UiPageSettings
 
         if (tag == 1)
         {
-            UiIcons::drawSpeakerIcon(track_icon, false, COLOR_TEXT, true);
+            UiIcons::drawSpeakerIcon(track_icon, false, UiTheme::Role::TEXT, true);
         }
         else
         {
-            UiIcons::drawBrightnessIcon(track_icon, COLOR_TEXT);
+            UiIcons::drawBrightnessIcon(track_icon, UiTheme::Role::TEXT);
         }
 
         lv_obj_move_foreground(track_icon);
@@ -393,12 +396,12 @@ namespace UiPageSettings
         }
     }
 
-    static void setWiFiButtonLabel(const char *text, lv_color_t color)
+    static void setWiFiButtonLabel(const char *text, UiTheme::Role color)
     {
         if (wifi_btn_name)
         {
             lv_label_set_text(wifi_btn_name, LocaleTR::toUpperTR(text));
-            lv_obj_set_style_text_color(wifi_btn_name, color, 0);
+            UiTheme::setTextColor(wifi_btn_name, color);
         }
     }
 
@@ -441,9 +444,9 @@ namespace UiPageSettings
         lv_obj_set_size(wifi_btn, lv_pct(100), ROW_H);
 
         // Raised-button: gradient bg (lighter top → darker bottom = convex surface)
-        lv_obj_set_style_bg_color(wifi_btn, COLOR_BTN_HI, 0);
+        UiTheme::setBgColor(wifi_btn, UiTheme::Role::BTN_HI);
         lv_obj_set_style_bg_opa(wifi_btn, LV_OPA_COVER, 0);
-        lv_obj_set_style_bg_grad_color(wifi_btn, COLOR_BTN_LO, 0);
+        UiTheme::setBgGradColor(wifi_btn, UiTheme::Role::BTN_LO);
         lv_obj_set_style_bg_grad_dir(wifi_btn, LV_GRAD_DIR_VER, 0);
 
         lv_obj_set_style_border_width(wifi_btn, 0, 0);
@@ -456,8 +459,8 @@ namespace UiPageSettings
         lv_obj_set_style_shadow_ofs_y(wifi_btn, 4, 0);
 
         // Pressed: shadow shrinks + shifts down = "pushed in" feel
-        lv_obj_set_style_bg_color(wifi_btn, COLOR_BTN_LO, LV_STATE_PRESSED);
-        lv_obj_set_style_bg_grad_color(wifi_btn, COLOR_BTN_LO, LV_STATE_PRESSED);
+        UiTheme::setBgColor(wifi_btn, UiTheme::Role::BTN_LO, LV_STATE_PRESSED);
+        UiTheme::setBgGradColor(wifi_btn, UiTheme::Role::BTN_LO, LV_STATE_PRESSED);
         lv_obj_set_style_shadow_width(wifi_btn, 4, LV_STATE_PRESSED);
         lv_obj_set_style_shadow_opa(wifi_btn, 30, LV_STATE_PRESSED);
         lv_obj_set_style_shadow_ofs_y(wifi_btn, 1, LV_STATE_PRESSED);
@@ -478,14 +481,14 @@ namespace UiPageSettings
         lv_obj_t *icon = lv_label_create(wifi_btn);
         lv_label_set_text(icon, LV_SYMBOL_SETTINGS);
         lv_obj_set_style_text_font(icon, &lv_font_montserrat_14, 0);
-        lv_obj_set_style_text_color(icon, COLOR_GOLD, 0);
+        UiTheme::setTextColor(icon, UiTheme::Role::GOLD);
         lv_obj_set_style_text_opa(icon, 200, 0);
         lv_obj_clear_flag(icon, LV_OBJ_FLAG_CLICKABLE);
 
         wifi_btn_name = lv_label_create(wifi_btn);
         lv_label_set_text(wifi_btn_name, LocaleTR::toUpperTR(TXT_DEVICE_SETTINGS));
         lv_obj_set_style_text_font(wifi_btn_name, FONT_BODY_12, 0);
-        lv_obj_set_style_text_color(wifi_btn_name, COLOR_GOLD_LIGHT, 0);
+        UiTheme::setTextColor(wifi_btn_name, UiTheme::Role::GOLD_LIGHT);
         lv_obj_set_style_text_opa(wifi_btn_name, 245, 0);
         lv_obj_clear_flag(wifi_btn_name, LV_OBJ_FLAG_CLICKABLE);
     }
@@ -596,6 +599,7 @@ namespace UiPageSettings
             // ON means "Ekran Hep Açık" (Apple-style positive toggle semantics).
             SettingsManager::setPowerMode(newState ? PowerMode::ALWAYS_ON : PowerMode::SCREEN_OFF);
             g_state.sleepMode = !newState;
+            PowerManager::reportActivity(); // restart the dim timer under the new mode
             break;
         }
     }
@@ -610,7 +614,7 @@ namespace UiPageSettings
         }
 
         setWiFiButtonEnabled(false);
-        setWiFiButtonLabel(TXT_LOADING, COLOR_DIM);
+        setWiFiButtonLabel(TXT_LOADING, UiTheme::Role::DIM);
         lv_refr_now(NULL);
         if (advancedCallback)
             advancedCallback();
@@ -637,40 +641,40 @@ namespace UiPageSettings
 
             lv_obj_t *title = lv_label_create(portal_overlay);
             lv_label_set_text(title, LocaleTR::toUpperTR("WiFi'ye Bağlanın"));
-            lv_obj_set_style_text_color(title, COLOR_GOLD_LIGHT, 0);
+            UiTheme::setTextColor(title, UiTheme::Role::GOLD_LIGHT);
             lv_obj_set_style_text_font(title, FONT_BODY_12, 0);
             lv_obj_set_style_text_letter_space(title, 2, 0);
             lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 40);
 
             lv_obj_t *wifi_icon = lv_label_create(portal_overlay);
             lv_label_set_text(wifi_icon, LV_SYMBOL_WIFI);
-            lv_obj_set_style_text_color(wifi_icon, COLOR_GOLD, 0);
+            UiTheme::setTextColor(wifi_icon, UiTheme::Role::GOLD);
             lv_obj_set_style_text_font(wifi_icon, &lv_font_montserrat_20, 0);
             lv_obj_align(wifi_icon, LV_ALIGN_TOP_MID, 0, 75);
 
             lv_obj_t *ssid_title = lv_label_create(portal_overlay);
             lv_label_set_text(ssid_title, LocaleTR::toUpperTR("Ağ Adı"));
-            lv_obj_set_style_text_color(ssid_title, COLOR_DIM, 0);
+            UiTheme::setTextColor(ssid_title, UiTheme::Role::DIM);
             lv_obj_set_style_text_opa(ssid_title, 165, 0);
             lv_obj_set_style_text_font(ssid_title, FONT_HEADING_10, 0);
             lv_obj_align(ssid_title, LV_ALIGN_CENTER, 0, -30);
 
             lv_obj_t *ssid_lbl = lv_label_create(portal_overlay);
             lv_label_set_text(ssid_lbl, WiFiPortal::AP_SSID);
-            lv_obj_set_style_text_color(ssid_lbl, COLOR_TEXT, 0);
+            UiTheme::setTextColor(ssid_lbl, UiTheme::Role::TEXT);
             lv_obj_set_style_text_font(ssid_lbl, FONT_HIJRI_18, 0);
             lv_obj_align(ssid_lbl, LV_ALIGN_CENTER, 0, -6);
 
             lv_obj_t *pass_title = lv_label_create(portal_overlay);
             lv_label_set_text(pass_title, LocaleTR::toUpperTR("Şifre"));
-            lv_obj_set_style_text_color(pass_title, COLOR_DIM, 0);
+            UiTheme::setTextColor(pass_title, UiTheme::Role::DIM);
             lv_obj_set_style_text_opa(pass_title, 165, 0);
             lv_obj_set_style_text_font(pass_title, FONT_HEADING_10, 0);
             lv_obj_align(pass_title, LV_ALIGN_CENTER, 0, 26);
 
             lv_obj_t *pass_lbl = lv_label_create(portal_overlay);
             lv_label_set_text(pass_lbl, WiFiPortal::AP_PASSWORD);
-            lv_obj_set_style_text_color(pass_lbl, COLOR_GOLD, 0);
+            UiTheme::setTextColor(pass_lbl, UiTheme::Role::GOLD);
             lv_obj_set_style_text_font(pass_lbl, FONT_HIJRI_18, 0);
             lv_obj_align(pass_lbl, LV_ALIGN_CENTER, 0, 50);
 
@@ -724,7 +728,7 @@ namespace UiPageSettings
         // Title
         lv_obj_t *title = lv_label_create(portal_overlay);
         lv_label_set_text(title, LocaleTR::toUpperTR(TXT_DEVICE_SETTINGS));
-        lv_obj_set_style_text_color(title, COLOR_GOLD_LIGHT, 0);
+        UiTheme::setTextColor(title, UiTheme::Role::GOLD_LIGHT);
         lv_obj_set_style_text_font(title, FONT_BODY_12, 0);
         lv_obj_set_style_text_letter_space(title, 2, 0);
         lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 26);
@@ -765,20 +769,7 @@ namespace UiPageSettings
     lv_obj_t *create()
     {
         UiTheme::initStyles();
-
-        if (scr)
-        {
-            lv_obj_del(scr);
-            scr = nullptr;
-            bright_fill = bright_thumb = nullptr;
-            vol_fill = vol_thumb = nullptr;
-            tog_sleep = nullptr;
-            vol_track = vol_track_icon = nullptr;
-            wifi_btn_name = nullptr;
-            portal_overlay = nullptr;
-            qr_code_obj = nullptr;
-            lastQrData[0] = '\0';
-        }
+        destroy();
 
         scr = lv_obj_create(nullptr);
         lv_obj_remove_style_all(scr);
@@ -874,6 +865,28 @@ namespace UiPageSettings
     // PUBLIC API
     // ═══════════════════════════════════════════════════════════════
 
+    void destroy()
+    {
+        // Portal / QR page is a separate screen owned by this page
+        if (portal_overlay)
+        {
+            lv_obj_del(portal_overlay);
+            portal_overlay = nullptr;
+            qr_code_obj = nullptr;
+            lastQrData[0] = '\0';
+        }
+        if (!scr)
+            return;
+        lv_obj_del(scr);
+        scr = nullptr;
+        sb_handles = {};
+        bright_fill = bright_thumb = nullptr;
+        vol_fill = vol_thumb = nullptr;
+        tog_sleep = nullptr;
+        vol_track = vol_track_icon = nullptr;
+        wifi_btn = wifi_btn_name = nullptr;
+    }
+
     lv_obj_t *getScreen() { return scr; }
 
     lv_obj_t *getPortalScreen() { return portal_overlay; }
@@ -941,24 +954,24 @@ namespace UiPageSettings
         switch (state)
         {
         case WifiState::DISCONNECTED:
-            setWiFiButtonLabel(TXT_DEVICE_SETTINGS, COLOR_GOLD_LIGHT);
+            setWiFiButtonLabel(TXT_DEVICE_SETTINGS, UiTheme::Role::GOLD_LIGHT);
             break;
 
         case WifiState::CONNECTING:
-            setWiFiButtonLabel(TXT_LOADING, COLOR_DIM);
+            setWiFiButtonLabel(TXT_LOADING, UiTheme::Role::DIM);
             break;
 
         case WifiState::CONNECTED:
             showConnectedQRPage(ip);
-            setWiFiButtonLabel(TXT_DEVICE_SETTINGS, COLOR_GOLD_LIGHT);
+            setWiFiButtonLabel(TXT_DEVICE_SETTINGS, UiTheme::Role::GOLD_LIGHT);
             break;
 
         case WifiState::FAILED:
-            setWiFiButtonLabel(TXT_RETRY, COLOR_AMBER);
+            setWiFiButtonLabel(TXT_RETRY, UiTheme::Role::AMBER);
             break;
 
         case WifiState::PORTAL:
-            setWiFiButtonLabel(TXT_PORTAL_ON, COLOR_GOLD_LIGHT);
+            setWiFiButtonLabel(TXT_PORTAL_ON, UiTheme::Role::GOLD_LIGHT);
             break;
         }
     }
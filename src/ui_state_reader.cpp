@@ -13,6 +13,8 @@
 #include "ui_page_settings.h"
 #include "ui_page_status.h"
 #include "lvgl_display.h"
+#include "ui_theme.h"
+#include "config.h"
 #include <lvgl.h>
 #include <cstring>
 #include <cstdlib>
@@ -23,6 +25,35 @@ namespace UiStateReader
     static lv_timer_t *updateTimer = nullptr;
     static lv_obj_t *lastNormalScreen = nullptr;
 
+    // "HH:MM" → minutes since midnight, -1 if not set yet ("--:--")
+    static int parseHHMM(const char *s)
+    {
+        if (!s || strlen(s) < 5 || s[2] != ':')
+            return -1;
+        if (s[0] < '0' || s[0] > '9' || s[1] < '0' || s[1] > '9' ||
+            s[3] < '0' || s[3] > '9' || s[4] < '0' || s[4] > '9')
+            return -1;
+        return ((s[0] - '0') * 10 + (s[1] - '0')) * 60 + (s[3] - '0') * 10 + (s[4] - '0');
+    }
+
+    // Day palette between sunrise and Maghrib, night palette otherwise.
+    // setThemeMode() is a no-op unless the side actually changes, so this is
+    // cheap to run on every clock tick; the flip itself is one invalidation.
+    static void syncDayNightTheme()
+    {
+#if FORCE_DAY_THEME
+        UiTheme::setThemeMode(UiTheme::ThemeMode::KREM_ALTIN);
+#elif AUTO_DAY_NIGHT_THEME
+        const int sunrise = parseHHMM(g_state.sunrise.c_str());
+        const int maghrib = parseHHMM(g_state.maghrib.c_str());
+        if (sunrise < 0 || maghrib <= sunrise)
+            return;
+        const int now = g_state.hour * 60 + g_state.minute;
+        const bool day = now >= sunrise && now < maghrib;
+        UiTheme::setThemeMode(day ? UiTheme::ThemeMode::KREM_ALTIN : UiTheme::ThemeMode::ALTIN_GECE);
+#endif
+    }
+
     // Timer callback - runs every 50ms
     static void timerCallback(lv_timer_t *timer)
     {
@@ -54,6 +85,18 @@ namespace UiStateReader
             lv_timer_resume(updateTimer);
     }
 
+    void setPeriod(uint32_t periodMs)
+    {
+        if (updateTimer)
+            lv_timer_set_period(updateTimer, periodMs);
+    }
+
+    void kick()
+    {
+        if (updateTimer)
+            lv_timer_ready(updateTimer);
+    }
+
     void update()
     {
         // Early exit if nothing dirty
@@ -117,6 +160,10 @@ namespace UiStateReader
             return;
         }
 
+        // Palette first, so this frame's updates already render in it
+        if (g_state.isDirty(DirtyFlag::TIME | DirtyFlag::PRAYER_TIMES))
+            syncDayNightTheme();
+
         // ═══════════════════════════════════════════════════
         // CLOCK SCREEN UPDATES
         // ═══════════════════════════════════════════════════
@@ -139,9 +186,9 @@ namespace UiStateReader
         {
             UiPageClock::setHijriDate(g_state.hijriDate.c_str());
             // Auto-detect Ramadan mode from Hijri month
-            // month 9 = Ramadan, also enable on last day of Sha'ban (month 8, day 29/30) for first sahur
+            // month 9 = Ramadan, also enable on last day of Sha'ban (month 8) for first sahur
             bool isRamadan = (g_state.hijriMonth == 9);
-            bool isLastShaban = (g_state.hijriMonth == 8 && g_state.hijriDay >= 29);
+            bool isLastShaban = (g_state.hijriMonth == 8 && g_state.hijriDay >= g_state.hijriMonthLength);
             g_state.ramadanMode = isRamadan || isLastShaban;
             g_state.clearDirty(DirtyFlag::HIJRI);
         }
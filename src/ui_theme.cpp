@@ -25,6 +25,84 @@ namespace UiTheme
         return PALETTES[static_cast<uint8_t>(current_theme)];
     }
 
+    // ── Role styles: one single-property lv_style_t per (property, role) ──
+    // Single-property styles keep their value inline, so re-colouring them
+    // on a theme switch never allocates.
+    enum RoleProp : uint8_t
+    {
+        PROP_TEXT,
+        PROP_BG,
+        PROP_BG_GRAD,
+        PROP_BORDER,
+        PROP_SHADOW,
+        PROP_LINE,
+        PROP_ARC,
+        PROP_COUNT
+    };
+    static constexpr lv_style_prop_t ROLE_PROP_ID[PROP_COUNT] = {
+        LV_STYLE_TEXT_COLOR, LV_STYLE_BG_COLOR, LV_STYLE_BG_GRAD_COLOR, LV_STYLE_BORDER_COLOR,
+        LV_STYLE_SHADOW_COLOR, LV_STYLE_LINE_COLOR, LV_STYLE_ARC_COLOR};
+    static constexpr uint8_t NUM_ROLES = static_cast<uint8_t>(Role::COUNT);
+
+    static constexpr uint32_t ThemePalette::*ROLE_FIELD[NUM_ROLES] = {
+        &ThemePalette::bg, &ThemePalette::bg2, &ThemePalette::stripBg, &ThemePalette::accent,
+        &ThemePalette::accent2, &ThemePalette::text, &ThemePalette::dim, &ThemePalette::border,
+        &ThemePalette::green, &ThemePalette::amber, &ThemePalette::btnHi, &ThemePalette::btnLo};
+
+    static lv_style_t role_styles[PROP_COUNT][NUM_ROLES];
+
+    static constexpr uint8_t MAX_THEME_LISTENERS = 4;
+    static ThemeListener theme_listeners[MAX_THEME_LISTENERS] = {};
+
+    lv_color_t color(Role role)
+    {
+        return lv_color_hex(p().*ROLE_FIELD[static_cast<uint8_t>(role)]);
+    }
+
+    static void applyPaletteToRoleStyles()
+    {
+        for (uint8_t r = 0; r < NUM_ROLES; r++)
+        {
+            lv_style_value_t v;
+            v.color = color(static_cast<Role>(r));
+            for (uint8_t k = 0; k < PROP_COUNT; k++)
+                lv_style_set_prop(&role_styles[k][r], ROLE_PROP_ID[k], v);
+        }
+    }
+
+    static void setRoleColor(lv_obj_t *obj, RoleProp prop, Role role, lv_style_selector_t sel)
+    {
+        initStyles();
+        lv_style_t *target = &role_styles[prop][static_cast<uint8_t>(role)];
+        const lv_style_t *first = &role_styles[prop][0];
+        const lv_style_t *last = &role_styles[prop][NUM_ROLES - 1];
+
+        // Already bound to a role for this property/selector: swap the pointer
+        for (uint32_t i = 0; i < obj->style_cnt; i++)
+        {
+            _lv_obj_style_t &entry = obj->styles[i];
+            if (entry.is_local || entry.is_trans || entry.selector != sel)
+                continue;
+            if (entry.style < first || entry.style > last)
+                continue;
+            if (entry.style != target)
+            {
+                entry.style = target;
+                lv_obj_refresh_style(obj, lv_obj_style_get_selector_part(sel), ROLE_PROP_ID[prop]);
+            }
+            return;
+        }
+        lv_obj_add_style(obj, target, sel);
+    }
+
+    void setTextColor(lv_obj_t *obj, Role role, lv_style_selector_t sel) { setRoleColor(obj, PROP_TEXT, role, sel); }
+    void setBgColor(lv_obj_t *obj, Role role, lv_style_selector_t sel) { setRoleColor(obj, PROP_BG, role, sel); }
+    void setBgGradColor(lv_obj_t *obj, Role role, lv_style_selector_t sel) { setRoleColor(obj, PROP_BG_GRAD, role, sel); }
+    void setBorderColor(lv_obj_t *obj, Role role, lv_style_selector_t sel) { setRoleColor(obj, PROP_BORDER, role, sel); }
+    void setShadowColor(lv_obj_t *obj, Role role, lv_style_selector_t sel) { setRoleColor(obj, PROP_SHADOW, role, sel); }
+    void setLineColor(lv_obj_t *obj, Role role, lv_style_selector_t sel) { setRoleColor(obj, PROP_LINE, role, sel); }
+    void setArcColor(lv_obj_t *obj, Role role, lv_style_selector_t sel) { setRoleColor(obj, PROP_ARC, role, sel); }
+
     static void applyPaletteToStyles()
     {
         lv_style_set_bg_color(&style_screen, COLOR_BG);
@@ -75,7 +153,14 @@ namespace UiTheme
         lv_style_set_border_width(&style_transparent, 0);
         lv_style_set_pad_all(&style_transparent, 0);
 
+        for (auto &row : role_styles)
+        {
+            for (auto &style : row)
+                lv_style_init(&style);
+        }
+
         applyPaletteToStyles();
+        applyPaletteToRoleStyles();
         styles_initialized = true;
     }
 
@@ -91,6 +176,29 @@ namespace UiTheme
             return;
 
         applyPaletteToStyles();
+        applyPaletteToRoleStyles();
+        // One tree walk for all shared styles (NULL = every object)
+        lv_obj_report_style_change(nullptr);
+
+        for (ThemeListener listener : theme_listeners)
+        {
+            if (listener)
+                listener();
+        }
+    }
+
+    void addThemeListener(ThemeListener listener)
+    {
+        for (auto &slot : theme_listeners)
+        {
+            if (slot == listener)
+                return;
+            if (!slot)
+            {
+                slot = listener;
+                return;
+            }
+        }
     }
 
     ThemeMode getThemeMode()
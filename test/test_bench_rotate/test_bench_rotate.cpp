@@ -0,0 +1,190 @@
+/**
+ * test_bench_rotate.cpp — Native benchmark for the QSPI rotation kernels
+ *
+ * Compiles the header-only column-gather kernels from
+ * lib/GFX_Library_for_Arduino/src/databus/Arduino_ESP32QSPI_rotate.h on PC and
+ * runs them over a full 480×320 landscape frame, batch by batch, exactly the way
+ * Arduino_ESP32QSPI::writeRotatedBitmap() feeds its DMA ping-pong buffers.
+ *
+ * Verifies that the paired kernel produces byte-identical output to
+ * the original column walk (R1 and R3, full frame and odd-sized sub-windows),
+ * then prints ms/frame for each kernel so the speed-up is measurable off-device.
+ * The "cold" run evicts the host caches before every frame; a desktop L2 holds
+ * the whole 300 KB frame, which hides the stride penalty the PSRAM cache pays.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Arduino_ESP32QSPI_rotate.h"
+
+// ============================================================================
+// Frame geometry — matches lvgl_display.cpp and platformio.ini
+// ============================================================================
+
+static constexpr int16_t SCR_W = 480;
+static constexpr int16_t SCR_H = 320;
+static constexpr int32_t MAX_PIXELS_AT_ONCE = 4096; // -D ESP32QSPI_MAX_PIXELS_AT_ONCE
+static constexpr int BENCH_FRAMES = 200;
+
+using GatherFn = void (*)(uint16_t *, const uint16_t *, int32_t, int32_t, int16_t, int16_t);
+
+static std::vector<uint16_t> s_frame;
+
+static void fillFrame()
+{
+    s_frame.resize((size_t)SCR_W * SCR_H);
+    uint32_t seed = 0x12345678;
+    for (auto &px : s_frame)
+    {
+        seed = seed * 1664525u + 1013904223u; // LCG — deterministic, no <random> needed
+        px = (uint16_t)(seed >> 16);
+    }
+}
+
+// Rotate a w × h window (rotation 1 or 3) into `out`, batch by batch.
+// Output is the exact pixel stream the panel would receive.
+static void rotateWindow(GatherFn gather, const uint16_t *bitmap, int16_t w, int16_t h,
+                         int16_t stride, uint8_t r, uint16_t *out)
+{
+    int16_t linesPerBatch = (int16_t)(MAX_PIXELS_AT_ONCE / h);
+    if (linesPerBatch < 1)
+        linesPerBatch = 1;
+
+    for (int16_t line = 0; line < w; line += linesPerBatch)
+    {
+        int16_t batch = (w - line < linesPerBatch) ? (w - line) : linesPerBatch;
+        uint16_t *dst = out + (int32_t)line * h;
+        if (r == 3)
+            gather(dst, bitmap + (w - 1 - line), stride, -1, h, batch);
+        else
+            gather(dst, bitmap + (int32_t)(h - 1) * stride + line, -(int32_t)stride, 1, h, batch);
+    }
+}
+
+// Folded from every timed output and eviction pass and printed with the
+// results, so the optimizer cannot discard the work
+static uint32_t s_checksum = 0;
+
+// Stream through a buffer much larger than the host LLC so each timed frame
+// starts cold — closer to the ESP32-S3's 32 KB PSRAM cache than a warm L2.
+static void evictCaches()
+{
+    static std::vector<uint8_t> scratch(32u * 1024u * 1024u);
+    uint8_t acc = 0;
+    for (size_t i = 0; i < scratch.size(); i += 64)
+    {
+        scratch[i] += 1;
+        acc ^= scratch[i];
+    }
+    s_checksum += acc;
+}
+
+static double benchKernel(GatherFn gather, uint8_t r, bool cold)
+{
+    std::vector<uint16_t> out((size_t)SCR_W * SCR_H);
+    const int frames = cold ? BENCH_FRAMES / 10 : BENCH_FRAMES;
+    double totalMs = 0;
+    for (int i = 0; i < frames; i++)
+    {
+        if (cold)
+            evictCaches();
+        auto start = std::chrono::steady_clock::now();
+        rotateWindow(gather, s_frame.data(), SCR_W, SCR_H, SCR_W, r, out.data());
+        auto end = std::chrono::steady_clock::now();
+        totalMs += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    s_checksum = s_checksum * 31 + out[(size_t)(frames % SCR_W)];
+    return totalMs / frames;
+}
+
+static void assertSameOutput(GatherFn gather, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r)
+{
+    const uint16_t *src = s_frame.data() + (int32_t)y * SCR_W + x;
+    std::vector<uint16_t> expected((size_t)w * h);
+    std::vector<uint16_t> actual((size_t)w * h);
+    rotateWindow(qspi_rotate_gather_ref, src, w, h, SCR_W, r, expected.data());
+    rotateWindow(gather, src, w, h, SCR_W, r, actual.data());
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "R%d window x=%d y=%d %dx%d differs", r, x, y, w, h);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected.data(), actual.data(), expected.size() * sizeof(uint16_t), msg);
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_paired_matches_reference_full_frame()
+{
+    assertSameOutput(qspi_rotate_gather_paired, 0, 0, SCR_W, SCR_H, 1);
+    assertSameOutput(qspi_rotate_gather_paired, 0, 0, SCR_W, SCR_H, 3);
+}
+
+// Dirty areas from the partial flush: odd x / odd size hit the fallback paths
+void test_paired_matches_reference_sub_windows()
+{
+    struct Window
+    {
+        int16_t x, y, w, h;
+    };
+    static constexpr Window kWindows[] = {
+        {0, 0, 1, 1},
+        {10, 20, 64, 48},   // aligned, even
+        {11, 20, 64, 48},   // odd x
+        {10, 21, 63, 47},   // odd size
+        {401, 3, 79, 317},  // right edge
+        {137, 102, 205, 66} // countdown-sized
+    };
+    for (const auto &win : kWindows)
+    {
+        for (uint8_t r = 1; r <= 3; r += 2)
+        {
+            assertSameOutput(qspi_rotate_gather_paired, win.x, win.y, win.w, win.h, r);
+        }
+    }
+}
+
+void test_benchmark_480x320()
+{
+    for (int cold = 0; cold <= 1; cold++)
+    {
+        for (uint8_t r = 1; r <= 3; r += 2)
+        {
+            double refMs = benchKernel(qspi_rotate_gather_ref, r, cold);
+            double pairedMs = benchKernel(qspi_rotate_gather_paired, r, cold);
+
+            printf("\n>>> R%d 480x320, %s cache (tile=%d):\n", r, cold ? "cold" : "warm", ESP32QSPI_ROTATE_TILE);
+            printf(">>>   column walk : %7.3f ms/frame\n", refMs);
+            printf(">>>   paired 2x2  : %7.3f ms/frame  (%.2fx)\n", pairedMs, refMs / pairedMs);
+        }
+    }
+    printf(">>> checksum %08x\n", (unsigned)s_checksum);
+    TEST_PASS();
+}
+
+// ============================================================================
+// Entry point
+// ============================================================================
+
+int main(int argc, char **argv)
+{
+    fillFrame();
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_paired_matches_reference_full_frame);
+    RUN_TEST(test_paired_matches_reference_sub_windows);
+
+    // Timing (prints ms/frame, always passes)
+    RUN_TEST(test_benchmark_480x320);
+
+    return UNITY_END();
+}
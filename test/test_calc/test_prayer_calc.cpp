@@ -4,8 +4,9 @@
  * Compiles Adhan C library + prayer_calculator.cpp logic on PC (no Arduino).
  * Outputs prayer times for all 15 methods × 6 cities × 5 dates to cpp_output.csv.
  *
- * Self-contained: includes Adhan C sources directly, copies calculation logic
- * from prayer_calculator.cpp. Does NOT depend on Arduino headers.
+ * Self-contained: includes Adhan C sources directly and shares the method
+ * registry (method_registry.h) with prayer_calculator.cpp. Does NOT depend on
+ * Arduino headers.
  *
  * TIMEZONE APPROACH: We set TZ=UTC so that mktime()/localtime() inside the
  * Adhan C library produce correct UTC epochs. Then new_prayer_times_with_tz()
@@ -22,6 +23,11 @@
 #include <algorithm>
 #include <array>
 #include <iterator>
+#include <utility>
+#include <chrono>
+
+#include "solar_float.h"
+#include "prayer_ephemeris.h"
 
 // ============================================================================
 // Platform compatibility
@@ -84,184 +90,31 @@ extern "C"
 }
 
 // ============================================================================
-// Prayer calculation logic — copied from prayer_calculator.cpp
-// This is an exact copy so we test the SAME code that runs on the ESP32.
+// Prayer calculation logic — the method registry prayer_calculator.cpp uses,
+// so we test the SAME descriptors and post-processing steps as the ESP32.
 // ============================================================================
 
+#include "method_registry.h"
+
 namespace
 {
+    using MethodRegistry::clampLatitudeForDiyanet;
+    using MethodRegistry::findMethodSpec;
+    using MethodRegistry::kMethodSpecs;
+    using MethodRegistry::LibrarySolar;
+    using MethodRegistry::MethodSpec;
 
-    struct NetAdjustments
-    {
-        int fajr = 0;
-        int sunrise = 0;
-        int dhuhr = 0;
-        int asr = 0;
-        int maghrib = 0;
-        int isha = 0;
-    };
-
-    struct MethodSpec
-    {
-        int id;
-        const char *name;
-        calculation_method calcMethod;
-        bool overrideAngles;
-        double fajrAngle;
-        double ishaAngle;
-        int ishaInterval;
-        bool forceHanafi;
-        bool warnTehranMaghribAngle;
-        NetAdjustments dartNet;
-    };
-
-    // *** Exact copy of kMethodSpecs from prayer_calculator.cpp ***
-    static constexpr MethodSpec kMethodSpecs[] = {
-        {1, "Karachi", KARACHI, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {2, "ISNA", NORTH_AMERICA, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {3, "MWL", MUSLIM_WORLD_LEAGUE, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {4, "Umm al-Qura", UMM_AL_QURA, false, 0, 0, 0, false, false, NetAdjustments{}},
-        {5, "Egyptian", EGYPTIAN, true, 19.5, 17.5, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {6, "Gulf", GULF, false, 0, 0, 0, false, false, NetAdjustments{}},
-        {7, "Tehran", OTHER, false, 17.7, 14.0, 0, false, true, NetAdjustments{}},
-        {8, "Dubai", OTHER, false, 18.2, 18.2, 0, false, false, NetAdjustments{0, -3, 3, 3, 3, 0}},
-        {9, "Kuwait", KUWAIT, false, 0, 0, 0, false, false, NetAdjustments{}},
-        {10, "Qatar", QATAR, false, 0, 0, 0, false, false, NetAdjustments{}},
-        {11, "Singapore", OTHER, false, 20.0, 18.0, 0, false, false, NetAdjustments{0, 0, 1, 0, 0, 0}},
-        {12, "France UOIF", OTHER, false, 12.0, 12.0, 0, false, false, NetAdjustments{}},
-        {13, "Turkey Diyanet", OTHER, false, 18.0, 17.0, 0, false, false, NetAdjustments{0, -7, 5, 4, 7, 0}},
-        {14, "Russia", OTHER, false, 16.0, 15.0, 0, true, false, NetAdjustments{}},
-        {15, "Moonsighting", MOON_SIGHTING_COMMITTEE, false, 0, 0, 0, false, false, NetAdjustments{0, 0, 5, 0, 3, 0}},
-    };
-
-    static constexpr int NUM_METHODS = sizeof(kMethodSpecs) / sizeof(kMethodSpecs[0]);
+    static constexpr int NUM_METHODS = MethodRegistry::METHOD_COUNT;
 
-    static const MethodSpec *findMethodSpec(int method)
+    static const MethodRegistry::MethodPipeline<LibrarySolar> &pipelineOf(const MethodSpec &spec)
     {
-        auto it = std::find_if(std::begin(kMethodSpecs), std::end(kMethodSpecs),
-                               [method](const MethodSpec &spec)
-                               { return spec.id == method; });
-        return (it != std::end(kMethodSpecs)) ? &(*it) : nullptr;
+        return *MethodRegistry::pipelineFor<LibrarySolar>(spec.id);
     }
 
+    // Method parameters with the Dart net adjustments applied
     static calculation_parameters_t buildParameters(const MethodSpec &spec)
     {
-        calculation_parameters_t params;
-
-        if (spec.calcMethod != OTHER)
-        {
-            params = getParameters(spec.calcMethod);
-        }
-        else if (spec.ishaInterval > 0)
-        {
-            params = new_calculation_parameters4(spec.fajrAngle, spec.ishaInterval, OTHER);
-        }
-        else
-        {
-            params = new_calculation_parameters3(spec.fajrAngle, spec.ishaAngle, OTHER);
-        }
-
-        if (spec.overrideAngles)
-        {
-            params.fajrAngle = spec.fajrAngle;
-            params.ishaAngle = spec.ishaAngle;
-        }
-
-        if (spec.forceHanafi)
-        {
-            params.madhab = (madhab_t)HANAFI;
-        }
-
-        return params;
-    }
-
-    static int internalDhuhrOffsetMinutes(calculation_method calcMethod)
-    {
-        if (calcMethod == MOON_SIGHTING_COMMITTEE)
-            return 5;
-        if (calcMethod == UMM_AL_QURA || calcMethod == GULF || calcMethod == QATAR)
-            return 0;
-        return 1;
-    }
-
-    static int internalMaghribOffsetMinutes(calculation_method calcMethod)
-    {
-        return (calcMethod == MOON_SIGHTING_COMMITTEE) ? 3 : 0;
-    }
-
-    static void applyDartNetAdjustments(calculation_parameters_t &params, const MethodSpec &spec)
-    {
-        const auto &net = spec.dartNet;
-        params.adjustments.fajr = net.fajr;
-        params.adjustments.sunrise = net.sunrise;
-        params.adjustments.asr = net.asr;
-        params.adjustments.isha = net.isha;
-        params.adjustments.dhuhr = net.dhuhr - internalDhuhrOffsetMinutes(spec.calcMethod);
-        params.adjustments.maghrib = net.maghrib - internalMaghribOffsetMinutes(spec.calcMethod);
-    }
-
-    // Diyanet high-latitude rules — KARAR 2006 + 2009 revision
-    // Mirrors prayer_calculator.cpp exactly
-    static constexpr double DIYANET_HIGH_LAT_THRESHOLD = 45.0;
-    static constexpr double DIYANET_MAX_LAT_CLAMP = 62.0;
-    static constexpr int DIYANET_ISHA_CAP_MINUTES = 80;
-    static constexpr int DIYANET_FAJR_EXTRA_MINUTES = 10;
-
-    static void applyDiyanetHighLatitudeRules(prayer_times_t &times, double latitude, int month)
-    {
-        if (latitude < DIYANET_HIGH_LAT_THRESHOLD)
-            return;
-
-        const time_t maghrib = times.maghrib;
-        const time_t sunrise = times.sunrise;
-        const time_t fajr_astro = times.fajr;
-        const time_t isha_astro = times.isha;
-
-        // Şer'î gece = Maghrib → Fajr (astronomical)
-        int seriGeceSeconds = (int)difftime(fajr_astro, maghrib);
-        if (seriGeceSeconds <= 0)
-            seriGeceSeconds += 24 * 3600;
-
-        // KARAR: 1/3 of şer'î gece (uncapped, for comparison)
-        int nightThirdSeconds = seriGeceSeconds / 3;
-
-        // Astronomical Isha offset from Maghrib
-        int astroIshaOffset = (int)difftime(isha_astro, maghrib);
-        if (astroIshaOffset <= 0)
-            astroIshaOffset += 24 * 3600;
-
-        // Compare with UNCAPPED 1/3: winter astro wins, summer KARAR wins
-        if (astroIshaOffset <= nightThirdSeconds && astroIshaOffset > 0 && astroIshaOffset < 12 * 3600)
-        {
-            // Astronomical is earlier (winter) — keep
-        }
-        else
-        {
-            // KARAR applies — now cap at 80 dk
-            int ishaOffsetSeconds = nightThirdSeconds;
-            const int maxIshaOffset = DIYANET_ISHA_CAP_MINUTES * 60;
-            if (ishaOffsetSeconds > maxIshaOffset)
-            {
-                ishaOffsetSeconds = maxIshaOffset;
-            }
-
-            times.isha = maghrib + ishaOffsetSeconds;
-
-            if (month >= 3 && month <= 9)
-            {
-                int fajrOffsetSeconds = ishaOffsetSeconds + (DIYANET_FAJR_EXTRA_MINUTES * 60);
-                times.fajr = sunrise - fajrOffsetSeconds;
-            }
-        }
-    }
-
-    static double clampLatitudeForDiyanet(double latitude)
-    {
-        if (latitude >= DIYANET_MAX_LAT_CLAMP)
-            return DIYANET_MAX_LAT_CLAMP;
-        if (latitude <= -DIYANET_MAX_LAT_CLAMP)
-            return -DIYANET_MAX_LAT_CLAMP;
-        return latitude;
+        return pipelineOf(spec).parameters();
     }
 
 } // anonymous namespace
@@ -323,8 +176,6 @@ static const TestDate TEST_DATES[] = {
 };
 static constexpr int NUM_DATES = sizeof(TEST_DATES) / sizeof(TEST_DATES[0]);
 
-constexpr int PRAYER_METHOD_DIYANET = 13;
-
 // ============================================================================
 // Helper: format time_t (after TZ shift) as HH:MM using gmtime
 // ============================================================================
@@ -356,49 +207,297 @@ static prayer_times_t calculateForTest(const MethodSpec &spec,
                                        int year, int month, int day,
                                        int tzHours)
 {
+    const auto &pipeline = pipelineOf(spec);
     coordinates_t coords;
-    coords.latitude = lat;
+    coords.latitude = pipeline.coordinateLatitude(lat);
     coords.longitude = lon;
 
-    const bool isDiyanet = (spec.id == PRAYER_METHOD_DIYANET);
-    double originalLat = lat;
+    date_components_t date = {day, month, year};
+    time_t dateEpoch = resolve_time(&date);
+
+    auto params = pipeline.parameters();
+
+    prayer_times_t times = new_prayer_times_with_tz(&coords, dateEpoch, &params, tzHours);
 
-    if (isDiyanet)
+    // Diyanet KARAR rules, Tehran −4.5° Maghrib (must run AFTER adjustments)
+    pipeline.postProcess(times, {dateEpoch, tzHours * 3600L, lat, month}, LibrarySolar{dateEpoch, &coords});
+
+    return times;
+}
+
+// ============================================================================
+// Batch path — mirrors PrayerCalculator::calculateRange(): method parameters
+// and coordinates built once, dates stepped with civil-day arithmetic
+// ============================================================================
+
+static int32_t daysFromCivil(int y, int m, int d)
+{
+    y -= m <= 2;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const int yoe = y - era * 400;
+    const int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static date_components_t civilFromDays(int32_t z)
+{
+    z += 719468;
+    const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const int32_t doe = z - era * 146097;
+    const int32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int32_t mp = (5 * doy + 2) / 153;
+    const int d = doy - (153 * mp + 2) / 5 + 1;
+    const int m = mp < 10 ? mp + 3 : mp - 9;
+    return {d, m, (int)(yoe + era * 400 + (m <= 2))};
+}
+
+static int calculateRangeForTest(const MethodSpec &spec, double lat, double lon,
+                                 int year, int month, int day, int days,
+                                 int tzHours, prayer_times_t out[])
+{
+    const auto &pipeline = pipelineOf(spec);
+    coordinates_t baseCoords;
+    baseCoords.latitude = pipeline.coordinateLatitude(lat);
+    baseCoords.longitude = lon;
+
+    const calculation_parameters_t baseParams = pipeline.parameters();
+
+    int32_t dayNumber = daysFromCivil(year, month, day);
+    for (int i = 0; i < days; i++, dayNumber++)
     {
-        coords.latitude = clampLatitudeForDiyanet(lat);
+        date_components_t date = civilFromDays(dayNumber);
+        const time_t dateEpoch = resolve_time(&date);
+        coordinates_t coords = baseCoords;
+        calculation_parameters_t params = baseParams;
+
+        prayer_times_t times = new_prayer_times_with_tz(&coords, dateEpoch, &params, tzHours);
+        pipeline.postProcess(times, {dateEpoch, tzHours * 3600L, lat, date.month}, LibrarySolar{dateEpoch, &coords});
+
+        out[i] = times;
     }
+    return days;
+}
 
-    date_components_t date = {day, month, year};
-    time_t dateEpoch = resolve_time(&date);
+// ============================================================================
+// SolarFloat path — mirrors composeTimes() in prayer_calculator.cpp (float
+// engine, multi-location batch): library composition rules on SolarFloat hours
+// ============================================================================
 
-    auto params = buildParameters(spec);
-    applyDartNetAdjustments(params, spec);
+static bool isLeapYear(int year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
 
-    prayer_times_t times = new_prayer_times_with_tz(&coords, dateEpoch, &params, tzHours);
+static int daysSinceSolstice(int dayOfYear, int year, double latitude)
+{
+    const int daysInYear = isLeapYear(year) ? 366 : 365;
+    if (latitude >= 0)
+    {
+        int days = dayOfYear + 10;
+        return days >= daysInYear ? days - daysInYear : days;
+    }
+    int days = dayOfYear - (isLeapYear(year) ? 173 : 172);
+    return days < 0 ? days + daysInYear : days;
+}
+
+static double seasonalTwilightMinutes(double a, double b, double c, double d, int dyy)
+{
+    if (dyy < 91)
+        return a + (b - a) / 91.0 * dyy;
+    if (dyy < 137)
+        return b + (c - b) / 46.0 * (dyy - 91);
+    if (dyy < 183)
+        return c + (d - c) / 46.0 * (dyy - 137);
+    if (dyy < 229)
+        return d + (c - d) / 46.0 * (dyy - 183);
+    if (dyy < 275)
+        return c + (b - c) / 46.0 * (dyy - 229);
+    return b + (a - b) / 91.0 * (dyy - 275);
+}
+
+static time_t seasonAdjustedMorningTwilight(double latitude, int dayOfYear, int year, time_t sunrise)
+{
+    const double lat = std::fabs(latitude);
+    const double minutes = seasonalTwilightMinutes(75 + 28.65 / 55.0 * lat, 75 + 19.44 / 55.0 * lat,
+                                                   75 + 32.74 / 55.0 * lat, 75 + 48.10 / 55.0 * lat,
+                                                   daysSinceSolstice(dayOfYear, year, latitude));
+    return sunrise - std::lround(minutes * 60);
+}
+
+static time_t seasonAdjustedEveningTwilight(double latitude, int dayOfYear, int year, time_t sunset)
+{
+    const double lat = std::fabs(latitude);
+    const double minutes = seasonalTwilightMinutes(75 + 25.60 / 55.0 * lat, 75 + 2.050 / 55.0 * lat,
+                                                   75 - 9.210 / 55.0 * lat, 75 + 6.140 / 55.0 * lat,
+                                                   daysSinceSolstice(dayOfYear, year, latitude));
+    return sunset + std::lround(minutes * 60);
+}
+
+static bool solarEpoch(time_t dateEpoch, double hours, time_t &out)
+{
+    if (!std::isfinite(hours))
+        return false;
+    time_components_t tc = from_double(hours);
+    if (!is_valid_time(tc))
+        return false;
+    out = get_date_components(dateEpoch, &tc);
+    return true;
+}
+
+static time_t roundedMinute(time_t t)
+{
+    const long sec = (long)(t % 60);
+    return t - sec + (sec >= 30 ? 60 : 0);
+}
+
+// UTC hours from the date's 0h; NaN = event does not occur
+struct SolarHours
+{
+    double transit;
+    double sunrise;
+    double sunset;
+    double asr;
+    double fajr;
+    double isha; // unused with an Isha interval
+};
+
+// Library-equivalent times (before Diyanet/Tehran rules); false = the
+// device defers to the library for this day
+static bool composeFromHours(const MethodSpec &spec, const calculation_parameters_t &params, double lat,
+                             const SolarHours &solar, int year, int month, int day, time_t dateEpoch,
+                             int tzHours, prayer_times_t &times)
+{
+    const bool moonsighting = params.method == MOON_SIGHTING_COMMITTEE;
+
+    time_t dhuhr, sunrise, sunset, asr;
+    if (!solarEpoch(dateEpoch, solar.transit, dhuhr) || !solarEpoch(dateEpoch, solar.sunrise, sunrise) ||
+        !solarEpoch(dateEpoch, solar.sunset, sunset) || !solarEpoch(dateEpoch, solar.asr, asr))
+    {
+        return false;
+    }
+
+    const double night = (double)(sunrise + 24 * 3600 - sunset);
+    double fajrPortion = 0.5, ishaPortion = 0.5;
+    if (params.highLatitudeRule == SEVENTH_OF_THE_NIGHT)
+    {
+        fajrPortion = ishaPortion = 1.0 / 7.0;
+    }
+    else if (params.highLatitudeRule == TWILIGHT_ANGLE)
+    {
+        fajrPortion = params.fajrAngle / 60.0;
+        ishaPortion = params.ishaAngle / 60.0;
+    }
+    const int dayOfYear = daysFromCivil(year, month, day) - daysFromCivil(year, 1, 1) + 1;
+
+    time_t fajr;
+    bool fajrValid = solarEpoch(dateEpoch, solar.fajr, fajr);
+    if (moonsighting && lat >= 55)
+    {
+        fajr = sunrise - (time_t)(night / 7);
+        fajrValid = true;
+    }
+    const time_t safeFajr = moonsighting ? seasonAdjustedMorningTwilight(lat, dayOfYear, year, sunrise)
+                                         : sunrise - (time_t)(fajrPortion * night);
+    if (!fajrValid || fajr < safeFajr)
+        fajr = safeFajr;
 
-    // Tehran method: compute Maghrib as sun at -4.5° below horizon
-    // The Adhan C library has no maghribAngle field, so we manually compute
-    // using hourAngle() from the solar_time module.
-    if (spec.warnTehranMaghribAngle)
+    time_t isha;
+    if (params.ishaInterval > 0)
     {
-        solar_time_t solarTime = new_solar_time(dateEpoch, &coords);
-        time_components_t tc = from_double(hourAngle(&solarTime, -4.5, true));
-        if (is_valid_time(tc))
+        isha = sunset + params.ishaInterval * 60;
+    }
+    else
+    {
+        bool ishaValid = solarEpoch(dateEpoch, solar.isha, isha);
+        if (moonsighting && lat >= 55)
         {
-            time_t tehranMaghrib = get_date_components(dateEpoch, &tc);
-            tehranMaghrib += tzHours * 3600;            // Apply timezone
-            tehranMaghrib += spec.dartNet.maghrib * 60; // Net adjustment (0 for Tehran)
-            times.maghrib = tehranMaghrib;
+            isha = sunset + (time_t)(night / 7);
+            ishaValid = true;
         }
+        const time_t safeIsha = moonsighting ? seasonAdjustedEveningTwilight(lat, dayOfYear, year, sunset)
+                                             : sunset + (time_t)(ishaPortion * night);
+        if (!ishaValid || isha > safeIsha)
+            isha = safeIsha;
     }
 
-    // Diyanet high-latitude KARAR rules (must run AFTER adjustments)
-    if (isDiyanet)
+    const auto &net = spec.dartNet;
+    const long offset = tzHours * 3600L;
+    times.fajr = roundedMinute(fajr + net.fajr * 60) + offset;
+    times.sunrise = roundedMinute(sunrise + net.sunrise * 60) + offset;
+    times.dhuhr = roundedMinute(dhuhr + net.dhuhr * 60) + offset;
+    times.asr = roundedMinute(asr + net.asr * 60) + offset;
+    times.maghrib = roundedMinute(sunset + net.maghrib * 60) + offset;
+    times.isha = roundedMinute(isha + net.isha * 60) + offset;
+    return true;
+}
+
+static bool composeTimesFloat(const MethodSpec &spec, const calculation_parameters_t &params,
+                              double lat, double lon, int year, int month, int day,
+                              int tzHours, prayer_times_t &times)
+{
+    date_components_t date = {day, month, year};
+    const time_t dateEpoch = resolve_time(&date);
+    const SolarFloat::SolarTimeF solar(year, month, day, (float)lat, (float)lon);
+    const SolarHours hours = {solar.transit,
+                              solar.sunrise,
+                              solar.sunset,
+                              solar.afternoon(params.madhab == madhab_t::HANAFI ? 2.0f : 1.0f),
+                              solar.hourAngle((float)-params.fajrAngle, false),
+                              params.ishaInterval > 0 ? NAN : solar.hourAngle((float)-params.ishaAngle, true)};
+    return composeFromHours(spec, params, lat, hours, year, month, day, dateEpoch, tzHours, times);
+}
+
+// ============================================================================
+// Multi-location batch — mirrors PrayerCalculator::calculateLocations():
+// one SolarDay for the date, structure-of-arrays hour angles per tile
+// (Real = float with FLOAT_SOLAR_ENGINE, double otherwise)
+// ============================================================================
+
+template <typename Real>
+static void composeLocations(const MethodSpec &spec, const calculation_parameters_t &params,
+                             const float *latitude, const float *longitude, int count,
+                             int year, int month, int day, int tzHours, prayer_times_t out[], bool ok[])
+{
+    using namespace SolarFloat;
+    constexpr size_t TILE = kBatchTile;
+    const SolarDay<Real> solarDay(year, month, day);
+    date_components_t date = {day, month, year};
+    const time_t dateEpoch = resolve_time(&date);
+    const Real shadow = params.madhab == madhab_t::HANAFI ? Real(2) : Real(1);
+    const Uniform<Real> horizon{Real(-50.0 / 60.0)};
+
+    for (int base = 0; base < count; base += (int)TILE)
     {
-        applyDiyanetHighLatitudeRules(times, originalLat, month);
-    }
+        const size_t n = std::min<size_t>(TILE, count - base);
+        Real lat[TILE], lon[TILE];
+        for (size_t k = 0; k < n; k++)
+        {
+            lat[k] = (Real)latitude[base + k];
+            lon[k] = (Real)longitude[base + k];
+        }
+        Real approx[TILE], transit[TILE], sunrise[TILE], sunset[TILE], asrAngle[TILE], asr[TILE];
+        Real fajr[TILE], isha[TILE];
+
+        transits(solarDay, lon, approx, transit, n);
+        hourAngles(solarDay, lat, lon, approx, horizon, false, sunrise, n);
+        hourAngles(solarDay, lat, lon, approx, horizon, true, sunset, n);
+        afternoonAngles(solarDay, lat, shadow, asrAngle, n);
+        hourAngles(solarDay, lat, lon, approx, asrAngle, true, asr, n);
+        hourAngles(solarDay, lat, lon, approx, Uniform<Real>{Real(-params.fajrAngle)}, false, fajr, n);
+        if (params.ishaInterval > 0)
+            std::fill(isha, isha + n, Real(NAN));
+        else
+            hourAngles(solarDay, lat, lon, approx, Uniform<Real>{Real(-params.ishaAngle)}, true, isha, n);
 
-    return times;
+        for (size_t k = 0; k < n; k++)
+        {
+            const SolarHours hours = {transit[k], sunrise[k], sunset[k], asr[k], fajr[k], isha[k]};
+            ok[base + k] = composeFromHours(spec, params, lat[k], hours, year, month, day, dateEpoch, tzHours,
+                                            out[base + k]);
+        }
+    }
 }
 
 // ============================================================================
@@ -526,6 +625,463 @@ void test_diyanet_latitude_clamping()
     TEST_ASSERT_EQUAL_INT(-6200, (int)(clampLatitudeForDiyanet(-70.0) * 100));
 }
 
+// --- Civil-day stepping matches mktime() normalisation across a leap year ---
+void test_civil_day_stepping()
+{
+    const int32_t start = daysFromCivil(2028, 1, 1);
+    for (int i = 0; i < 366; i++)
+    {
+        date_components_t date = civilFromDays(start + i);
+
+        struct tm tm = {};
+        tm.tm_year = 2028 - 1900;
+        tm.tm_mday = 1 + i;
+        tm.tm_hour = 12;
+        mktime(&tm);
+
+        TEST_ASSERT_EQUAL_INT(tm.tm_year + 1900, date.year);
+        TEST_ASSERT_EQUAL_INT(tm.tm_mon + 1, date.month);
+        TEST_ASSERT_EQUAL_INT(tm.tm_mday, date.day);
+    }
+    TEST_ASSERT_EQUAL_INT(0, daysFromCivil(1970, 1, 1));
+}
+
+// --- Range API: a full year batch equals the one-day path, day by day ---
+void test_range_matches_single_day()
+{
+    static prayer_times_t year[366];
+    const int cities[] = {2, 5, 16}; // Istanbul, Brussels, Tromso (all rule branches)
+
+    for (int m = 0; m < NUM_METHODS; m++)
+    {
+        const auto &spec = kMethodSpecs[m];
+        for (int c : cities)
+        {
+            const auto &city = TEST_CITIES[c];
+            const int tz = city.tz_winter;
+            TEST_ASSERT_EQUAL_INT(366, calculateRangeForTest(spec, city.lat, city.lon, 2028, 1, 1, 366, tz, year));
+
+            for (int i = 0; i < 366; i++)
+            {
+                date_components_t date = civilFromDays(daysFromCivil(2028, 1, 1) + i);
+                prayer_times_t one = calculateForTest(spec, city.lat, city.lon,
+                                                      date.year, date.month, date.day, tz);
+                char msg[96];
+                snprintf(msg, sizeof(msg), "%s %s %04d-%02d-%02d",
+                         spec.name, city.name, date.year, date.month, date.day);
+                TEST_ASSERT_TRUE_MESSAGE(one.fajr == year[i].fajr && one.sunrise == year[i].sunrise &&
+                                             one.dhuhr == year[i].dhuhr && one.asr == year[i].asr &&
+                                             one.maghrib == year[i].maghrib && one.isha == year[i].isha,
+                                         msg);
+            }
+        }
+    }
+}
+
+// --- Range API: host cost per day (prints, always passes) ---
+void test_range_benchmark()
+{
+    static prayer_times_t year[366];
+    const auto &city = TEST_CITIES[5]; // Brussels
+    const auto *spec = findMethodSpec(PRAYER_METHOD_DIYANET);
+    TEST_ASSERT_NOT_NULL(spec);
+
+    constexpr int RUNS = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++)
+        calculateRangeForTest(*spec, city.lat, city.lon, 2026, 1, 1, 366, city.tz_winter, year);
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++)
+    {
+        for (int i = 0; i < 366; i++)
+        {
+            date_components_t date = civilFromDays(daysFromCivil(2026, 1, 1) + i);
+            year[i] = calculateForTest(*spec, city.lat, city.lon, date.year, date.month, date.day, city.tz_winter);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const double rangeUs = std::chrono::duration<double, std::micro>(mid - start).count() / (RUNS * 366);
+    const double singleUs = std::chrono::duration<double, std::micro>(end - mid).count() / (RUNS * 366);
+    printf("\n>>> calculateRange  : %7.2f us/day (%.2f ms/year)\n", rangeUs, rangeUs * 366 / 1000);
+    printf(">>> one day at a time: %7.2f us/day\n", singleUs);
+    TEST_PASS();
+}
+
+// --- Float solar engine: every event within ±30 s of the library's double ---
+// All 15 methods' angles, |lat| ≤ 62° every 2°, every day of 2026.
+// Not yet run against the real Adhan sources: its printed worst case is
+// what clears FLOAT_SOLAR_ENGINE for use (config.h).
+void test_float_solar_within_30s()
+{
+    const double lons[] = {-122.4, 4.7, 139.7};
+    double worst = 0;
+    char worstMsg[96] = "";
+    int validityMismatches = 0;
+    long events = 0;
+
+    for (int lat = -62; lat <= 62; lat += 2)
+    {
+        for (double lon : lons)
+        {
+            for (int i = 0; i < 365; i++)
+            {
+                date_components_t date = civilFromDays(daysFromCivil(2026, 1, 1) + i);
+                const time_t dateEpoch = resolve_time(&date);
+                coordinates_t coords;
+                coords.latitude = (double)lat;
+                coords.longitude = lon;
+                solar_time_t ref = new_solar_time(dateEpoch, &coords);
+                const SolarFloat::SolarTimeF fast(date.year, date.month, date.day, (float)lat, (float)lon);
+
+                auto check = [&](double expected, float actual, const char *what)
+                {
+                    if (std::isnan(expected) != std::isnan(actual))
+                    {
+                        validityMismatches++;
+                        return;
+                    }
+                    if (std::isnan(expected))
+                        return;
+                    events++;
+                    const double err = std::fabs(expected - actual) * 3600;
+                    if (err > worst)
+                    {
+                        worst = err;
+                        snprintf(worstMsg, sizeof(worstMsg), "%s lat %d lon %.1f %04d-%02d-%02d",
+                                 what, lat, lon, date.year, date.month, date.day);
+                    }
+                };
+
+                check(ref.transit, fast.transit, "transit");
+                check(ref.sunrise, fast.sunrise, "sunrise");
+                check(ref.sunset, fast.sunset, "sunset");
+                check(afternoon(&ref, 1.0), fast.afternoon(1.0f), "asr shafi");
+                check(afternoon(&ref, 2.0), fast.afternoon(2.0f), "asr hanafi");
+                check(hourAngle(&ref, -4.5, true), fast.hourAngle(-4.5f, true), "tehran maghrib");
+
+                for (int m = 0; m < NUM_METHODS; m++)
+                {
+                    const auto params = buildParameters(kMethodSpecs[m]);
+                    check(hourAngle(&ref, -params.fajrAngle, false),
+                          fast.hourAngle((float)-params.fajrAngle, false), kMethodSpecs[m].name);
+                    if (params.ishaInterval == 0)
+                    {
+                        check(hourAngle(&ref, -params.ishaAngle, true),
+                              fast.hourAngle((float)-params.ishaAngle, true), kMethodSpecs[m].name);
+                    }
+                }
+            }
+        }
+    }
+
+    printf("\n>>> float solar: %ld events, worst %.2f s (%s)\n", events, worst, worstMsg);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, validityMismatches, "float and double disagree on whether an event occurs");
+    TEST_ASSERT_TRUE_MESSAGE(worst <= 30.0, worstMsg);
+}
+
+// --- Float path: composed prayer times equal the library's to the minute ---
+// Minute rounding can flip when the two land either side of :30, so ±60 s.
+void test_float_times_match_library()
+{
+    long worst = 0;
+    char worstMsg[96] = "";
+    for (int m = 0; m < NUM_METHODS; m++)
+    {
+        const auto &spec = kMethodSpecs[m];
+        auto params = buildParameters(spec);
+
+        for (int lat = -62; lat <= 62; lat += 2)
+        {
+            const double lon = lat * 2.5; // spread across time zones
+            for (int i = 0; i < 365; i++)
+            {
+                date_components_t date = civilFromDays(daysFromCivil(2026, 1, 1) + i);
+                prayer_times_t fast;
+                if (!composeTimesFloat(spec, params, lat, lon, date.year, date.month, date.day, 0, fast))
+                    continue; // device falls back to the library
+
+                const time_t dateEpoch = resolve_time(&date);
+                coordinates_t coords;
+                coords.latitude = (double)lat;
+                coords.longitude = lon;
+                calculation_parameters_t libParams = params;
+                const prayer_times_t ref = new_prayer_times_with_tz(&coords, dateEpoch, &libParams, 0);
+
+                char msg[96];
+                snprintf(msg, sizeof(msg), "%s lat %d %04d-%02d-%02d", spec.name, lat, date.year, date.month,
+                         date.day);
+                for (const auto &[expected, actual] : {std::pair{ref.fajr, fast.fajr}, std::pair{ref.sunrise, fast.sunrise},
+                                                       std::pair{ref.dhuhr, fast.dhuhr}, std::pair{ref.asr, fast.asr},
+                                                       std::pair{ref.maghrib, fast.maghrib},
+                                                       std::pair{ref.isha, fast.isha}})
+                {
+                    const long err = std::labs((long)(actual - expected));
+                    if (err > worst)
+                    {
+                        worst = err;
+                        snprintf(worstMsg, sizeof(worstMsg), "%s", msg);
+                    }
+                }
+            }
+        }
+    }
+
+    printf("\n>>> float times vs library: worst %ld s (%s)\n", worst, worstMsg);
+    TEST_ASSERT_TRUE_MESSAGE(worst <= 60, worstMsg);
+}
+
+// --- Float path: host cost per day vs the library (prints, always passes) ---
+// Host CPUs have double in hardware; on the S3 the gap is far larger.
+void test_float_benchmark()
+{
+    const auto &city = TEST_CITIES[5]; // Brussels
+    const auto *spec = findMethodSpec(3); // MWL
+    TEST_ASSERT_NOT_NULL(spec);
+    auto params = buildParameters(*spec);
+
+    constexpr int RUNS = 20;
+    prayer_times_t sink = {};
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++)
+    {
+        for (int i = 0; i < 365; i++)
+        {
+            date_components_t date = civilFromDays(daysFromCivil(2026, 1, 1) + i);
+            const time_t dateEpoch = resolve_time(&date);
+            coordinates_t coords;
+            coords.latitude = city.lat;
+            coords.longitude = city.lon;
+            calculation_parameters_t libParams = params;
+            sink = new_prayer_times_with_tz(&coords, dateEpoch, &libParams, city.tz_winter);
+        }
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++)
+    {
+        for (int i = 0; i < 365; i++)
+        {
+            date_components_t date = civilFromDays(daysFromCivil(2026, 1, 1) + i);
+            composeTimesFloat(*spec, params, city.lat, city.lon, date.year, date.month, date.day,
+                              city.tz_winter, sink);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const double libUs = std::chrono::duration<double, std::micro>(mid - start).count() / (RUNS * 365);
+    const double floatUs = std::chrono::duration<double, std::micro>(end - mid).count() / (RUNS * 365);
+    printf("\n>>> library (double): %7.2f us/day\n", libUs);
+    printf(">>> float engine    : %7.2f us/day (last isha %ld)\n", floatUs, (long)sink.isha);
+    TEST_PASS();
+}
+
+// --- Batch: many locations from one SolarDay equal the single-location path ---
+// Coordinates on a 0.25° grid are exact in float, so both paths see the same inputs.
+static void spreadLocations(int count, float latitude[], float longitude[])
+{
+    for (int i = 0; i < count; i++)
+    {
+        latitude[i] = -60.0f + (float)((i * 37) % 481) * 0.25f; // -60 … 60
+        longitude[i] = -180.0f + (float)((i * 53) % 1440) * 0.25f;
+    }
+}
+
+void test_batch_matches_single()
+{
+    constexpr int COUNT = 64;
+    float latitude[COUNT], longitude[COUNT];
+    spreadLocations(COUNT, latitude, longitude);
+
+    int compared = 0;
+    for (int m = 0; m < NUM_METHODS; m++)
+    {
+        const auto &spec = kMethodSpecs[m];
+        const auto params = buildParameters(spec);
+        for (int month = 1; month <= 12; month++)
+        {
+            prayer_times_t batch[COUNT];
+            bool ok[COUNT];
+            composeLocations<float>(spec, params, latitude, longitude, COUNT, 2026, month, 15, 0, batch, ok);
+            for (int i = 0; i < COUNT; i++)
+            {
+                prayer_times_t single;
+                const bool singleOk =
+                    composeTimesFloat(spec, params, latitude[i], longitude[i], 2026, month, 15, 0, single);
+                char msg[96];
+                snprintf(msg, sizeof(msg), "%s %.2f,%.2f 2026-%02d-15", spec.name, latitude[i], longitude[i], month);
+                TEST_ASSERT_TRUE_MESSAGE(ok[i] == singleOk, msg);
+                if (!singleOk)
+                    continue;
+                TEST_ASSERT_TRUE_MESSAGE(batch[i].fajr == single.fajr && batch[i].sunrise == single.sunrise &&
+                                             batch[i].dhuhr == single.dhuhr && batch[i].asr == single.asr &&
+                                             batch[i].maghrib == single.maghrib && batch[i].isha == single.isha,
+                                         msg);
+                compared++;
+            }
+        }
+    }
+    printf("\n>>> batch == single for %d location-days\n", compared);
+}
+
+// --- Default (double) batch: shared SolarDay equals the library per location ---
+// What calculateLocations() runs without FLOAT_SOLAR_ENGINE. Same precision
+// as the library, so only a minute rounding at :30 may flip (±60 s).
+void test_batch_double_matches_library()
+{
+    constexpr int COUNT = 64;
+    float latitude[COUNT], longitude[COUNT];
+    spreadLocations(COUNT, latitude, longitude);
+
+    int compared = 0;
+    long exact = 0;
+    for (int m = 0; m < NUM_METHODS; m++)
+    {
+        const auto &spec = kMethodSpecs[m];
+        const auto params = buildParameters(spec);
+        for (int month = 1; month <= 12; month++)
+        {
+            prayer_times_t batch[COUNT];
+            bool ok[COUNT];
+            composeLocations<double>(spec, params, latitude, longitude, COUNT, 2026, month, 15, 0, batch, ok);
+
+            date_components_t date = {15, month, 2026};
+            const time_t dateEpoch = resolve_time(&date);
+            for (int i = 0; i < COUNT; i++)
+            {
+                if (!ok[i])
+                    continue; // device falls back to the library
+                coordinates_t coords;
+                coords.latitude = latitude[i];
+                coords.longitude = longitude[i];
+                calculation_parameters_t libParams = params;
+                const prayer_times_t ref = new_prayer_times_with_tz(&coords, dateEpoch, &libParams, 0);
+
+                char msg[96];
+                snprintf(msg, sizeof(msg), "%s %.2f,%.2f 2026-%02d-15", spec.name, latitude[i], longitude[i], month);
+                TEST_ASSERT_INT_WITHIN_MESSAGE(60, (int)ref.fajr, (int)batch[i].fajr, msg);
+                TEST_ASSERT_INT_WITHIN_MESSAGE(60, (int)ref.sunrise, (int)batch[i].sunrise, msg);
+                TEST_ASSERT_INT_WITHIN_MESSAGE(60, (int)ref.dhuhr, (int)batch[i].dhuhr, msg);
+                TEST_ASSERT_INT_WITHIN_MESSAGE(60, (int)ref.asr, (int)batch[i].asr, msg);
+                TEST_ASSERT_INT_WITHIN_MESSAGE(60, (int)ref.maghrib, (int)batch[i].maghrib, msg);
+                TEST_ASSERT_INT_WITHIN_MESSAGE(60, (int)ref.isha, (int)batch[i].isha, msg);
+                exact += ref.fajr == batch[i].fajr && ref.sunrise == batch[i].sunrise && ref.dhuhr == batch[i].dhuhr &&
+                         ref.asr == batch[i].asr && ref.maghrib == batch[i].maghrib && ref.isha == batch[i].isha;
+                compared++;
+            }
+        }
+    }
+    printf("\n>>> double batch vs library: %d location-days, %ld identical\n", compared, exact);
+}
+
+// --- Batch throughput for 1, 8 and 64 locations (same date and method) ---
+void test_batch_benchmark()
+{
+    constexpr int MAX_COUNT = 64;
+    float latitude[MAX_COUNT], longitude[MAX_COUNT];
+    spreadLocations(MAX_COUNT, latitude, longitude);
+    const auto *spec = findMethodSpec(3); // MWL
+    TEST_ASSERT_NOT_NULL(spec);
+    const auto params = buildParameters(*spec);
+
+    prayer_times_t out[MAX_COUNT];
+    bool ok[MAX_COUNT];
+    for (int count : {1, 8, 64})
+    {
+        const int runs = 20 * 365 / count + 1;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++)
+        {
+            date_components_t date = civilFromDays(daysFromCivil(2026, 1, 1) + r % 365);
+            for (int i = 0; i < count; i++)
+                ok[i] = composeTimesFloat(*spec, params, latitude[i], longitude[i], date.year, date.month, date.day,
+                                          0, out[i]);
+        }
+        auto mid = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++)
+        {
+            date_components_t date = civilFromDays(daysFromCivil(2026, 1, 1) + r % 365);
+            composeLocations<float>(*spec, params, latitude, longitude, count, date.year, date.month, date.day, 0,
+                                    out, ok);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        const double singleUs = std::chrono::duration<double, std::micro>(mid - start).count() / (runs * count);
+        const double batchUs = std::chrono::duration<double, std::micro>(end - mid).count() / (runs * count);
+        printf(">>> %2d locations: single %6.2f us/location, batch %6.2f us/location (%.0f locations/s, %.2fx)\n",
+               count, singleUs, batchUs, 1e6 / batchUs, singleUs / batchUs);
+    }
+    TEST_ASSERT_TRUE(ok[0]);
+}
+
+// --- Ephemeris: a Chebyshev-compressed decade within 1 min of the calculator ---
+// Source is calculateRangeForTest (Adhan library + method pipeline, the
+// same path as PrayerCalculator::calculateRange); every day of 2026-2035, UTC. Diyanet cities cover the KARAR band
+// (45-62°, Mar/Oct Fajr step) and the 62° clamp; the rest other methods'
+// own high-latitude rules. Prints the size per year.
+static void utcMinutes(const prayer_times_t &t, DailyPrayers &out)
+{
+    const time_t epochs[] = {t.fajr, t.sunrise, t.dhuhr, t.asr, t.maghrib, t.isha};
+    for (int p = 0; p < 6; p++)
+        out[PrayerType(p)] = PrayerTime::fromMinutes((int)(((epochs[p] % 86400) + 86400) % 86400 / 60));
+}
+
+void test_ephemeris_within_1min()
+{
+    constexpr int DAYS = 3652;
+    static prayer_times_t times[DAYS];
+    static DailyPrayers source[DAYS];
+    static uint8_t blob[16 * 1024];
+    static PrayerEphemeris::Encoder encoder;
+
+    struct Case
+    {
+        int method;
+        int city;
+    };
+    const Case cases[] = {
+        {13, 2}, {13, 5}, {13, 9}, {13, 13}, {13, 16}, // Diyanet: Istanbul, Brussels, Amsterdam, Oslo, Tromso
+        {3, 5},                                        // MWL Brussels
+        {2, 15},                                       // ISNA Helsinki
+        {15, 11},                                      // Moonsighting Copenhagen
+        {7, 3},                                        // Tehran Paris (-4.5° Maghrib)
+    };
+
+    for (const auto &c : cases)
+    {
+        const auto *spec = findMethodSpec(c.method);
+        const auto &city = TEST_CITIES[c.city];
+        TEST_ASSERT_EQUAL_INT(DAYS, calculateRangeForTest(*spec, city.lat, city.lon, 2026, 1, 1, DAYS, 0, times));
+
+        TEST_ASSERT_TRUE(encoder.begin(blob, sizeof(blob), {2026, 1, 1}, DAYS));
+        for (int i = 0; i < DAYS; i++)
+        {
+            utcMinutes(times[i], source[i]);
+            TEST_ASSERT_TRUE(encoder.addDay(source[i], 0));
+        }
+        const size_t bytes = encoder.finish();
+        TEST_ASSERT_TRUE(PrayerEphemeris::isValid(blob, bytes));
+
+        for (int i = 0; i < DAYS; i++)
+        {
+            const CivilDate::Date date = CivilDate::civilFromDays(CivilDate::daysFromCivil(2026, 1, 1) + i);
+            DailyPrayers decoded;
+            TEST_ASSERT_TRUE(PrayerEphemeris::evaluateDay(blob, date, 0, decoded));
+            for (int p = 0; p < 6; p++)
+            {
+                int diff = std::abs(decoded[PrayerType(p)].toMinutes() - source[i][PrayerType(p)].toMinutes());
+                diff = std::min(diff, 1440 - diff);
+                char msg[96];
+                snprintf(msg, sizeof(msg), "%s %s %04d-%02d-%02d prayer %d: %d min",
+                         spec->name, city.name, date.year, date.month, date.day, p, diff);
+                TEST_ASSERT_TRUE_MESSAGE(diff <= 1, msg);
+            }
+        }
+        printf(">>> ephemeris %-14s %-10s %5u bytes (%u per year)\n", spec->name, city.name,
+               (unsigned)bytes, (unsigned)(bytes * 365 / DAYS));
+    }
+}
+
+
 // --- Main: generate the full CSV file ---
 void test_generate_csv()
 {
@@ -596,6 +1152,16 @@ int main(int argc, char **argv)
     RUN_TEST(test_russia_hanafi_asr);
     RUN_TEST(test_90min_interval_isha);
     RUN_TEST(test_diyanet_latitude_clamping);
+    RUN_TEST(test_civil_day_stepping);
+    RUN_TEST(test_range_matches_single_day);
+    RUN_TEST(test_range_benchmark);
+    RUN_TEST(test_float_solar_within_30s);
+    RUN_TEST(test_float_times_match_library);
+    RUN_TEST(test_float_benchmark);
+    RUN_TEST(test_batch_matches_single);
+    RUN_TEST(test_batch_double_matches_library);
+    RUN_TEST(test_batch_benchmark);
+    RUN_TEST(test_ephemeris_within_1min);
 
     // Full matrix (writes cpp_output.csv)
     RUN_TEST(test_generate_csv);
@@ -7,6 +7,13 @@
  * - PrayerTypes: enum helpers and name lookups
  * - CalculationMethods: method ID and name lookups
  * - DiyanetParser: API response parsing utilities
+ * - CivilDate / PrayerTableFormat: binary yearly table layout
+ * - TimeZoneRules: POSIX TZ parsing and DST transitions
+ * - Qibla: bearing, distance and Turkish formatting (constexpr)
+ * - ReligiousCalendar: Hijri month table, notable days, adjustments
+ * - Scheduler::DeadlineQueue: main-loop deadline heap
+ * - PrayerTimeline: rolling absolute-time prayer events
+ * - LoopMetrics::Histogram: loop latency buckets and percentiles
  */
 
 #include <unity.h>
@@ -18,6 +25,15 @@
 #include "daily_prayers.h"
 #include "calculation_methods.h"
 #include "diyanet_parser.h"
+#include "civil_date.h"
+#include "prayer_table_format.h"
+#include "time_zone_rules.h"
+#include "qibla.h"
+#include "religious_calendar.h"
+#include "scheduler.h"
+#include "prayer_timeline.h"
+#include "loop_metrics.h"
+#include <cstring>
 
 // ============================================================================
 // Test Setup/Teardown
@@ -39,46 +55,55 @@ void test_PrayerTime_isEmpty_default(void)
 void test_PrayerTime_isEmpty_when_set(void)
 {
     PrayerTime pt;
-    pt.value = {'0', '5', ':', '3', '0', '\0'};
+    pt = PrayerTime::fromMinutes(5 * 60 + 30);
     TEST_ASSERT_FALSE(pt.isEmpty());
 }
 
 void test_PrayerTime_toMinutes_0530(void)
 {
     PrayerTime pt;
-    pt.value = {'0', '5', ':', '3', '0', '\0'};
+    pt = PrayerTime::fromMinutes(5 * 60 + 30);
     TEST_ASSERT_EQUAL_INT(330, pt.toMinutes()); // 5*60 + 30 = 330
 }
 
 void test_PrayerTime_toMinutes_1215(void)
 {
     PrayerTime pt;
-    pt.value = {'1', '2', ':', '1', '5', '\0'};
+    pt = PrayerTime::fromMinutes(12 * 60 + 15);
     TEST_ASSERT_EQUAL_INT(735, pt.toMinutes()); // 12*60 + 15 = 735
 }
 
 void test_PrayerTime_toMinutes_2359(void)
 {
     PrayerTime pt;
-    pt.value = {'2', '3', ':', '5', '9', '\0'};
+    pt = PrayerTime::fromMinutes(23 * 60 + 59);
     TEST_ASSERT_EQUAL_INT(1439, pt.toMinutes()); // 23*60 + 59 = 1439
 }
 
 void test_PrayerTime_toSeconds(void)
 {
     PrayerTime pt;
-    pt.value = {'0', '1', ':', '0', '0', '\0'};
+    pt = PrayerTime::fromMinutes(1 * 60 + 0);
     TEST_ASSERT_EQUAL_INT(3600, pt.toSeconds()); // 1 hour = 3600 seconds
 }
 
 void test_PrayerTime_equality(void)
 {
     PrayerTime pt;
-    pt.value = {'0', '5', ':', '3', '0', '\0'};
+    pt = PrayerTime::fromMinutes(5 * 60 + 30);
     TEST_ASSERT_TRUE(pt == "05:30");
     TEST_ASSERT_FALSE(pt == "05:31");
 }
 
+void test_PrayerTime_format(void)
+{
+    TEST_ASSERT_EQUAL_STRING("--:--", PrayerTime{}.format().data());
+    TEST_ASSERT_EQUAL_STRING("00:00", PrayerTime::fromMinutes(0).format().data());
+    TEST_ASSERT_EQUAL_STRING("23:59", PrayerTime::fromMinutes(1439).format().data());
+    TEST_ASSERT_TRUE(PrayerTime::fromMinutes(24 * 60).isEmpty());
+    TEST_ASSERT_TRUE(PrayerTime{} == "--:--");
+}
+
 // ============================================================================
 // DailyPrayers Tests
 // ============================================================================
@@ -86,12 +111,12 @@ void test_PrayerTime_equality(void)
 DailyPrayers createTestPrayers()
 {
     DailyPrayers dp;
-    dp[PrayerType::Fajr].value = {'0', '5', ':', '3', '0', '\0'};    // 05:30 = 330
-    dp[PrayerType::Sunrise].value = {'0', '7', ':', '0', '0', '\0'}; // 07:00 = 420
-    dp[PrayerType::Dhuhr].value = {'1', '2', ':', '1', '5', '\0'};   // 12:15 = 735
-    dp[PrayerType::Asr].value = {'1', '5', ':', '3', '0', '\0'};     // 15:30 = 930
-    dp[PrayerType::Maghrib].value = {'1', '8', ':', '0', '0', '\0'}; // 18:00 = 1080
-    dp[PrayerType::Isha].value = {'1', '9', ':', '3', '0', '\0'};    // 19:30 = 1170
+    dp[PrayerType::Fajr] = PrayerTime::fromMinutes(5 * 60 + 30);   // 05:30 = 330
+    dp[PrayerType::Sunrise] = PrayerTime::fromMinutes(7 * 60 + 0); // 07:00 = 420
+    dp[PrayerType::Dhuhr] = PrayerTime::fromMinutes(12 * 60 + 15); // 12:15 = 735
+    dp[PrayerType::Asr] = PrayerTime::fromMinutes(15 * 60 + 30);   // 15:30 = 930
+    dp[PrayerType::Maghrib] = PrayerTime::fromMinutes(18 * 60 + 0); // 18:00 = 1080
+    dp[PrayerType::Isha] = PrayerTime::fromMinutes(19 * 60 + 30);  // 19:30 = 1170
     return dp;
 }
 
@@ -220,21 +245,21 @@ void test_parseTime_valid(void)
 {
     PrayerTime pt;
     TEST_ASSERT_TRUE(DiyanetParser::parseTime("05:30", pt));
-    TEST_ASSERT_EQUAL_STRING("05:30", pt.value.data());
+    TEST_ASSERT_EQUAL_STRING("05:30", pt.format().data());
 }
 
 void test_parseTime_midnight(void)
 {
     PrayerTime pt;
     TEST_ASSERT_TRUE(DiyanetParser::parseTime("00:00", pt));
-    TEST_ASSERT_EQUAL_STRING("00:00", pt.value.data());
+    TEST_ASSERT_EQUAL_STRING("00:00", pt.format().data());
 }
 
 void test_parseTime_endOfDay(void)
 {
     PrayerTime pt;
     TEST_ASSERT_TRUE(DiyanetParser::parseTime("23:59", pt));
-    TEST_ASSERT_EQUAL_STRING("23:59", pt.value.data());
+    TEST_ASSERT_EQUAL_STRING("23:59", pt.format().data());
 }
 
 void test_parseTime_null(void)
@@ -345,6 +370,591 @@ void test_isCacheExpired_expired(void)
     TEST_ASSERT_TRUE(DiyanetParser::isCacheExpired(fetchedAt, now, 25));
 }
 
+// ============================================================================
+// CivilDate / PrayerTableFormat Tests
+// ============================================================================
+
+void test_civilDate_roundtrip(void)
+{
+    // 2027-12-31 → 2028-02-29 → 2028-03-01 across the leap day
+    const int32_t start = CivilDate::daysFromCivil(2027, 12, 31);
+    const CivilDate::Date leap = CivilDate::civilFromDays(start + 60);
+    TEST_ASSERT_EQUAL_INT(2028, leap.year);
+    TEST_ASSERT_EQUAL_INT(2, leap.month);
+    TEST_ASSERT_EQUAL_INT(29, leap.day);
+    const CivilDate::Date march = CivilDate::civilFromDays(start + 61);
+    TEST_ASSERT_EQUAL_INT(3, march.month);
+    TEST_ASSERT_EQUAL_INT(1, march.day);
+    TEST_ASSERT_EQUAL_INT(start + 61, CivilDate::daysFromCivil(march));
+}
+
+void test_table_crc32_knownVector(void)
+{
+    const char *check = "123456789";
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, PrayerTableFormat::crc32(check, 9));
+    // Chained in two parts gives the same result
+    const uint32_t first = PrayerTableFormat::crc32(check, 4);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, PrayerTableFormat::crc32(check + 4, 5, first));
+}
+
+void test_table_packUnpack_roundtrip(void)
+{
+    DailyPrayers in;
+    DiyanetParser::parseTime("05:30", in[PrayerType::Fajr]);
+    DiyanetParser::parseTime("07:02", in[PrayerType::Sunrise]);
+    DiyanetParser::parseTime("13:15", in[PrayerType::Dhuhr]);
+    DiyanetParser::parseTime("16:45", in[PrayerType::Asr]);
+    DiyanetParser::parseTime("19:20", in[PrayerType::Maghrib]);
+    // Isha left empty
+
+    uint16_t record[PrayerTableFormat::PRAYERS];
+    PrayerTableFormat::packDay(in, record);
+    TEST_ASSERT_EQUAL_UINT16(330, record[0]);
+    TEST_ASSERT_EQUAL_UINT16(PrayerTableFormat::NO_TIME, record[5]);
+
+    DailyPrayers out;
+    TEST_ASSERT_TRUE(PrayerTableFormat::unpackDay(record, out));
+    TEST_ASSERT_TRUE(out[PrayerType::Sunrise] == "07:02");
+    TEST_ASSERT_TRUE(out[PrayerType::Maghrib] == "19:20");
+    TEST_ASSERT_TRUE(out[PrayerType::Isha].isEmpty());
+
+    record[2] = 24 * 60; // out of range → corrupt
+    TEST_ASSERT_FALSE(PrayerTableFormat::unpackDay(record, out));
+}
+
+void test_table_dayIndex_range(void)
+{
+    const auto h = PrayerTableFormat::makeHeader(PrayerTableFormat::Source::Calculated, 3, 50.88, 4.70, 0,
+                                                 "CET-1CEST,M3.5.0,M10.5.0/3", {2027, 12, 1}, 366);
+    TEST_ASSERT_EQUAL_INT(0, PrayerTableFormat::dayIndex(h, {2027, 12, 1}));
+    TEST_ASSERT_EQUAL_INT(31 + 31 + 28, PrayerTableFormat::dayIndex(h, {2028, 2, 29}));
+    TEST_ASSERT_EQUAL_INT(365, PrayerTableFormat::dayIndex(h, {2028, 11, 30}));
+    TEST_ASSERT_EQUAL_INT(-1, PrayerTableFormat::dayIndex(h, {2028, 12, 1}));
+    TEST_ASSERT_EQUAL_INT(-1, PrayerTableFormat::dayIndex(h, {2027, 11, 30}));
+    TEST_ASSERT_EQUAL_UINT32(80 + 365 * 12, PrayerTableFormat::recordOffset(365));
+}
+
+void test_table_header_validation(void)
+{
+    auto h = PrayerTableFormat::makeHeader(PrayerTableFormat::Source::Diyanet, 13, 0, 0, 9541, "", {2026, 1, 1}, 30);
+    TEST_ASSERT_TRUE(PrayerTableFormat::isValidHeader(h));
+
+    auto bad = h;
+    bad.magic ^= 1;
+    TEST_ASSERT_FALSE(PrayerTableFormat::isValidHeader(bad));
+    bad = h;
+    bad.dayCount = PrayerTableFormat::MAX_DAYS + 1;
+    TEST_ASSERT_FALSE(PrayerTableFormat::isValidHeader(bad));
+    bad = h;
+    bad.startMonth = 13;
+    TEST_ASSERT_FALSE(PrayerTableFormat::isValidHeader(bad));
+}
+
+void test_table_sameKey(void)
+{
+    using PrayerTableFormat::makeHeader;
+    using PrayerTableFormat::sameKey;
+    using PrayerTableFormat::Source;
+    const char *tz = "CET-1CEST,M3.5.0,M10.5.0/3";
+    const auto a = makeHeader(Source::Calculated, 3, 50.8798, 4.7005, 0, tz, {2026, 1, 1}, 366);
+
+    // Start date and length are not part of the key
+    TEST_ASSERT_TRUE(sameKey(a, makeHeader(Source::Calculated, 3, 50.8798, 4.7005, 0, tz, {2026, 6, 1}, 0)));
+    TEST_ASSERT_FALSE(sameKey(a, makeHeader(Source::Calculated, 2, 50.8798, 4.7005, 0, tz, {2026, 1, 1}, 366)));
+    TEST_ASSERT_FALSE(sameKey(a, makeHeader(Source::Calculated, 3, 50.8799, 4.7005, 0, tz, {2026, 1, 1}, 366)));
+    TEST_ASSERT_FALSE(sameKey(a, makeHeader(Source::Calculated, 3, 50.8798, 4.7005, 0, "UTC0", {2026, 1, 1}, 366)));
+
+    // Diyanet tables are keyed by district only
+    const auto d = makeHeader(Source::Diyanet, 13, 0, 0, 9541, "", {2026, 1, 1}, 30);
+    TEST_ASSERT_TRUE(sameKey(d, makeHeader(Source::Diyanet, 13, 41.0, 29.0, 9541, tz, {2026, 2, 1}, 0)));
+    TEST_ASSERT_FALSE(sameKey(d, makeHeader(Source::Diyanet, 13, 0, 0, 9542, "", {2026, 1, 1}, 30)));
+    TEST_ASSERT_FALSE(sameKey(d, a));
+}
+
+// ============================================================================
+// TimeZoneRules Tests
+// ============================================================================
+
+static time_t utcAt(int y, int m, int d, int hh, int mm)
+{
+    return (time_t)CivilDate::daysFromCivil(y, m, d) * 86400 + hh * 3600 + mm * 60;
+}
+
+void test_tz_cet_transitions(void)
+{
+    TimeZoneRules::Zone zone;
+    TEST_ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+    zone.prepare(2026);
+    TEST_ASSERT_TRUE(zone.hasDst());
+
+    // Spring forward: 2026-03-29 02:00 CET = 01:00 UTC
+    TEST_ASSERT_EQUAL_INT(3600, zone.localOffsetAt(utcAt(2026, 3, 29, 1, 0) - 1));
+    TEST_ASSERT_EQUAL_INT(7200, zone.localOffsetAt(utcAt(2026, 3, 29, 1, 0)));
+    // Fall back: 2026-10-25 03:00 CEST = 01:00 UTC
+    TEST_ASSERT_EQUAL_INT(7200, zone.localOffsetAt(utcAt(2026, 10, 25, 1, 0) - 1));
+    TEST_ASSERT_EQUAL_INT(3600, zone.localOffsetAt(utcAt(2026, 10, 25, 1, 0)));
+}
+
+void test_tz_fromLocal_gap_and_repeat(void)
+{
+    TimeZoneRules::Zone zone;
+    zone.parse("CET-1CEST,M3.5.0,M10.5.0/3");
+    zone.prepare(2026);
+
+    // 02:30 does not exist on 2026-03-29: read as CET, i.e. 03:30 CEST
+    const time_t gap = zone.fromLocal(utcAt(2026, 3, 29, 2, 30));
+    TEST_ASSERT_TRUE(gap == utcAt(2026, 3, 29, 1, 30));
+    // 02:30 happens twice on 2026-10-25: the first (CEST) one wins
+    TEST_ASSERT_TRUE(zone.fromLocal(utcAt(2026, 10, 25, 2, 30)) == utcAt(2026, 10, 25, 0, 30));
+    // Ordinary round trip
+    const time_t t = utcAt(2026, 7, 1, 10, 15);
+    TEST_ASSERT_TRUE(zone.fromLocal(zone.toLocal(t)) == t);
+}
+
+void test_tz_southern_hemisphere(void)
+{
+    TimeZoneRules::Zone zone;
+    TEST_ASSERT_TRUE(zone.parse("AEST-10AEDT,M10.1.0,M4.1.0/3"));
+    zone.prepare(2026);
+
+    // DST spans the new year
+    TEST_ASSERT_EQUAL_INT(11 * 3600, zone.localOffsetAt(utcAt(2026, 1, 15, 0, 0)));
+    TEST_ASSERT_EQUAL_INT(10 * 3600, zone.localOffsetAt(utcAt(2026, 7, 15, 0, 0)));
+    // Ends 2026-04-05 03:00 AEDT = 04-04 16:00 UTC; starts 10-04 02:00 AEST = 10-03 16:00 UTC
+    TEST_ASSERT_EQUAL_INT(11 * 3600, zone.localOffsetAt(utcAt(2026, 4, 4, 16, 0) - 1));
+    TEST_ASSERT_EQUAL_INT(10 * 3600, zone.localOffsetAt(utcAt(2026, 4, 4, 16, 0)));
+    TEST_ASSERT_EQUAL_INT(10 * 3600, zone.localOffsetAt(utcAt(2026, 10, 3, 16, 0) - 1));
+    TEST_ASSERT_EQUAL_INT(11 * 3600, zone.localOffsetAt(utcAt(2026, 10, 3, 16, 0)));
+}
+
+void test_tz_fixed_offsets(void)
+{
+    TimeZoneRules::Zone zone;
+    TEST_ASSERT_TRUE(zone.parse("<+03>-3")); // Turkey
+    TEST_ASSERT_FALSE(zone.hasDst());
+    TEST_ASSERT_EQUAL_INT(10800, zone.localOffsetAt(utcAt(2026, 6, 1, 0, 0)));
+
+    TEST_ASSERT_TRUE(zone.parse("<+0530>-5:30"));
+    TEST_ASSERT_EQUAL_INT(19800, zone.localOffsetAt(utcAt(2026, 6, 1, 0, 0)));
+
+    // Unparseable strings fall back to UTC
+    TEST_ASSERT_FALSE(zone.parse("CET-1CEST,M3.5.0"));
+    TEST_ASSERT_EQUAL_INT(0, zone.localOffsetAt(utcAt(2026, 6, 1, 0, 0)));
+}
+
+void test_tz_outside_prepared_years(void)
+{
+    TimeZoneRules::Zone zone;
+    zone.parse("CET-1CEST,M3.5.0,M10.5.0/3");
+    zone.prepare(2026);
+
+    // Last Sunday of March 2040 is the 25th
+    TEST_ASSERT_EQUAL_INT(3600, zone.localOffsetAt(utcAt(2040, 3, 25, 1, 0) - 1));
+    TEST_ASSERT_EQUAL_INT(7200, zone.localOffsetAt(utcAt(2040, 3, 25, 1, 0)));
+}
+
+void test_tz_localMidnight_and_date(void)
+{
+    TimeZoneRules::Zone zone;
+    zone.parse("CET-1CEST,M3.5.0,M10.5.0/3");
+    zone.prepare(2026);
+
+    // Midnight before spring forward is still CET
+    const time_t midnight = zone.localMidnight({2026, 3, 29});
+    TEST_ASSERT_TRUE(midnight == utcAt(2026, 3, 28, 23, 0));
+    const CivilDate::Date date = zone.localDate(midnight);
+    TEST_ASSERT_EQUAL_INT(29, date.day);
+    // 23:30 UTC on 06-30 is already 07-01 in CEST
+    TEST_ASSERT_EQUAL_INT(7, zone.localDate(utcAt(2026, 6, 30, 23, 30)).month);
+}
+
+// ============================================================================
+// Qibla Tests
+// ============================================================================
+
+// Evaluated by the compiler: the whole module is constexpr
+constexpr Qibla::Result kIstanbul = Qibla::compute(41.0082, 28.9784);
+static_assert(Qibla::roundedDegrees(kIstanbul.bearing) == 152, "Istanbul bearing");
+static_assert(kIstanbul.distanceKm > 2404 && kIstanbul.distanceKm < 2406, "Istanbul distance");
+static_assert(Qibla::direction(kIstanbul.bearing)[0] == 'G', "Istanbul is south-east");
+static_assert(Qibla::formatDistance(2405.07)[5] == ' ', "thousands separator");
+
+static bool near(double a, double b, double tolerance)
+{
+    return Qibla::Math::abs(a - b) <= tolerance;
+}
+
+void test_qibla_reference_cities(void)
+{
+    // Reference values: spherical formulas in double precision (Python math)
+    struct Case
+    {
+        double latitude, longitude, bearing, distanceKm;
+    };
+    const Case cases[] = {
+        {41.0082, 28.9784, 151.6206, 2405.07},    // Istanbul
+        {50.8798, 4.7005, 123.9243, 4470.40},     // Brussels
+        {-6.2088, 106.8456, 295.1517, 7920.13},   // Jakarta
+        {40.7128, -74.0060, 58.4817, 10306.31},   // New York
+        {24.4672, 39.6111, 176.2352, 339.27},     // Madinah
+        {69.6492, 18.9553, 154.2805, 5541.80},    // Tromsø
+        {-33.8688, 151.2093, 277.4996, 13236.25}, // Sydney
+    };
+    for (const Case &c : cases)
+    {
+        const Qibla::Result r = Qibla::compute(c.latitude, c.longitude);
+        TEST_ASSERT_TRUE(near(r.bearing, c.bearing, 0.01));
+        TEST_ASSERT_TRUE(near(r.distanceKm, c.distanceKm, 1.0));
+    }
+
+    // At the Kaaba itself
+    TEST_ASSERT_TRUE(Qibla::compute(Qibla::KAABA_LATITUDE, Qibla::KAABA_LONGITUDE).distanceKm < 0.001);
+}
+
+void test_qibla_direction_names(void)
+{
+    TEST_ASSERT_EQUAL_STRING("Kuzey", Qibla::direction(0));
+    TEST_ASSERT_EQUAL_STRING("Kuzey", Qibla::direction(22.4));
+    TEST_ASSERT_EQUAL_STRING("Kuzeydoğu", Qibla::direction(22.5));
+    TEST_ASSERT_EQUAL_STRING("Güneydoğu", Qibla::direction(151.6));
+    TEST_ASSERT_EQUAL_STRING("Güney", Qibla::direction(176.2));
+    TEST_ASSERT_EQUAL_STRING("Batı", Qibla::direction(277.5));
+    TEST_ASSERT_EQUAL_STRING("Kuzeybatı", Qibla::direction(337.4));
+    TEST_ASSERT_EQUAL_STRING("Kuzey", Qibla::direction(359.9));
+
+    TEST_ASSERT_EQUAL_INT(0, Qibla::roundedDegrees(359.6));
+    TEST_ASSERT_EQUAL_INT(124, Qibla::roundedDegrees(123.9243));
+}
+
+void test_qibla_formatDistance(void)
+{
+    TEST_ASSERT_EQUAL_STRING("2.405 km", Qibla::formatDistance(2405.07).data());
+    TEST_ASSERT_EQUAL_STRING("13.236 km", Qibla::formatDistance(13236.25).data());
+    TEST_ASSERT_EQUAL_STRING("339 km", Qibla::formatDistance(339.27).data());
+    TEST_ASSERT_EQUAL_STRING("4,2 km", Qibla::formatDistance(4.2).data());
+    TEST_ASSERT_EQUAL_STRING("0,4 km", Qibla::formatDistance(0.44).data());
+    TEST_ASSERT_EQUAL_STRING("10 km", Qibla::formatDistance(9.97).data());
+}
+
+// ============================================================================
+// ReligiousCalendar Tests
+// ============================================================================
+
+static int32_t dayOf(int y, int m, int d)
+{
+    return CivilDate::daysFromCivil(y, m, d);
+}
+
+void test_calendar_matches_tabular(void)
+{
+    ReligiousCalendar::Table table;
+    for (int year = 2025; year <= 2030; year++)
+    {
+        TEST_ASSERT_TRUE(table.build(year));
+        for (int32_t day = dayOf(year, 1, 1); day <= dayOf(year, 12, 31); day++)
+        {
+            ReligiousCalendar::DayInfo info;
+            TEST_ASSERT_TRUE(table.describe(day, info));
+            const HijriDate h = ReligiousCalendar::tabularHijri(day);
+            TEST_ASSERT_EQUAL_INT(h.year, info.hijri.year);
+            TEST_ASSERT_EQUAL_INT(h.month, info.hijri.month);
+            TEST_ASSERT_EQUAL_INT(h.day, info.hijri.day);
+            TEST_ASSERT_EQUAL_INT(ReligiousCalendar::tabularMonthLength(day), info.monthLength);
+            // Every day of the year has an upcoming event inside the lookahead
+            TEST_ASSERT_TRUE(info.next != ReligiousCalendar::Event::NONE);
+        }
+    }
+    TEST_ASSERT_FALSE(table.covers(dayOf(2029, 1, 1)));
+
+    // Şaban is a 29-day month in the tabular calendar (1447: Jan 20 – Feb 17, 2026)
+    TEST_ASSERT_EQUAL_INT(8, ReligiousCalendar::tabularHijri(dayOf(2026, 2, 17)).month);
+    TEST_ASSERT_EQUAL_INT(29, ReligiousCalendar::tabularMonthLength(dayOf(2026, 2, 1)));
+}
+
+void test_calendar_events_2026(void)
+{
+    using ReligiousCalendar::Event;
+    ReligiousCalendar::Table table;
+    TEST_ASSERT_TRUE(table.build(2026));
+
+    // Tabular dates
+    TEST_ASSERT_TRUE(table.specialDay(dayOf(2026, 2, 18))->event == Event::RAMAZAN_START);
+    TEST_ASSERT_TRUE(table.specialDay(dayOf(2026, 5, 27))->event == Event::KURBAN_BAYRAMI);
+    TEST_ASSERT_TRUE(table.specialDay(dayOf(2026, 6, 17))->event == Event::HIJRI_NEW_YEAR);
+    TEST_ASSERT_NULL(table.specialDay(dayOf(2026, 4, 1)));
+
+    // Regaip is always a Thursday (the night before the first Friday of Recep)
+    for (int i = 0; i < table.entryCount(); i++)
+    {
+        if (table.entries()[i].event == Event::REGAIP_KANDILI)
+            TEST_ASSERT_EQUAL_INT(4, ReligiousCalendar::weekday(table.entries()[i].day));
+    }
+
+    // Second day of bayram; next event skips to Kurban Arefesi
+    ReligiousCalendar::DayInfo info;
+    TEST_ASSERT_TRUE(table.describe(dayOf(2026, 3, 21), info));
+    TEST_ASSERT_TRUE(info.special == Event::RAMAZAN_BAYRAMI);
+    TEST_ASSERT_EQUAL_INT(2, info.ordinal);
+    TEST_ASSERT_TRUE(info.next == Event::KURBAN_AREFE);
+    TEST_ASSERT_EQUAL_INT(66, info.daysToNext);
+    TEST_ASSERT_EQUAL_STRING("Kurban Arefesi", ReligiousCalendar::eventName(info.next));
+}
+
+void test_calendar_adjustments(void)
+{
+    using ReligiousCalendar::Event;
+    // Diyanet 2026: Ramazan began on Feb 19, one day after the tabular calendar
+    const ReligiousCalendar::Adjustment adjustments[] = {{1447, 9, +1}};
+    ReligiousCalendar::Table table;
+    TEST_ASSERT_TRUE(table.build(2026, adjustments, 1));
+
+    TEST_ASSERT_TRUE(table.specialDay(dayOf(2026, 2, 19))->event == Event::RAMAZAN_START);
+    TEST_ASSERT_TRUE(table.specialDay(dayOf(2026, 3, 16))->event == Event::KADIR_GECESI);
+    TEST_ASSERT_TRUE(table.specialDay(dayOf(2026, 3, 20))->event == Event::RAMAZAN_BAYRAMI);
+
+    ReligiousCalendar::DayInfo info;
+    TEST_ASSERT_TRUE(table.describe(dayOf(2026, 2, 18), info));
+    TEST_ASSERT_EQUAL_INT(8, info.hijri.month); // now the 30th of Şaban
+    TEST_ASSERT_EQUAL_INT(30, info.hijri.day);
+    TEST_ASSERT_EQUAL_INT(30, info.monthLength);
+    TEST_ASSERT_TRUE(table.describe(dayOf(2026, 3, 19), info));
+    TEST_ASSERT_EQUAL_INT(29, info.hijri.day); // Ramazan shrank to 29 days
+    TEST_ASSERT_EQUAL_INT(29, info.monthLength);
+    TEST_ASSERT_TRUE(info.special == Event::RAMAZAN_AREFE);
+}
+
+// ============================================================================
+// Scheduler::DeadlineQueue Tests
+// ============================================================================
+
+using Queue = Scheduler::DeadlineQueue<6>;
+
+void test_deadline_queue_order(void)
+{
+    Queue queue;
+    TEST_ASSERT_TRUE(queue.empty());
+    queue.schedule(3, 300);
+    queue.schedule(1, 100);
+    queue.schedule(5, 500);
+    queue.schedule(0, 200);
+    TEST_ASSERT_EQUAL_UINT8(4, queue.size());
+    TEST_ASSERT_EQUAL_UINT32(100, queue.earliest());
+
+    // Nothing is returned before its deadline
+    TEST_ASSERT_EQUAL_UINT8(Queue::NONE, queue.popDue(99));
+    TEST_ASSERT_EQUAL_UINT8(1, queue.popDue(350));
+    TEST_ASSERT_EQUAL_UINT8(0, queue.popDue(350));
+    TEST_ASSERT_EQUAL_UINT8(3, queue.popDue(350));
+    TEST_ASSERT_EQUAL_UINT8(Queue::NONE, queue.popDue(350));
+    TEST_ASSERT_EQUAL_UINT8(1, queue.size());
+    TEST_ASSERT_FALSE(queue.pending(1));
+    TEST_ASSERT_TRUE(queue.pending(5));
+}
+
+void test_deadline_queue_rearm_moves(void)
+{
+    Queue queue;
+    queue.schedule(0, 100);
+    queue.schedule(1, 200);
+    queue.schedule(2, 300);
+
+    // Re-arming keeps one slot per id, later or earlier
+    queue.schedule(0, 400);
+    TEST_ASSERT_EQUAL_UINT8(3, queue.size());
+    TEST_ASSERT_EQUAL_UINT32(200, queue.earliest());
+    queue.schedule(2, 50);
+    TEST_ASSERT_EQUAL_UINT8(3, queue.size());
+    TEST_ASSERT_EQUAL_UINT32(50, queue.earliest());
+    TEST_ASSERT_EQUAL_UINT32(400, queue.deadline(0));
+
+    TEST_ASSERT_EQUAL_UINT8(2, queue.popDue(1000));
+    TEST_ASSERT_EQUAL_UINT8(1, queue.popDue(1000));
+    TEST_ASSERT_EQUAL_UINT8(0, queue.popDue(1000));
+    TEST_ASSERT_TRUE(queue.empty());
+}
+
+void test_deadline_queue_cancel(void)
+{
+    Queue queue;
+    for (uint8_t id = 0; id < 6; id++)
+        queue.schedule(id, 600 - id * 100); // 5 earliest, 0 latest
+    queue.cancel(5);
+    queue.cancel(2);
+    queue.cancel(2); // not pending: no-op
+    queue.cancel(9); // out of range: no-op
+    TEST_ASSERT_EQUAL_UINT8(4, queue.size());
+    TEST_ASSERT_FALSE(queue.pending(2));
+
+    const uint8_t expected[] = {4, 3, 1, 0};
+    for (uint8_t id : expected)
+        TEST_ASSERT_EQUAL_UINT8(id, queue.popDue(1000));
+    TEST_ASSERT_EQUAL_UINT8(Queue::NONE, queue.popDue(1000));
+
+    // Out-of-range ids are ignored
+    queue.schedule(6, 0);
+    TEST_ASSERT_TRUE(queue.empty());
+}
+
+// ============================================================================
+// PrayerTimeline Tests
+// ============================================================================
+
+// Same times every day, shifted by `shift` minutes
+static DailyPrayers timelineDay(int shift = 0)
+{
+    const int minutes[] = {5 * 60 + 30, 7 * 60, 13 * 60, 16 * 60 + 30, 19 * 60 + 45, 21 * 60 + 15};
+    DailyPrayers day;
+    for (int i = 0; i < 6; i++)
+        day[static_cast<PrayerType>(i)] = PrayerTime::fromMinutes(minutes[i] + shift);
+    return day;
+}
+
+void test_timeline_next_and_slot(void)
+{
+    TimeZoneRules::Zone zone;
+    zone.parse("<+03>-3");
+    const DailyPrayers days[] = {timelineDay(-1), timelineDay(), timelineDay(1)};
+    PrayerTimeline::Timeline timeline;
+    timeline.reset(zone, dayOf(2026, 3, 10), days);
+
+    // 03:00 local: next is today's Fajr, slot started at yesterday's Isha
+    PrayerTimeline::Event event;
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 10, 0, 0), event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Fajr);
+    TEST_ASSERT_EQUAL_INT(1, event.day);
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 10, 2, 30));
+    TEST_ASSERT_TRUE(timeline.previous(event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Isha);
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 9, 18, 14));
+
+    // Exactly at Dhuhr: the next one is Asr
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 10, 10, 0), event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Asr);
+
+    // After Isha: tomorrow's Fajr
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 10, 20, 0), event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Fajr);
+    TEST_ASSERT_EQUAL_INT(2, event.day);
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 11, 2, 31));
+
+    // Clock set back: the cursor follows
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 10, 9, 0), event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Dhuhr);
+
+    // Past tomorrow's Isha there is nothing left
+    TEST_ASSERT_FALSE(timeline.next(utcAt(2026, 3, 11, 19, 0), event));
+}
+
+void test_timeline_rollover(void)
+{
+    TimeZoneRules::Zone zone;
+    zone.parse("<+03>-3");
+    const DailyPrayers days[] = {timelineDay(0), timelineDay(1), timelineDay(2)};
+    PrayerTimeline::Timeline timeline;
+    timeline.reset(zone, dayOf(2026, 3, 10), days);
+
+    PrayerTimeline::Event event;
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 10, 20, 0), event)); // after Isha
+    timeline.push(zone, timelineDay(3));
+    TEST_ASSERT_EQUAL_INT(dayOf(2026, 3, 11), timeline.today());
+    TEST_ASSERT_EQUAL_INT(dayOf(2026, 3, 12), timeline.dayNumber(2));
+    TEST_ASSERT_EQUAL_INT(13 * 60 + 3, timeline.prayers(2)[PrayerType::Dhuhr].toMinutes());
+
+    // Same Fajr, now "today"; slot start is the old today's Isha
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 10, 21, 1), event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Fajr);
+    TEST_ASSERT_EQUAL_INT(1, event.day);
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 11, 2, 32));
+    TEST_ASSERT_TRUE(timeline.previous(event));
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 10, 18, 16));
+
+    // The appended day is reachable
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 11, 19, 0), event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Fajr);
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 12, 2, 33));
+}
+
+void test_timeline_dst_and_empty_times(void)
+{
+    TimeZoneRules::Zone zone;
+    zone.parse("CET-1CEST,M3.5.0,M10.5.0/3");
+    DailyPrayers days[] = {timelineDay(), timelineDay(), timelineDay()};
+    days[1][PrayerType::Isha] = PrayerTime{}; // e.g. no Isha in a high-latitude summer
+    PrayerTimeline::Timeline timeline;
+    timeline.reset(zone, dayOf(2026, 3, 29), days); // DST starts today at 01:00 UTC
+
+    // Yesterday in CET, today in CEST
+    PrayerTimeline::Event event;
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 28, 12, 0), event));
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 28, 15, 30));
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 29, 12, 0), event));
+    TEST_ASSERT_TRUE(event.at == utcAt(2026, 3, 29, 14, 30));
+
+    // Missing Isha is skipped: Maghrib → tomorrow's Fajr
+    TEST_ASSERT_TRUE(timeline.next(utcAt(2026, 3, 29, 18, 0), event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Fajr);
+    TEST_ASSERT_EQUAL_INT(2, event.day);
+    TEST_ASSERT_TRUE(timeline.previous(event));
+    TEST_ASSERT_TRUE(event.prayer == PrayerType::Maghrib);
+}
+
+// ============================================================================
+// LoopMetrics::Histogram Tests
+// ============================================================================
+
+using Histogram = LoopMetrics::Histogram;
+
+void test_histogram_buckets(void)
+{
+    // Exact below 4 us, then four per doubling, contiguous
+    TEST_ASSERT_EQUAL_UINT8(0, Histogram::bucketOf(0));
+    TEST_ASSERT_EQUAL_UINT8(3, Histogram::bucketOf(3));
+    TEST_ASSERT_EQUAL_UINT8(4, Histogram::bucketOf(4));
+    TEST_ASSERT_EQUAL_UINT8(7, Histogram::bucketOf(7));
+    TEST_ASSERT_EQUAL_UINT8(8, Histogram::bucketOf(8));
+    TEST_ASSERT_EQUAL_UINT8(8, Histogram::bucketOf(9));
+    TEST_ASSERT_EQUAL_UINT8(9, Histogram::bucketOf(10));
+    for (uint8_t bucket = 1; bucket < Histogram::BUCKETS; bucket++)
+    {
+        const uint32_t lower = Histogram::lowerBound(bucket);
+        TEST_ASSERT_EQUAL_UINT8(bucket, Histogram::bucketOf(lower));
+        TEST_ASSERT_EQUAL_UINT8(bucket - 1, Histogram::bucketOf(lower - 1));
+    }
+
+    // Anything past the last bucket lands in it
+    TEST_ASSERT_EQUAL_UINT8(Histogram::BUCKETS - 1, Histogram::bucketOf(0xFFFFFFFFu));
+}
+
+void test_histogram_percentiles(void)
+{
+    Histogram h;
+    TEST_ASSERT_EQUAL_UINT32(0, h.percentile(50));
+
+    // 98 fast passes, one slow flush, one blocking fetch
+    for (int i = 0; i < 98; i++)
+        h.add(100 + i % 3);
+    h.add(12000);
+    h.add(2500000);
+    TEST_ASSERT_EQUAL_UINT32(100, h.count());
+    TEST_ASSERT_EQUAL_UINT32(100, h.min());
+    TEST_ASSERT_EQUAL_UINT32(2500000, h.max());
+    TEST_ASSERT_EQUAL_UINT32((98 * 100 + 98 + 12000 + 2500000) / 100, h.mean());
+
+    // Upper bucket edge: never below the true value, at most 25 % above
+    const uint32_t p50 = h.percentile(50);
+    TEST_ASSERT_TRUE(p50 >= 102 && p50 <= 127);
+    const uint32_t p99 = h.percentile(99);
+    TEST_ASSERT_TRUE(p99 >= 12000 && p99 <= 15000);
+    TEST_ASSERT_EQUAL_UINT32(2500000, h.percentile(100));
+    TEST_ASSERT_EQUAL_UINT32(100, h.percentile(0));
+
+    h.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, h.count());
+    h.add(5);
+    TEST_ASSERT_EQUAL_UINT32(5, h.min());
+    TEST_ASSERT_EQUAL_UINT32(5, h.percentile(99));
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -353,7 +963,7 @@ int main(int argc, char **argv)
 {
     UNITY_BEGIN();
 
-    // PrayerTime tests (7)
+    // PrayerTime tests (8)
     RUN_TEST(test_PrayerTime_isEmpty_default);
     RUN_TEST(test_PrayerTime_isEmpty_when_set);
     RUN_TEST(test_PrayerTime_toMinutes_0530);
@@ -361,6 +971,7 @@ int main(int argc, char **argv)
     RUN_TEST(test_PrayerTime_toMinutes_2359);
     RUN_TEST(test_PrayerTime_toSeconds);
     RUN_TEST(test_PrayerTime_equality);
+    RUN_TEST(test_PrayerTime_format);
 
     // DailyPrayers tests (6)
     RUN_TEST(test_DailyPrayers_findNext_before_fajr);
@@ -405,5 +1016,45 @@ int main(int argc, char **argv)
     RUN_TEST(test_isCacheExpired_fresh);
     RUN_TEST(test_isCacheExpired_expired);
 
+    // CivilDate / PrayerTableFormat tests (6)
+    RUN_TEST(test_civilDate_roundtrip);
+    RUN_TEST(test_table_crc32_knownVector);
+    RUN_TEST(test_table_packUnpack_roundtrip);
+    RUN_TEST(test_table_dayIndex_range);
+    RUN_TEST(test_table_header_validation);
+    RUN_TEST(test_table_sameKey);
+
+    // TimeZoneRules tests (6)
+    RUN_TEST(test_tz_cet_transitions);
+    RUN_TEST(test_tz_fromLocal_gap_and_repeat);
+    RUN_TEST(test_tz_southern_hemisphere);
+    RUN_TEST(test_tz_fixed_offsets);
+    RUN_TEST(test_tz_outside_prepared_years);
+    RUN_TEST(test_tz_localMidnight_and_date);
+
+    // Qibla tests (3)
+    RUN_TEST(test_qibla_reference_cities);
+    RUN_TEST(test_qibla_direction_names);
+    RUN_TEST(test_qibla_formatDistance);
+
+    // ReligiousCalendar tests (3)
+    RUN_TEST(test_calendar_matches_tabular);
+    RUN_TEST(test_calendar_events_2026);
+    RUN_TEST(test_calendar_adjustments);
+
+    // Scheduler::DeadlineQueue tests (3)
+    RUN_TEST(test_deadline_queue_order);
+    RUN_TEST(test_deadline_queue_rearm_moves);
+    RUN_TEST(test_deadline_queue_cancel);
+
+    // PrayerTimeline tests (3)
+    RUN_TEST(test_timeline_next_and_slot);
+    RUN_TEST(test_timeline_rollover);
+    RUN_TEST(test_timeline_dst_and_empty_times);
+
+    // LoopMetrics::Histogram tests (2)
+    RUN_TEST(test_histogram_buckets);
+    RUN_TEST(test_histogram_percentiles);
+
     return UNITY_END();
 }